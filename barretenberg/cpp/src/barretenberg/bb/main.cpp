@@ -31,6 +31,7 @@
 #include <barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp>
 #include <barretenberg/dsl/acir_proofs/acir_composer.hpp>
 #include <barretenberg/srs/global_crs.hpp>
+#include <charconv>
 #include <cstdint>
 #include <fstream>
 #include <iostream>
@@ -48,6 +49,14 @@ std::string getHomeDir()
 
 std::string CRS_PATH = getHomeDir() + "/.bb-crs";
 
+// If set, Honk precomputed polynomials are cached here (keyed by circuit structure) and reused across invocations
+std::string PRECOMPUTED_CACHE_DIR;
+
+// If set, Honk prover polynomials are kept in a memory-mapped scratch file in this directory and paged out between
+// protocol stages once more than MAX_RESIDENT_POLYNOMIAL_MB of them are held in memory (0: as soon as possible)
+std::string POLYNOMIAL_SCRATCH_DIR;
+size_t MAX_RESIDENT_POLYNOMIAL_MB = 0;
+
 const std::filesystem::path current_path = std::filesystem::current_path();
 const auto current_dir = current_path.filename().string();
 
@@ -1061,7 +1070,18 @@ UltraProver_<Flavor> compute_valid_prover(const std::string& bytecodePath, const
     size_t srs_size = builder.get_circuit_subgroup_size(builder.get_total_circuit_size() + num_extra_gates);
     init_bn254_crs(srs_size);
 
-    Prover prover{ builder };
+    std::shared_ptr<PrecomputedPolynomialsCache<Flavor>> precomputed_cache;
+    if (!PRECOMPUTED_CACHE_DIR.empty()) {
+        precomputed_cache = std::make_shared<PrecomputedPolynomialsCache<Flavor>>(PRECOMPUTED_CACHE_DIR);
+    }
+    auto instance =
+        std::make_shared<ProverInstance_<Flavor>>(builder, TraceStructure::NONE, nullptr, precomputed_cache);
+    if (!POLYNOMIAL_SCRATCH_DIR.empty()) {
+        instance->use_scratch_store(std::make_shared<PolynomialScratchStore<bb::fr>>(
+            PolynomialScratchStore<bb::fr>::Options{ .directory = POLYNOMIAL_SCRATCH_DIR,
+                                                     .max_resident_bytes = MAX_RESIDENT_POLYNOMIAL_MB << 20 }));
+    }
+    Prover prover{ instance };
     return prover;
 }
 
@@ -1365,6 +1385,19 @@ int main(int argc, char* argv[])
         std::string pk_path = get_option(args, "-r", "./target/pk");
         bool honk_recursion = flag_present(args, "-h");
         CRS_PATH = get_option(args, "-c", CRS_PATH);
+        PRECOMPUTED_CACHE_DIR = get_option(args, "--precomputed_cache_dir", PRECOMPUTED_CACHE_DIR);
+        POLYNOMIAL_SCRATCH_DIR = get_option(args, "--polynomial_scratch_dir", POLYNOMIAL_SCRATCH_DIR);
+        const std::string max_resident_polynomial_mb = get_option(args, "--max_resident_polynomial_mb", "0");
+        const char* max_resident_polynomial_mb_end =
+            max_resident_polynomial_mb.data() + max_resident_polynomial_mb.size();
+        auto [parsed_end, parse_error] = std::from_chars(
+            max_resident_polynomial_mb.data(), max_resident_polynomial_mb_end, MAX_RESIDENT_POLYNOMIAL_MB);
+        if (parse_error != std::errc() || parsed_end != max_resident_polynomial_mb_end ||
+            MAX_RESIDENT_POLYNOMIAL_MB > (SIZE_MAX >> 20)) {
+            std::cerr << "Invalid value for --max_resident_polynomial_mb (expected a number of megabytes): "
+                      << max_resident_polynomial_mb << "\n";
+            return 1;
+        }
 
         // Skip CRS initialization for any command which doesn't require the CRS.
         if (command == "--version") {
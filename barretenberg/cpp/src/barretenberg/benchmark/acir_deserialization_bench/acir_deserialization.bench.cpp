@@ -0,0 +1,147 @@
+#include <benchmark/benchmark.h>
+#include <iomanip>
+#include <sstream>
+
+#include "barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+using namespace benchmark;
+using namespace bb;
+using namespace acir_format;
+
+namespace {
+
+auto& engine = numeric::get_debug_randomness();
+
+// ACIR field elements are serialized as 64 hex digits
+std::string field_element(const uint256_t& value)
+{
+    std::ostringstream os;
+    os << std::hex << std::setfill('0');
+    for (size_t i = 4; i > 0; --i) {
+        os << std::setw(16) << value.data[i - 1];
+    }
+    return os.str();
+}
+
+uint256_t random_element()
+{
+    return uint256_t(fr::random_element(&engine));
+}
+
+Program::Witness witness(uint32_t index)
+{
+    return { .value = index };
+}
+
+/**
+ * @brief A large ACIR program, standing for a contract artifact: an ACIR function of 2 * num_witnesses arithmetic and
+ * range opcodes
+ */
+std::vector<uint8_t> program_buf(uint32_t num_witnesses)
+{
+    std::vector<Program::Opcode> opcodes;
+    for (uint32_t i = 0; i + 2 < num_witnesses; ++i) {
+        // q_m * w_i * w_{i+1} + q_l * w_{i+2} + q_c = 0
+        Program::Expression expression{
+            .mul_terms = { { field_element(random_element()), witness(i), witness(i + 1) } },
+            .linear_combinations = { { field_element(random_element()), witness(i + 2) } },
+            .q_c = field_element(random_element()),
+        };
+        opcodes.push_back({ Program::Opcode::AssertZero{ expression } });
+        Program::FunctionInput input{ .input = { Program::ConstantOrWitnessEnum::Witness{ witness(i) } },
+                                      .num_bits = 32 };
+        opcodes.push_back({ Program::Opcode::BlackBoxFuncCall{ { Program::BlackBoxFuncCall::RANGE{ input } } } });
+    }
+
+    Program::Circuit circuit{ .current_witness_index = num_witnesses - 1,
+                              .opcodes = std::move(opcodes),
+                              .expression_width = { Program::ExpressionWidth::Bounded{ 4 } },
+                              .private_parameters = {},
+                              .public_parameters = { { witness(0) } },
+                              .return_values = {},
+                              .assert_messages = {},
+                              .recursive = false };
+    Program::Program program{ .functions = { std::move(circuit) }, .unconstrained_functions = {} };
+    return program.bincodeSerialize();
+}
+
+/**
+ * @brief The witness stack of a program with a single function call of num_witnesses witnesses
+ */
+std::vector<uint8_t> witness_buf(uint32_t num_witnesses)
+{
+    WitnessStack::WitnessMap witness_map;
+    for (uint32_t i = 0; i < num_witnesses; ++i) {
+        witness_map.value[{ i }] = field_element(random_element());
+    }
+    WitnessStack::WitnessStack witness_stack{ .stack = { { .index = 0, .witness = std::move(witness_map) } } };
+    return witness_stack.bincodeSerialize();
+}
+
+/**
+ * @brief Benchmark: Conversion of a program to AcirFormat through the serde object tree of the whole program
+ */
+void program_serde_tree(State& state) noexcept
+{
+    const auto buf = program_buf(static_cast<uint32_t>(state.range(0)));
+    for (auto _ : state) {
+        auto program = Program::Program::bincodeDeserialize(buf);
+        auto constraint_system = circuit_serde_to_acir_format(program.functions[0], /*honk_recursion=*/false);
+        DoNotOptimize(constraint_system);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(buf.size()));
+}
+
+/**
+ * @brief Benchmark: Streaming conversion of a program to AcirFormat
+ */
+void program_streaming(State& state) noexcept
+{
+    const auto buf = program_buf(static_cast<uint32_t>(state.range(0)));
+    for (auto _ : state) {
+        auto constraint_systems = program_buf_to_acir_format(buf, /*honk_recursion=*/false);
+        DoNotOptimize(constraint_systems);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(buf.size()));
+}
+
+/**
+ * @brief Benchmark: Conversion of a witness stack to WitnessVectorStack through the serde witness maps
+ */
+void witness_serde_tree(State& state) noexcept
+{
+    const auto buf = witness_buf(static_cast<uint32_t>(state.range(0)));
+    for (auto _ : state) {
+        auto witness_stack = WitnessStack::WitnessStack::bincodeDeserialize(buf);
+        WitnessVectorStack witness_vector_stack;
+        for (auto const& stack_item : witness_stack.stack) {
+            witness_vector_stack.emplace_back(stack_item.index, witness_map_to_witness_vector(stack_item.witness));
+        }
+        DoNotOptimize(witness_vector_stack);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(buf.size()));
+}
+
+/**
+ * @brief Benchmark: Streaming conversion of a witness stack to WitnessVectorStack
+ */
+void witness_streaming(State& state) noexcept
+{
+    const auto buf = witness_buf(static_cast<uint32_t>(state.range(0)));
+    for (auto _ : state) {
+        auto witness_vector_stack = witness_buf_to_witness_stack(buf);
+        DoNotOptimize(witness_vector_stack);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(buf.size()));
+}
+
+} // namespace
+
+BENCHMARK(program_serde_tree)->RangeMultiplier(8)->Range(1 << 12, 1 << 18)->Unit(kMillisecond);
+BENCHMARK(program_streaming)->RangeMultiplier(8)->Range(1 << 12, 1 << 18)->Unit(kMillisecond);
+BENCHMARK(witness_serde_tree)->RangeMultiplier(8)->Range(1 << 12, 1 << 18)->Unit(kMillisecond);
+BENCHMARK(witness_streaming)->RangeMultiplier(8)->Range(1 << 12, 1 << 18)->Unit(kMillisecond);
+
+// NOLINTNEXTLINE macro invokation triggers style guideline errors from googletest code
+BENCHMARK_MAIN();
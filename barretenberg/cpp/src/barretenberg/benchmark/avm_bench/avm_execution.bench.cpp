@@ -0,0 +1,66 @@
+#include "barretenberg/vm/avm/trace/execution.hpp"
+#include "barretenberg/vm/avm/trace/instructions.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+using namespace bb::avm_trace;
+
+namespace {
+
+/**
+ * @brief A program counting from 0 to num_iterations, i.e., a loop of 3 instructions (ADD, LT, JUMPI)
+ */
+std::vector<Instruction> counting_loop(uint32_t num_iterations)
+{
+    const uint8_t direct = 0;
+    return {
+        Instruction(OpCode::SET, { direct, AvmMemoryTag::U32, uint32_t(0), uint32_t(0) }),
+        Instruction(OpCode::SET, { direct, AvmMemoryTag::U32, uint32_t(1), uint32_t(1) }),
+        Instruction(OpCode::SET, { direct, AvmMemoryTag::U32, num_iterations, uint32_t(2) }),
+        // Loop body starting at pc 3: counter += 1; cond = counter < num_iterations; if cond jump to pc 3
+        Instruction(OpCode::ADD, { direct, AvmMemoryTag::U32, uint32_t(0), uint32_t(1), uint32_t(0) }),
+        Instruction(OpCode::LT, { direct, AvmMemoryTag::U32, uint32_t(0), uint32_t(2), uint32_t(3) }),
+        Instruction(OpCode::JUMPI, { direct, uint32_t(3), uint32_t(3) }),
+        Instruction(OpCode::RETURN, { direct, uint32_t(0), uint32_t(0) }),
+    };
+}
+
+/**
+ * @brief Benchmark: Execution (trace generation) of a counting loop of state.range(0) iterations. The number of items
+ * processed is the number of executed instructions.
+ */
+void execute_counting_loop(State& state) noexcept
+{
+    const auto num_iterations = static_cast<uint32_t>(state.range(0));
+    const auto instructions = counting_loop(num_iterations);
+    const auto public_inputs = Execution::getDefaultPublicInputs();
+    for (auto _ : state) {
+        auto trace = Execution::gen_trace(instructions, /*calldata=*/{}, public_inputs);
+        DoNotOptimize(trace.data());
+    }
+    state.SetItemsProcessed(state.iterations() * (3 * state.range(0) + 4));
+}
+
+/**
+ * @brief Benchmark: Simulation (execution without any trace) of a counting loop of state.range(0) iterations.
+ */
+void simulate_counting_loop(State& state) noexcept
+{
+    const auto num_iterations = static_cast<uint32_t>(state.range(0));
+    const auto instructions = counting_loop(num_iterations);
+    const auto public_inputs = Execution::getDefaultPublicInputs();
+    for (auto _ : state) {
+        auto result = Execution::simulate(instructions, /*calldata=*/{}, public_inputs);
+        DoNotOptimize(result.returndata.data());
+    }
+    state.SetItemsProcessed(state.iterations() * (3 * state.range(0) + 4));
+}
+
+} // namespace
+
+BENCHMARK(execute_counting_loop)->RangeMultiplier(4)->Range(1 << 8, 1 << 12)->Unit(kMillisecond);
+BENCHMARK(simulate_counting_loop)->RangeMultiplier(4)->Range(1 << 8, 1 << 12)->Unit(kMillisecond);
+
+// NOLINTNEXTLINE macro invokation triggers style guideline errors from googletest code
+BENCHMARK_MAIN();
@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/translator_vm/translator_circuit_builder.hpp"
+#include "barretenberg/translator_vm/translator_prover.hpp"
+
+using namespace benchmark;
+using namespace bb;
+
+using Flavor = TranslatorFlavor;
+using Builder = TranslatorCircuitBuilder;
+using Transcript = Flavor::Transcript;
+
+namespace {
+
+std::shared_ptr<ECCOpQueue> generate_op_queue(size_t num_ops)
+{
+    auto op_queue = std::make_shared<ECCOpQueue>();
+    auto P1 = g1::affine_element::random_element();
+    auto P2 = g1::affine_element::random_element();
+    auto z = fr::random_element();
+    // Each iteration adds 3 ops
+    for (size_t i = 0; i < num_ops / 3; i++) {
+        op_queue->add_accumulate(P1);
+        op_queue->mul_accumulate(P2, z);
+        op_queue->eq_and_reset();
+    }
+    return op_queue;
+}
+
+/**
+ * @brief Construction of the translator circuit from the op queue (witness generation)
+ */
+void translator_construct_circuit(State& state) noexcept
+{
+    const size_t num_ops = 1 << static_cast<size_t>(state.range(0));
+    auto op_queue = generate_op_queue(num_ops);
+    const fq batching_challenge = fq::random_element();
+    const fq evaluation_challenge = fq::random_element();
+    for (auto _ : state) {
+        Builder builder{ batching_challenge, evaluation_challenge, op_queue };
+        DoNotOptimize(builder.num_gates);
+    }
+}
+
+/**
+ * @brief Construction of the proving key from the circuit
+ */
+void translator_construct_prover(State& state) noexcept
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+
+    const size_t num_ops = 1 << static_cast<size_t>(state.range(0));
+    auto op_queue = generate_op_queue(num_ops);
+    Builder builder{ fq::random_element(), fq::random_element(), op_queue };
+    for (auto _ : state) {
+        TranslatorProver prover{ builder, std::make_shared<Transcript>() };
+        DoNotOptimize(prover.key);
+    }
+}
+
+/**
+ * @brief Construction of the proof
+ */
+void translator_prove(State& state) noexcept
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+
+    const size_t num_ops = 1 << static_cast<size_t>(state.range(0));
+    auto op_queue = generate_op_queue(num_ops);
+    Builder builder{ fq::random_element(), fq::random_element(), op_queue };
+    for (auto _ : state) {
+        state.PauseTiming();
+        TranslatorProver prover{ builder, std::make_shared<Transcript>() };
+        state.ResumeTiming();
+        auto proof = prover.construct_proof();
+        DoNotOptimize(proof);
+    }
+}
+
+BENCHMARK(translator_construct_circuit)->Unit(kMillisecond)->DenseRange(10, 14);
+BENCHMARK(translator_construct_prover)->Unit(kMillisecond)->DenseRange(10, 14);
+BENCHMARK(translator_prove)->Unit(kMillisecond)->DenseRange(10, 14);
+} // namespace
+
+BENCHMARK_MAIN();
@@ -66,6 +66,38 @@ void ipa_verify(State& state) noexcept
         ASSERT(result);
     }
 }
+
+// Verify every proof produced by ipa_open, one by one and then as a batch
+std::vector<std::shared_ptr<NativeTranscript>> construct_verifier_transcripts()
+{
+    std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts;
+    for (auto& prover_transcript : prover_transcripts) {
+        verifier_transcripts.emplace_back(std::make_shared<NativeTranscript>(prover_transcript->proof_data));
+    }
+    return verifier_transcripts;
+}
+void ipa_verify_all(State& state) noexcept
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto verifier_transcripts = construct_verifier_transcripts();
+        state.ResumeTiming();
+        for (size_t i = 0; i < opening_claims.size(); i++) {
+            auto result = IPA<Curve>::reduce_verify(vk, opening_claims[i], verifier_transcripts[i]);
+            ASSERT(result);
+        }
+    }
+}
+void ipa_batch_verify(State& state) noexcept
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto verifier_transcripts = construct_verifier_transcripts();
+        state.ResumeTiming();
+        auto result = IPA<Curve>::batch_reduce_verify(vk, opening_claims, verifier_transcripts);
+        ASSERT(result);
+    }
+}
 } // namespace
 BENCHMARK(ipa_open)
     ->Unit(kMillisecond)
@@ -75,4 +107,6 @@ BENCHMARK(ipa_verify)
     ->Unit(kMillisecond)
     ->DenseRange(MIN_POLYNOMIAL_DEGREE_LOG2, MAX_POLYNOMIAL_DEGREE_LOG2)
     ->Setup(DoSetup);
+BENCHMARK(ipa_verify_all)->Unit(kMillisecond)->Setup(DoSetup);
+BENCHMARK(ipa_batch_verify)->Unit(kMillisecond)->Setup(DoSetup);
 BENCHMARK_MAIN();
\ No newline at end of file
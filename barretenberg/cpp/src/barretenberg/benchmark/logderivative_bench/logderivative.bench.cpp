@@ -0,0 +1,88 @@
+#include "barretenberg/honk/proof_system/logderivative_library.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
+#include "barretenberg/sumcheck/instance/prover_instance.hpp"
+#include "barretenberg/vm/avm/generated/circuit_builder.hpp"
+#include "barretenberg/vm/avm/trace/trace.hpp"
+#include "barretenberg/vm/constants.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+/**
+ * @brief Computation of the Mega log-derivative inverses (table lookups and the three databus columns) for a circuit
+ * of 2^log_size gates, an eighth of which read from calldata
+ */
+void mega_logderivative_inverses(State& state) noexcept
+{
+    using Flavor = MegaFlavor;
+    using Builder = Flavor::CircuitBuilder;
+    using FF = Flavor::FF;
+
+    const size_t log_size = static_cast<size_t>(state.range(0));
+    const size_t num_reads = (1UL << log_size) / 8;
+
+    Builder builder;
+    for (size_t i = 0; i < num_reads; ++i) {
+        builder.add_public_calldata(builder.add_variable(FF::random_element()));
+    }
+    for (size_t i = 0; i < num_reads; ++i) {
+        builder.read_calldata(builder.add_variable(FF(i)));
+    }
+    MockCircuits::add_lookup_gates(builder);
+    MockCircuits::construct_arithmetic_circuit(builder, log_size);
+
+    auto instance = std::make_shared<ProverInstance_<Flavor>>(builder);
+    auto params = RelationParameters<FF>::get_random();
+    for (auto _ : state) {
+        instance->proving_key.compute_logderivative_inverses(params);
+    }
+}
+
+/**
+ * @brief Computation of the inverses of every AVM lookup and permutation for a trace of num_ops additions,
+ * comparisons and bitwise ands
+ */
+void avm_logderivative_inverses(State& state) noexcept
+{
+    using Flavor = AvmFlavor;
+    using FF = Flavor::FF;
+    using avm_trace::AvmMemoryTag;
+
+    const auto num_ops = static_cast<uint32_t>(state.range(0));
+
+    avm_trace::VmPublicInputs public_inputs;
+    std::get<0>(public_inputs).at(DA_GAS_LEFT_CONTEXT_INPUTS_OFFSET) = 1000000000;
+    std::get<0>(public_inputs).at(L2_GAS_LEFT_CONTEXT_INPUTS_OFFSET) = 1000000000;
+    avm_trace::AvmTraceBuilder trace_builder(public_inputs);
+    trace_builder.op_set(0, 7, 0, AvmMemoryTag::U32);
+    trace_builder.op_set(0, 13, 1, AvmMemoryTag::U32);
+    for (uint32_t i = 0; i < num_ops; ++i) {
+        trace_builder.op_add(0, 0, 1, 1, AvmMemoryTag::U32);
+        trace_builder.op_lt(0, 0, 1, 2, AvmMemoryTag::U32);
+        trace_builder.op_and(0, 0, 1, 3, AvmMemoryTag::U32);
+    }
+    trace_builder.op_return(0, 0, 0);
+
+    AvmCircuitBuilder circuit_builder;
+    circuit_builder.set_trace(trace_builder.finalize());
+    auto polynomials = circuit_builder.compute_polynomials();
+    const size_t num_rows = polynomials.get_polynomial_size();
+    auto params = RelationParameters<FF>::get_random();
+
+    for (auto _ : state) {
+        bb::constexpr_for<0, std::tuple_size_v<Flavor::LookupRelations>, 1>([&]<size_t i>() {
+            using Relation = std::tuple_element_t<i, Flavor::LookupRelations>;
+            compute_logderivative_inverse<Flavor, Relation>(polynomials, params, num_rows);
+        });
+    }
+}
+
+} // namespace
+
+BENCHMARK(mega_logderivative_inverses)->Unit(kMillisecond)->DenseRange(14, 18, 2);
+BENCHMARK(avm_logderivative_inverses)->Unit(kMillisecond)->RangeMultiplier(8)->Range(1 << 6, 1 << 12);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,142 @@
+#include <array>
+#include <benchmark/benchmark.h>
+#include <utility>
+
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+#include "barretenberg/numeric/bitop/sparse_form.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "barretenberg/plonk_honk_shared/composer/composer_lib.hpp"
+#include "barretenberg/stdlib_circuit_builders/plookup_tables/aes128.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+using Flavor = UltraFlavor;
+using Builder = UltraCircuitBuilder;
+using FF = Flavor::FF;
+using Polynomial = Flavor::Polynomial;
+
+auto& engine = numeric::get_debug_randomness();
+
+// Multi-tables read by the lookups of the benchmarked circuits, keyed by one or (for 2-to-1 lookups) two 32-bit values
+const std::array<std::pair<plookup::MultiTableId, bool>, 7> LOOKUP_TABLES{ {
+    { plookup::MultiTableId::UINT32_XOR, true },
+    { plookup::MultiTableId::UINT32_AND, true },
+    { plookup::MultiTableId::BLAKE_XOR, true },
+    { plookup::MultiTableId::SHA256_CH_INPUT, false },
+    { plookup::MultiTableId::SHA256_MAJ_INPUT, false },
+    { plookup::MultiTableId::SHA256_WITNESS_INPUT, false },
+    { plookup::MultiTableId::AES_INPUT, false },
+} };
+
+/**
+ * @brief A circuit of num_lookups lookups on each of the tables above, and as many AES sbox lookups, which read a
+ * table keyed by sparse values
+ */
+Builder lookup_circuit(size_t num_lookups)
+{
+    Builder builder;
+    for (size_t i = 0; i < num_lookups; ++i) {
+        for (const auto& [id, is_2_to_1_lookup] : LOOKUP_TABLES) {
+            FF left{ engine.get_random_uint32() };
+            FF right{ is_2_to_1_lookup ? engine.get_random_uint32() : 0 };
+            auto left_idx = builder.add_variable(left);
+            auto accumulators = plookup::get_lookup_accumulators(id, left, right, is_2_to_1_lookup);
+            if (is_2_to_1_lookup) {
+                builder.create_gates_from_plookup_accumulators(id, accumulators, left_idx, builder.add_variable(right));
+            } else {
+                builder.create_gates_from_plookup_accumulators(id, accumulators, left_idx);
+            }
+        }
+
+        FF sparse_byte{ numeric::map_into_sparse_form<plookup::aes128_tables::AES_BASE>(engine.get_random_uint8()) };
+        auto sparse_byte_idx = builder.add_variable(sparse_byte);
+        auto sbox_accumulators = plookup::get_lookup_accumulators(plookup::MultiTableId::AES_SBOX, sparse_byte);
+        builder.create_gates_from_plookup_accumulators(
+            plookup::MultiTableId::AES_SBOX, sbox_accumulators, sparse_byte_idx);
+    }
+    return builder;
+}
+
+size_t dyadic_size(const Builder& builder)
+{
+    return 1UL << (numeric::get_msb(builder.get_tables_size()) + 1);
+}
+
+/**
+ * @brief Benchmark: Construction of the four table polynomials, whose size only depends on the tables read
+ */
+void table_polynomials(State& state) noexcept
+{
+    auto builder = lookup_circuit(1);
+    const size_t circuit_size = dyadic_size(builder);
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::array<Polynomial, 4> tables{ Polynomial(circuit_size),
+                                          Polynomial(circuit_size),
+                                          Polynomial(circuit_size),
+                                          Polynomial(circuit_size) };
+        state.ResumeTiming();
+        construct_lookup_table_polynomials<Flavor>(
+            { tables[0], tables[1], tables[2], tables[3] }, builder, circuit_size);
+        DoNotOptimize(tables);
+    }
+}
+
+/**
+ * @brief Benchmark: Construction of the read counts and tags
+ */
+void read_counts(State& state) noexcept
+{
+    auto builder = lookup_circuit(static_cast<size_t>(state.range(0)));
+    const size_t circuit_size = dyadic_size(builder);
+    for (auto _ : state) {
+        state.PauseTiming();
+        Polynomial counts(circuit_size);
+        Polynomial tags(circuit_size);
+        state.ResumeTiming();
+        construct_lookup_read_counts<Flavor>(counts, tags, builder, circuit_size);
+        DoNotOptimize(counts);
+    }
+}
+
+/**
+ * @brief Benchmark: Construction of the read counts and tags serially through the entry-index map of each table, as a
+ * baseline for read_counts
+ */
+void read_counts_index_map(State& state) noexcept
+{
+    auto builder = lookup_circuit(static_cast<size_t>(state.range(0)));
+    const size_t circuit_size = dyadic_size(builder);
+    for (auto _ : state) {
+        state.PauseTiming();
+        Polynomial counts(circuit_size);
+        Polynomial tags(circuit_size);
+        state.ResumeTiming();
+        size_t table_offset = circuit_size - builder.get_tables_size();
+        for (auto& table : builder.lookup_tables) {
+            table.index_map.initialize(table.column_1, table.column_2, table.column_3);
+            for (auto& gate_data : table.lookup_gates) {
+                auto table_entry = gate_data.to_table_components(table.use_twin_keys);
+                size_t index_in_poly = table_offset + table.index_map[table_entry];
+                counts[index_in_poly]++;
+                tags[index_in_poly] = 1;
+            }
+            table_offset += table.size();
+        }
+        DoNotOptimize(counts);
+    }
+}
+
+} // namespace
+
+BENCHMARK(table_polynomials)->Unit(kMillisecond);
+BENCHMARK(read_counts)->RangeMultiplier(4)->Range(1 << 8, 1 << 14)->Unit(kMillisecond);
+BENCHMARK(read_counts_index_map)->RangeMultiplier(4)->Range(1 << 8, 1 << 14)->Unit(kMillisecond);
+
+// NOLINTNEXTLINE macro invokation triggers style guideline errors from googletest code
+BENCHMARK_MAIN();
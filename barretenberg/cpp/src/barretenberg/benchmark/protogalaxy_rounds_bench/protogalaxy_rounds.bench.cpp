@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 
 #include "barretenberg/protogalaxy/protogalaxy_prover.hpp"
+#include "barretenberg/protogalaxy/protogalaxy_prover_internal.hpp"
 #include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 #include "barretenberg/sumcheck/instance/instances.hpp"
@@ -60,6 +61,54 @@ BENCHMARK_CAPTURE(bench_round_mega, combiner_quotient, [](auto& prover) { prover
 BENCHMARK_CAPTURE(bench_round_mega, accumulator_update, [](auto& prover) { prover.accumulator_update_round(); })
     -> DenseRange(14, 20) -> Unit(kMillisecond);
 
+/**
+ * @brief Compute the combiner over NUM instances, i.e. the bulk of the combiner quotient round when folding NUM - 1
+ * instances into an accumulator at once
+ */
+template <typename Flavor, size_t NUM> void bench_combiner(::benchmark::State& state)
+{
+    using Builder = typename Flavor::CircuitBuilder;
+    using FF = typename Flavor::FF;
+    using ProverInstance = ProverInstance_<Flavor>;
+    using Instances = ProverInstances_<Flavor, NUM>;
+    using ProverState = typename ProtoGalaxyProver_<Instances>::State;
+    using Fun = ProtogalaxyProverInternal<Instances>;
+
+    bb::srs::init_crs_factory("../srs_db/ignition");
+    auto log2_num_gates = static_cast<size_t>(state.range(0));
+
+    std::vector<std::shared_ptr<ProverInstance>> instance_data;
+    for (size_t idx = 0; idx < NUM; idx++) {
+        Builder builder;
+        MockCircuits::construct_arithmetic_circuit(builder, log2_num_gates);
+        instance_data.emplace_back(std::make_shared<ProverInstance>(builder));
+    }
+    Instances instances(instance_data);
+
+    ProverState prover_state;
+    prover_state.alphas = Fun::compute_and_extend_alphas(instances);
+    prover_state.optimised_relation_parameters =
+        Fun::template compute_extended_relation_parameters<typename ProverState::OptimisedRelationParameters>(
+            instances);
+    std::vector<FF> gate_challenges(log2_num_gates);
+    for (auto& challenge : gate_challenges) {
+        challenge = FF::random_element();
+    }
+    PowPolynomial<FF> pow_polynomial{ gate_challenges, log2_num_gates };
+
+    for (auto _ : state) {
+        auto combiner = Fun::compute_combiner(instances,
+                                              pow_polynomial,
+                                              prover_state.optimised_relation_parameters,
+                                              prover_state.alphas,
+                                              prover_state.optimised_univariate_accumulators);
+        DoNotOptimize(combiner);
+    }
+}
+
+BENCHMARK(bench_combiner<MegaFlavor, 2>)->DenseRange(14, 20)->Unit(kMillisecond);
+BENCHMARK(bench_combiner<MegaFlavor, 3>)->DenseRange(14, 20)->Unit(kMillisecond);
+
 } // namespace bb
 
 BENCHMARK_MAIN();
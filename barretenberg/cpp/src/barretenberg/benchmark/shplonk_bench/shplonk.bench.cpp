@@ -0,0 +1,124 @@
+#include "barretenberg/commitment_schemes/shplonk/shplonk.hpp"
+#include "barretenberg/common/op_count_google_bench.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+constexpr size_t MIN_LOG_CIRCUIT_SIZE = 12;
+constexpr size_t MAX_LOG_CIRCUIT_SIZE = 16;
+
+template <typename Curve> std::shared_ptr<CommitmentKey<Curve>> ck;
+
+static void DoSetup(const benchmark::State&)
+{
+    srs::init_crs_factory("../srs_db/ignition");
+    srs::init_grumpkin_crs_factory("../srs_db/grumpkin");
+    ck<curve::BN254> = std::make_shared<CommitmentKey<curve::BN254>>(1 << MAX_LOG_CIRCUIT_SIZE);
+    ck<curve::Grumpkin> = std::make_shared<CommitmentKey<curve::Grumpkin>>(1 << MAX_LOG_CIRCUIT_SIZE);
+}
+
+template <typename Curve>
+ProverOpeningClaim<Curve> random_claim(const size_t size, const typename Curve::ScalarField& point)
+{
+    auto polynomial = Polynomial<typename Curve::ScalarField>::random(size);
+    const auto evaluation = polynomial.evaluate(point);
+    return { polynomial, { point, evaluation } };
+}
+
+/**
+ * @brief The claims batched by Shplonk in the ClientIVC decider: the ECCVM prover reduces the ZeroMorph univariate
+ * claim and the batched claim on the transcript polynomials (for the Translator consistency check), both of full
+ * circuit size and opened at distinct points.
+ */
+std::vector<ProverOpeningClaim<curve::Grumpkin>> eccvm_opening_claims(const size_t circuit_size)
+{
+    using Fr = curve::Grumpkin::ScalarField;
+    return { random_claim<curve::Grumpkin>(circuit_size, Fr::random_element()),
+             random_claim<curve::Grumpkin>(circuit_size, Fr::random_element()) };
+}
+
+/**
+ * @brief The claims produced by Gemini for a multilinear of 2^m coefficients: A₀ opened at r and −r and the fold Aₗ
+ * of size 2^{m-l} opened at −r^{2^l}.
+ */
+std::vector<ProverOpeningClaim<curve::BN254>> gemini_opening_claims(const size_t log_circuit_size)
+{
+    using Fr = curve::BN254::ScalarField;
+    std::vector<ProverOpeningClaim<curve::BN254>> claims;
+    const Fr r = Fr::random_element();
+    const auto A_0 = Polynomial<Fr>::random(size_t(1) << log_circuit_size);
+    claims.push_back({ A_0, { r, A_0.evaluate(r) } });
+    claims.push_back({ A_0, { -r, A_0.evaluate(-r) } });
+    Fr r_squared = r.sqr();
+    for (size_t l = 1; l < log_circuit_size; ++l) {
+        claims.push_back(random_claim<curve::BN254>(size_t(1) << (log_circuit_size - l), -r_squared));
+        r_squared = r_squared.sqr();
+    }
+    return claims;
+}
+
+// Only the batched quotient Q and the partially evaluated quotient G, without commitments
+template <typename Curve> void shplonk_quotients(State& state, std::vector<ProverOpeningClaim<Curve>> opening_claims)
+{
+    using Fr = typename Curve::ScalarField;
+    const Fr nu = Fr::random_element();
+    const Fr z = Fr::random_element();
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        auto batched_quotient = ShplonkProver_<Curve>::compute_batched_quotient(opening_claims, nu);
+        auto claim = ShplonkProver_<Curve>::compute_partially_evaluated_batched_quotient(
+            opening_claims, batched_quotient, nu, z);
+        DoNotOptimize(claim);
+    }
+}
+
+// The full Shplonk prover, including the commitment to Q
+template <typename Curve> void shplonk_prove(State& state, std::vector<ProverOpeningClaim<Curve>> opening_claims)
+{
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        auto transcript = std::make_shared<NativeTranscript>();
+        auto claim = ShplonkProver_<Curve>::prove(ck<Curve>, opening_claims, transcript);
+        DoNotOptimize(claim);
+    }
+}
+
+void eccvm_shplonk_quotients(State& state) noexcept
+{
+    shplonk_quotients<curve::Grumpkin>(state, eccvm_opening_claims(size_t(1) << state.range(0)));
+}
+void eccvm_shplonk_prove(State& state) noexcept
+{
+    shplonk_prove<curve::Grumpkin>(state, eccvm_opening_claims(size_t(1) << state.range(0)));
+}
+void gemini_shplonk_quotients(State& state) noexcept
+{
+    shplonk_quotients<curve::BN254>(state, gemini_opening_claims(static_cast<size_t>(state.range(0))));
+}
+void gemini_shplonk_prove(State& state) noexcept
+{
+    shplonk_prove<curve::BN254>(state, gemini_opening_claims(static_cast<size_t>(state.range(0))));
+}
+} // namespace
+
+BENCHMARK(eccvm_shplonk_quotients)
+    ->Unit(kMillisecond)
+    ->DenseRange(MIN_LOG_CIRCUIT_SIZE, MAX_LOG_CIRCUIT_SIZE)
+    ->Setup(DoSetup);
+BENCHMARK(eccvm_shplonk_prove)
+    ->Unit(kMillisecond)
+    ->DenseRange(MIN_LOG_CIRCUIT_SIZE, MAX_LOG_CIRCUIT_SIZE)
+    ->Setup(DoSetup);
+BENCHMARK(gemini_shplonk_quotients)
+    ->Unit(kMillisecond)
+    ->DenseRange(MIN_LOG_CIRCUIT_SIZE, MAX_LOG_CIRCUIT_SIZE)
+    ->Setup(DoSetup);
+BENCHMARK(gemini_shplonk_prove)
+    ->Unit(kMillisecond)
+    ->DenseRange(MIN_LOG_CIRCUIT_SIZE, MAX_LOG_CIRCUIT_SIZE)
+    ->Setup(DoSetup);
+BENCHMARK_MAIN();
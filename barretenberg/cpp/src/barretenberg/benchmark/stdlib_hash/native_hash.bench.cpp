@@ -0,0 +1,152 @@
+/**
+ * @file native_hash.bench.cpp
+ * @brief Throughput of the native SHA-256 and Keccak implementations, per kernel
+ *
+ */
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/common/cpu_features.hpp"
+#include "barretenberg/crypto/keccak/keccak.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+
+using namespace benchmark;
+
+namespace {
+
+constexpr size_t NUM_INPUTS = 64;
+
+enum class Kernel { Scalar, Avx2, ShaNi, Avx512 };
+
+/**
+ * @brief Restricts dispatch to a single kernel for the lifetime of the object
+ */
+class KernelSelection {
+  public:
+    explicit KernelSelection(Kernel kernel)
+        : detected(bb::get_cpu_features())
+    {
+        bb::CpuFeatures& features = bb::get_cpu_features();
+        features.sha = detected.sha && kernel == Kernel::ShaNi;
+        features.avx2 = detected.avx2 && (kernel == Kernel::Avx2 || kernel == Kernel::Avx512);
+        features.avx512f = detected.avx512f && kernel == Kernel::Avx512;
+        available = kernel == Kernel::Scalar || (kernel == Kernel::Avx2 && features.avx2) ||
+                    (kernel == Kernel::ShaNi && features.sha) || (kernel == Kernel::Avx512 && features.avx512f);
+    }
+    KernelSelection(const KernelSelection&) = delete;
+    KernelSelection(KernelSelection&&) = delete;
+    KernelSelection& operator=(const KernelSelection&) = delete;
+    KernelSelection& operator=(KernelSelection&&) = delete;
+    ~KernelSelection() { bb::get_cpu_features() = detected; }
+
+    bool available = false;
+
+  private:
+    bb::CpuFeatures detected;
+};
+
+std::vector<std::vector<uint8_t>> make_inputs(size_t num_inputs, size_t size)
+{
+    std::vector<std::vector<uint8_t>> inputs(num_inputs);
+    for (size_t i = 0; i < num_inputs; ++i) {
+        inputs[i].resize(size);
+        for (size_t j = 0; j < size; ++j) {
+            inputs[i][j] = static_cast<uint8_t>(i + j);
+        }
+    }
+    return inputs;
+}
+
+/**
+ * @brief Hash one message at a time
+ */
+template <Kernel kernel> void sha256_bench(State& state) noexcept
+{
+    KernelSelection selection(kernel);
+    if (!selection.available) {
+        state.SkipWithError("kernel not supported on this machine");
+        return;
+    }
+    const auto input = make_inputs(1, static_cast<size_t>(state.range(0)))[0];
+    for (auto _ : state) {
+        DoNotOptimize(bb::crypto::sha256(input));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(sha256_bench, Kernel::Scalar)->RangeMultiplier(16)->Range(64, 16384);
+BENCHMARK_TEMPLATE(sha256_bench, Kernel::ShaNi)->RangeMultiplier(16)->Range(64, 16384);
+
+/**
+ * @brief Hash NUM_INPUTS independent messages in one call
+ */
+template <Kernel kernel> void sha256_batch_bench(State& state) noexcept
+{
+    KernelSelection selection(kernel);
+    if (!selection.available) {
+        state.SkipWithError("kernel not supported on this machine");
+        return;
+    }
+    const auto inputs = make_inputs(NUM_INPUTS, static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(bb::crypto::sha256_batch(inputs));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(NUM_INPUTS) * state.range(0));
+}
+BENCHMARK_TEMPLATE(sha256_batch_bench, Kernel::Scalar)->RangeMultiplier(16)->Range(64, 16384);
+BENCHMARK_TEMPLATE(sha256_batch_bench, Kernel::Avx2)->RangeMultiplier(16)->Range(64, 16384);
+BENCHMARK_TEMPLATE(sha256_batch_bench, Kernel::ShaNi)->RangeMultiplier(16)->Range(64, 16384);
+
+/**
+ * @brief Permute NUM_INPUTS independent Keccak states in one call
+ */
+template <Kernel kernel> void keccakf1600_batch_bench(State& state) noexcept
+{
+    KernelSelection selection(kernel);
+    if (!selection.available) {
+        state.SkipWithError("kernel not supported on this machine");
+        return;
+    }
+    std::vector<uint64_t> states(NUM_INPUTS * 25);
+    for (size_t i = 0; i < states.size(); ++i) {
+        states[i] = i;
+    }
+    for (auto _ : state) {
+        ethash_keccakf1600_batch(states.data(), NUM_INPUTS);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_INPUTS));
+}
+BENCHMARK_TEMPLATE(keccakf1600_batch_bench, Kernel::Scalar);
+BENCHMARK_TEMPLATE(keccakf1600_batch_bench, Kernel::Avx2);
+BENCHMARK_TEMPLATE(keccakf1600_batch_bench, Kernel::Avx512);
+
+/**
+ * @brief Hash NUM_INPUTS independent messages with Keccak-256 in one call
+ */
+template <Kernel kernel> void keccak256_batch_bench(State& state) noexcept
+{
+    KernelSelection selection(kernel);
+    if (!selection.available) {
+        state.SkipWithError("kernel not supported on this machine");
+        return;
+    }
+    const auto inputs = make_inputs(NUM_INPUTS, static_cast<size_t>(state.range(0)));
+    std::vector<const uint8_t*> data;
+    std::vector<size_t> sizes;
+    for (const auto& input : inputs) {
+        data.push_back(input.data());
+        sizes.push_back(input.size());
+    }
+    std::vector<keccak256> hashes(NUM_INPUTS);
+    for (auto _ : state) {
+        ethash_keccak256_batch(data.data(), sizes.data(), NUM_INPUTS, hashes.data());
+        ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(NUM_INPUTS) * state.range(0));
+}
+BENCHMARK_TEMPLATE(keccak256_batch_bench, Kernel::Scalar)->RangeMultiplier(16)->Range(64, 16384);
+BENCHMARK_TEMPLATE(keccak256_batch_bench, Kernel::Avx2)->RangeMultiplier(16)->Range(64, 16384);
+BENCHMARK_TEMPLATE(keccak256_batch_bench, Kernel::Avx512)->RangeMultiplier(16)->Range(64, 16384);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/benchmark/ultra_bench/mock_circuits.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "barretenberg/ultra_honk/ultra_batch_verifier.hpp"
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+using VerificationKey = UltraFlavor::VerificationKey;
+
+/**
+ * @brief Construct num_proofs proofs of a circuit of 2^log2_num_gates arithmetic gates
+ * @details The verifier cost only depends logarithmically on the circuit size, so a small circuit is representative.
+ */
+std::pair<std::vector<HonkProof>, std::shared_ptr<VerificationKey>> construct_proofs(size_t num_proofs,
+                                                                                     size_t log2_num_gates = 12)
+{
+    srs::init_crs_factory("../srs_db/ignition");
+    UltraCircuitBuilder builder;
+    mock_circuits::generate_basic_arithmetic_circuit(builder, log2_num_gates);
+    auto instance = std::make_shared<ProverInstance_<UltraFlavor>>(builder);
+    UltraProver prover(instance);
+    auto verification_key = std::make_shared<VerificationKey>(instance->proving_key);
+    auto proof = prover.construct_proof();
+    return { std::vector<HonkProof>(num_proofs, proof), verification_key };
+}
+
+} // namespace
+
+/**
+ * @brief Benchmark: Verification of state.range(0) Ultra Honk proofs one by one, each with its own pairing
+ */
+static void verify_proofs_individually(State& state) noexcept
+{
+    auto [proofs, verification_key] = construct_proofs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (const auto& proof : proofs) {
+            UltraVerifier verifier(verification_key);
+            DoNotOptimize(verifier.verify_proof(proof));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * @brief Benchmark: Verification of state.range(0) Ultra Honk proofs as one batch with a single pairing
+ */
+static void verify_proofs_batched(State& state) noexcept
+{
+    auto [proofs, verification_key] = construct_proofs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(UltraBatchVerifier::verify_proofs(verification_key, proofs));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(verify_proofs_individually)->RangeMultiplier(4)->Range(1, 256)->Unit(kMillisecond);
+BENCHMARK(verify_proofs_batched)->RangeMultiplier(4)->Range(1, 256)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
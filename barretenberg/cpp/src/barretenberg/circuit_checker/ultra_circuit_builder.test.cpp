@@ -864,4 +864,120 @@ TEST(ultra_circuit_constructor, check_circuit_showcase)
     EXPECT_EQ(CircuitChecker::check(circuit_constructor), true);
 }
 
-} // namespace bb
\ No newline at end of file
+/**
+ * @brief Check that check_all reports every failing gate rather than stopping at the first one
+ *
+ */
+TEST(ultra_circuit_constructor, check_all_reports_every_failure)
+{
+    UltraCircuitBuilder builder;
+    auto add_gate = [&](bool valid) {
+        fr a = fr::random_element();
+        fr b = fr::random_element();
+        builder.create_add_gate({ builder.add_variable(a),
+                                  builder.add_variable(b),
+                                  builder.add_variable(valid ? a + b : a + b + 1),
+                                  1,
+                                  1,
+                                  -1,
+                                  0 });
+    };
+
+    std::vector<size_t> bad_rows;
+    for (size_t i = 0; i < 200; ++i) {
+        const bool valid = i % 67 != 13;
+        if (!valid) {
+            bad_rows.push_back(builder.blocks.arithmetic.size());
+        }
+        add_gate(valid);
+    }
+
+    auto result = UltraCircuitChecker::check_all(builder);
+    EXPECT_FALSE(result.passed());
+    EXPECT_TRUE(result.tag_check_passed);
+    ASSERT_EQ(result.failures.size(), bad_rows.size());
+    for (auto [failure, row] : zip_view(result.failures, bad_rows)) {
+        EXPECT_EQ(failure.block, "arithmetic");
+        EXPECT_EQ(failure.row_idx, row);
+        EXPECT_EQ(failure.relation, "Arithmetic");
+    }
+    EXPECT_FALSE(CircuitChecker::check(builder));
+}
+
+/**
+ * @brief Check that a failing tag check is reported by check_all
+ *
+ */
+TEST(ultra_circuit_constructor, check_all_bad_tag_permutation)
+{
+    UltraCircuitBuilder builder;
+    fr a = fr::random_element();
+
+    auto a_idx = builder.add_variable(a);
+    auto b_idx = builder.add_variable(-a);
+    builder.create_add_gate({ a_idx, b_idx, builder.zero_idx, 1, 1, 0, 0 });
+
+    builder.create_tag(1, 2);
+    builder.create_tag(2, 1);
+    builder.assign_tag(a_idx, 1);
+    builder.assign_tag(b_idx, 1);
+
+    auto result = UltraCircuitChecker::check_all(builder);
+    EXPECT_TRUE(result.failures.empty());
+    EXPECT_FALSE(result.tag_check_passed);
+    EXPECT_FALSE(result.passed());
+}
+
+/**
+ * @brief Check a circuit after each batch of constraints with the incremental checker, including RAM/ROM gates whose
+ * memory records are only processed at finalization
+ *
+ */
+TEST(ultra_circuit_constructor, incremental_check)
+{
+    UltraCircuitBuilder builder;
+    UltraCircuitChecker::IncrementalChecker<UltraCircuitBuilder> checker(builder);
+    EXPECT_TRUE(checker.check().passed());
+
+    size_t rom_id = builder.create_ROM_array(4);
+    size_t ram_id = builder.create_RAM_array(4);
+    for (size_t i = 0; i < 4; ++i) {
+        builder.set_ROM_element(rom_id, i, builder.add_variable(fr::random_element()));
+        builder.init_RAM_element(ram_id, i, builder.add_variable(fr::random_element()));
+    }
+
+    auto add_batch = [&](size_t batch) {
+        uint32_t index_idx = builder.add_variable(fr(batch % 4));
+        builder.create_new_range_constraint(index_idx, 3);
+        uint32_t a_idx = builder.read_ROM_array(rom_id, index_idx);
+        builder.write_RAM_array(ram_id, builder.add_variable(fr((batch + 1) % 4)), a_idx);
+        uint32_t b_idx = builder.read_RAM_array(ram_id, index_idx);
+        uint32_t c_idx = builder.add_variable(builder.get_variable(a_idx) + builder.get_variable(b_idx));
+        builder.create_add_gate({ a_idx, b_idx, c_idx, 1, 1, -1, 0 });
+    };
+
+    for (size_t batch = 0; batch < 4; ++batch) {
+        add_batch(batch);
+        EXPECT_TRUE(checker.check().passed());
+    }
+
+    // Only the gates added since the previous check are checked, the bad one included
+    const size_t bad_row = builder.blocks.arithmetic.size();
+    builder.create_add_gate({ builder.add_variable(1), builder.add_variable(1), builder.zero_idx, 1, 1, 0, 0 });
+    add_batch(4);
+    auto result = checker.check();
+    ASSERT_EQ(result.failures.size(), 1);
+    EXPECT_EQ(result.failures[0].block, "arithmetic");
+    EXPECT_EQ(result.failures[0].row_idx, bad_row);
+
+    add_batch(5);
+    EXPECT_TRUE(checker.check().passed());
+
+    // The complete circuit fails only because of the bad gate
+    auto full_result = UltraCircuitChecker::check_all(builder);
+    ASSERT_EQ(full_result.failures.size(), 1);
+    EXPECT_EQ(full_result.failures[0], result.failures[0]);
+    EXPECT_TRUE(full_result.tag_check_passed);
+}
+
+} // namespace bb
@@ -1,4 +1,6 @@
 #include "ultra_circuit_checker.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/zip_view.hpp"
 #include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
 #include <barretenberg/plonk/proof_system/constants.hpp>
 #include <unordered_set>
@@ -21,6 +23,32 @@ template <typename Builder> bool UltraCircuitChecker::check(const Builder& build
     Builder builder{ builder_in };
     builder.finalize_circuit();
 
+    const CheckResult result = check_finalized(builder);
+
+    for (const auto& failure : result.failures) {
+        info("Failed ", failure.relation, " relation at row idx = ", failure.row_idx, " in block ", failure.block);
+#ifdef CHECK_CIRCUIT_STACKTRACES
+        builder.blocks.get()[failure.block_idx].stack_traces.print(failure.row_idx);
+#endif
+    }
+    if (!result.tag_check_passed) {
+        info("Failed tag check.");
+    }
+
+    return result.passed();
+};
+
+template <typename Builder> UltraCircuitChecker::CheckResult UltraCircuitChecker::check_all(const Builder& builder_in)
+{
+    // Create a copy of the input circuit and finalize it
+    Builder builder{ builder_in };
+    builder.finalize_circuit();
+
+    return check_finalized(builder);
+}
+
+template <typename Builder> UltraCircuitChecker::CheckResult UltraCircuitChecker::check_finalized(Builder& builder)
+{
     // Construct a hash table for lookup table entries to efficiently determine if a lookup gate is valid
     LookupHashTable lookup_hash_table;
     for (const auto& table : builder.lookup_tables) {
@@ -34,101 +62,87 @@ template <typename Builder> bool UltraCircuitChecker::check(const Builder& build
     TagCheckData tag_data;
     MemoryCheckData memory_data{ builder };
 
-    bool result = true;
+    CheckResult result;
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/870): Currently we check all relations for each block.
     // Once sorting is complete, is will be sufficient to check only the relevant relation(s) per block.
     size_t block_idx = 0;
     for (auto& block : builder.blocks.get()) {
-        result = result && check_block(builder, block, tag_data, memory_data, lookup_hash_table);
-        if (!result) {
-            info("Failed at block idx = ", block_idx);
-            return false;
-        }
+        check_block(builder, block, block_idx, 0, tag_data, memory_data, lookup_hash_table, result.failures);
         block_idx++;
     }
 
     // Tag check is only expected to pass after entire execution trace (all blocks) have been processed
-    result = result && check_tag_data(tag_data);
-    if (!result) {
-        info("Failed tag check.");
-        return false;
-    }
+    result.tag_check_passed = check_tag_data(tag_data);
 
     return result;
 };
 
 template <typename Builder>
-bool UltraCircuitChecker::check_block(Builder& builder,
+void UltraCircuitChecker::check_block(Builder& builder,
                                       auto& block,
+                                      size_t block_idx,
+                                      size_t start_row,
                                       TagCheckData& tag_data,
-                                      MemoryCheckData& memory_data,
-                                      LookupHashTable& lookup_hash_table)
+                                      const MemoryCheckData& memory_data,
+                                      const LookupHashTable& lookup_hash_table,
+                                      std::vector<Failure>& failures)
 {
-    // Initialize empty AllValues of the correct Flavor based on Builder type; for input to Relation::accumulate
-    auto values = init_empty_values<Builder>();
+    const std::string_view block_name = Builder::Arithmetization::TraceBlocks::labels[block_idx];
+    if (start_row >= block.size()) {
+        return;
+    }
+
     Params params;
     params.eta = memory_data.eta; // used in Auxiliary relation for RAM/ROM consistency
     params.eta_two = memory_data.eta_two;
     params.eta_three = memory_data.eta_three;
 
-    auto report_fail = [&](const char* message, size_t row_idx) {
-        info(message, row_idx);
-#ifdef CHECK_CIRCUIT_STACKTRACES
-        block.stack_traces.print(row_idx);
-#endif
-        return false;
+    struct ChunkData {
+        std::vector<Failure> failures;
+        TaggedVariables tagged_variables;
     };
+    std::vector<ChunkData> chunks(get_num_cpus());
 
-    // Perform checks on each gate defined in the builder
-    bool result = true;
-    for (size_t idx = 0; idx < block.size(); ++idx) {
-
-        populate_values(builder, block, values, tag_data, memory_data, idx);
+    // Rough cost of populating a row and evaluating all relations on it
+    constexpr size_t ROW_CHECK_COST = 200 * thread_heuristics::FF_MULTIPLICATION_COST;
 
-        result = result && check_relation<Arithmetic>(values, params);
-        if (!result) {
-            return report_fail("Failed Arithmetic relation at row idx = ", idx);
-        }
-        result = result && check_relation<Elliptic>(values, params);
-        if (!result) {
-            return report_fail("Failed Elliptic relation at row idx = ", idx);
-        }
-        result = result && check_relation<Auxiliary>(values, params);
-        if (!result) {
-            return report_fail("Failed Auxiliary relation at row idx = ", idx);
-        }
-        result = result && check_relation<DeltaRangeConstraint>(values, params);
-        if (!result) {
-            return report_fail("Failed DeltaRangeConstraint relation at row idx = ", idx);
-        }
-        result = result && check_lookup(values, lookup_hash_table);
-        if (!result) {
-            return report_fail("Failed Lookup check relation at row idx = ", idx);
-        }
-        result = result && check_relation<PoseidonInternal>(values, params);
-        if (!result) {
-            return report_fail("Failed PoseidonInternal relation at row idx = ", idx);
-        }
-        result = result && check_relation<PoseidonExternal>(values, params);
-        if (!result) {
-            return report_fail("Failed PoseidonExternal relation at row idx = ", idx);
-        }
+    // Perform checks on each gate defined in the builder
+    parallel_for_heuristic(
+        block.size() - start_row,
+        [&](size_t start, size_t end, size_t chunk_index) {
+            auto& chunk = chunks[chunk_index];
+            // Initialize empty AllValues of the correct Flavor based on Builder type; for input to Relation::accumulate
+            auto values = init_empty_values<Builder>();
+            for (size_t idx = start_row + start; idx < start_row + end; ++idx) {
+                populate_values(builder, block, values, chunk.tagged_variables, memory_data, idx);
 
-        if constexpr (IsMegaBuilder<Builder>) {
-            result = result && check_databus_read(values, builder);
-            if (!result) {
-                return report_fail("Failed databus read at row idx = ", idx);
+                auto record = [&](bool passed, std::string_view relation) {
+                    if (!passed) {
+                        chunk.failures.push_back({ block_name, block_idx, idx, relation });
+                    }
+                };
+                record(check_relation<Arithmetic>(values, params), "Arithmetic");
+                record(check_relation<Elliptic>(values, params), "Elliptic");
+                record(check_relation<Auxiliary>(values, params), "Auxiliary");
+                record(check_relation<DeltaRangeConstraint>(values, params), "DeltaRangeConstraint");
+                record(check_lookup(values, lookup_hash_table), "Lookup");
+                record(check_relation<PoseidonInternal>(values, params), "PoseidonInternal");
+                record(check_relation<PoseidonExternal>(values, params), "PoseidonExternal");
+                if constexpr (IsMegaBuilder<Builder>) {
+                    record(check_databus_read(values, builder), "DatabusRead");
+                }
             }
-        }
-        if (!result) {
-            return report_fail("Failed at row idx = ", idx);
-        }
-    }
+        },
+        ROW_CHECK_COST);
 
-    return result;
+    // Chunks cover increasing row ranges, so merging them in order preserves the row order
+    for (auto& chunk : chunks) {
+        failures.insert(failures.end(), chunk.failures.begin(), chunk.failures.end());
+        tag_data.accumulate(chunk.tagged_variables);
+    }
 };
 
-template <typename Relation> bool UltraCircuitChecker::check_relation(auto& values, auto& params)
+template <typename Relation> bool UltraCircuitChecker::check_relation(const auto& values, const auto& params)
 {
     // Define zero initialized array to store the evaluation of each sub-relation
     using SubrelationEvaluations = typename Relation::SumcheckArrayOfValuesOverSubrelations;
@@ -149,7 +163,7 @@ template <typename Relation> bool UltraCircuitChecker::check_relation(auto& valu
     return true;
 }
 
-bool UltraCircuitChecker::check_lookup(auto& values, auto& lookup_hash_table)
+bool UltraCircuitChecker::check_lookup(const auto& values, const LookupHashTable& lookup_hash_table)
 {
     // If this is a lookup gate, check the inputs are in the hash table containing all table entries
     if (!values.q_lookup.is_zero()) {
@@ -161,7 +175,7 @@ bool UltraCircuitChecker::check_lookup(auto& values, auto& lookup_hash_table)
     return true;
 };
 
-template <typename Builder> bool UltraCircuitChecker::check_databus_read(auto& values, Builder& builder)
+template <typename Builder> bool UltraCircuitChecker::check_databus_read(const auto& values, Builder& builder)
 {
     if (!values.q_busread.is_zero()) {
         // Extract the {index, value} pair from the read gate inputs
@@ -177,15 +191,15 @@ template <typename Builder> bool UltraCircuitChecker::check_databus_read(auto& v
         // Check that the claimed value is present in the calldata/return data at the corresponding index
         FF bus_value;
         if (is_calldata_read) {
-            auto calldata = builder.get_calldata();
+            const auto& calldata = builder.get_calldata();
             bus_value = builder.get_variable(calldata[raw_read_idx]);
         }
         if (is_secondary_calldata_read) {
-            auto secondary_calldata = builder.get_secondary_calldata();
+            const auto& secondary_calldata = builder.get_secondary_calldata();
             bus_value = builder.get_variable(secondary_calldata[raw_read_idx]);
         }
         if (is_return_data_read) {
-            auto return_data = builder.get_return_data();
+            const auto& return_data = builder.get_return_data();
             bus_value = builder.get_variable(return_data[raw_read_idx]);
         }
         return (value == bus_value);
@@ -199,28 +213,31 @@ bool UltraCircuitChecker::check_tag_data(const TagCheckData& tag_data)
 };
 
 template <typename Builder>
-void UltraCircuitChecker::populate_values(
-    Builder& builder, auto& block, auto& values, TagCheckData& tag_data, MemoryCheckData& memory_data, size_t idx)
+void UltraCircuitChecker::populate_values(Builder& builder,
+                                          auto& block,
+                                          auto& values,
+                                          TaggedVariables& tagged_variables,
+                                          const MemoryCheckData& memory_data,
+                                          size_t idx)
 {
-    // Function to quickly update tag products and encountered variable set by index and value
+    // Function to quickly record a tagged variable by index and value, if not already encountered
     auto update_tag_check_data = [&](const size_t variable_index, const FF& value) {
         size_t real_index = builder.real_variable_index[variable_index];
         // Check to ensure that we are not including a variable twice
-        if (tag_data.encountered_variables.contains(real_index)) {
+        if (tagged_variables.encountered_variables.contains(real_index)) {
             return;
         }
         uint32_t tag_in = builder.real_variable_tags[real_index];
         if (tag_in != DUMMY_TAG) {
             uint32_t tag_out = builder.tau.at(tag_in);
-            tag_data.left_product *= value + tag_data.gamma * FF(tag_in);
-            tag_data.right_product *= value + tag_data.gamma * FF(tag_out);
-            tag_data.encountered_variables.insert(real_index);
+            tagged_variables.variables.push_back({ real_index, tag_in, tag_out, value });
+            tagged_variables.encountered_variables.insert(real_index);
         }
     };
 
     // A lambda function for computing a memory record term of the form w3 * eta_three + w2 * eta_two + w1 * eta
     auto compute_memory_record_term =
-        [](const FF& w_1, const FF& w_2, const FF& w_3, const FF& eta, const FF& eta_two, FF& eta_three) {
+        [](const FF& w_1, const FF& w_2, const FF& w_3, const FF& eta, const FF& eta_two, const FF& eta_three) {
             return (w_3 * eta_three + w_2 * eta_two + w_1 * eta);
         };
 
@@ -297,8 +314,84 @@ void UltraCircuitChecker::populate_values(
     }
 }
 
+template <typename Builder>
+UltraCircuitChecker::IncrementalChecker<Builder>::IncrementalChecker(Builder& builder)
+    : builder(builder)
+    , checked_block_sizes(builder.blocks.get().size(), 0)
+    , memory_data(builder)
+{}
+
+template <typename Builder> UltraCircuitChecker::CheckResult UltraCircuitChecker::IncrementalChecker<Builder>::check()
+{
+    update_lookup_tables();
+    update_memory_records();
+
+    // Tags can only be checked on the complete circuit; the tag data gathered here is discarded
+    TagCheckData tag_data;
+    CheckResult result;
+    size_t block_idx = 0;
+    for (auto& block : builder.blocks.get()) {
+        size_t& checked_size = checked_block_sizes[block_idx];
+        if (block.size() != checked_size) {
+            // Re-check the previous last row now that its shifted values are known
+            const size_t start_row = checked_size > 0 ? checked_size - 1 : 0;
+            check_block(
+                builder, block, block_idx, start_row, tag_data, memory_data, lookup_hash_table, result.failures);
+            checked_size = block.size();
+        }
+        block_idx++;
+    }
+    return result;
+}
+
+template <typename Builder> void UltraCircuitChecker::IncrementalChecker<Builder>::update_lookup_tables()
+{
+    // Tables are created in full on first use and only ever appended to the builder
+    for (; num_hashed_tables < builder.lookup_tables.size(); ++num_hashed_tables) {
+        const auto& table = builder.lookup_tables[num_hashed_tables];
+        const FF table_index(table.table_index);
+        for (size_t i = 0; i < table.size(); ++i) {
+            lookup_hash_table.insert({ table.column_1[i], table.column_2[i], table.column_3[i], table_index });
+        }
+    }
+}
+
+template <typename Builder> void UltraCircuitChecker::IncrementalChecker<Builder>::update_memory_records()
+{
+    // Before finalization, the gates containing memory records are only known from the RAM/ROM transcripts
+    num_rom_records.resize(builder.rom_arrays.size(), 0);
+    for (auto [rom_array, num_records] : zip_view(builder.rom_arrays, num_rom_records)) {
+        for (; num_records < rom_array.records.size(); ++num_records) {
+            memory_data.read_record_gates.insert(rom_array.records[num_records].gate_index);
+        }
+    }
+    num_ram_records.resize(builder.ram_arrays.size(), 0);
+    for (auto [ram_array, num_records] : zip_view(builder.ram_arrays, num_ram_records)) {
+        for (; num_records < ram_array.records.size(); ++num_records) {
+            const auto& record = ram_array.records[num_records];
+            if (record.access_type == Builder::RamRecord::AccessType::READ) {
+                memory_data.read_record_gates.insert(record.gate_index);
+            } else {
+                memory_data.write_record_gates.insert(record.gate_index);
+            }
+        }
+    }
+    for (; num_memory_read_records < builder.memory_read_records.size(); ++num_memory_read_records) {
+        memory_data.read_record_gates.insert(builder.memory_read_records[num_memory_read_records]);
+    }
+    for (; num_memory_write_records < builder.memory_write_records.size(); ++num_memory_write_records) {
+        memory_data.write_record_gates.insert(builder.memory_write_records[num_memory_write_records]);
+    }
+}
+
 // Template method instantiations for each check method
 template bool UltraCircuitChecker::check<UltraCircuitBuilder_<UltraArith<bb::fr>>>(
     const UltraCircuitBuilder_<UltraArith<bb::fr>>& builder_in);
 template bool UltraCircuitChecker::check<MegaCircuitBuilder_<bb::fr>>(const MegaCircuitBuilder_<bb::fr>& builder_in);
+template UltraCircuitChecker::CheckResult UltraCircuitChecker::check_all<UltraCircuitBuilder_<UltraArith<bb::fr>>>(
+    const UltraCircuitBuilder_<UltraArith<bb::fr>>& builder_in);
+template UltraCircuitChecker::CheckResult UltraCircuitChecker::check_all<MegaCircuitBuilder_<bb::fr>>(
+    const MegaCircuitBuilder_<bb::fr>& builder_in);
+template class UltraCircuitChecker::IncrementalChecker<UltraCircuitBuilder_<UltraArith<bb::fr>>>;
+template class UltraCircuitChecker::IncrementalChecker<MegaCircuitBuilder_<bb::fr>>;
 } // namespace bb
@@ -12,6 +12,8 @@
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 
 #include <optional>
+#include <string_view>
+#include <vector>
 
 namespace bb {
 
@@ -26,6 +28,28 @@ class UltraCircuitChecker {
     using PoseidonInternal = Poseidon2InternalRelation<FF>;
     using Params = RelationParameters<FF>;
 
+    /**
+     * @brief A gate of the circuit that does not satisfy one of the relations (or lookup/databus checks)
+     */
+    struct Failure {
+        std::string_view block; // name of the execution trace block containing the gate
+        size_t block_idx;       // index of the block in builder.blocks.get()
+        size_t row_idx;         // index of the gate within its block
+        std::string_view relation;
+
+        bool operator==(const Failure& other) const = default;
+    };
+
+    /**
+     * @brief Result of a check listing every failing gate/relation pair, in trace order
+     */
+    struct CheckResult {
+        std::vector<Failure> failures;
+        bool tag_check_passed = true;
+
+        bool passed() const { return failures.empty() && tag_check_passed; }
+    };
+
     /**
      * @brief Check the correctness of a circuit witness
      * @details Ensures that all relations for a given Ultra arithmetization are satisfied by the witness for each gate
@@ -40,29 +64,54 @@ class UltraCircuitChecker {
      */
     template <typename Builder> static bool check(const Builder& builder);
 
+    /**
+     * @brief Same as check but does not stop at the first failure: the rows of each block are checked in parallel and
+     * every failing gate/relation is returned
+     *
+     * @tparam Builder
+     * @param builder
+     */
+    template <typename Builder> static CheckResult check_all(const Builder& builder);
+
   private:
     struct TagCheckData;           // Container for data pertaining to generalized permutation tag check
+    struct TaggedVariables;        // Tagged variables encountered within a chunk of rows
     struct MemoryCheckData;        // Container for data pertaining to RAM/RAM record check
     using Key = std::array<FF, 4>; // Key type for lookup table hash table
     struct HashFunction;           // Custom hash function for lookup table hash table
     using LookupHashTable = std::unordered_set<Key, HashFunction>;
 
     /**
-     * @brief Checks that the provided witness satisfies all gates contained in a single execution trace block
+     * @brief Check all relations on a finalized copy of the circuit
+     */
+    template <typename Builder> static CheckResult check_finalized(Builder& builder);
+
+    /**
+     * @brief Checks that the provided witness satisfies all gates contained in a single execution trace block, starting
+     * from a given row
+     * @details Rows are checked in parallel chunks. The failures of each chunk are appended to the result in row order
+     * and the tagged variables encountered by each chunk are folded into the tag check data in row order, so that the
+     * outcome is the same as that of a sequential pass.
      *
      * @tparam Builder
      * @param builder
      * @param block
+     * @param block_idx
+     * @param start_row First row to check
      * @param tag_data
      * @param memory_data
      * @param lookup_hash_table
+     * @param failures Failures found in the block are appended to this
      */
     template <typename Builder>
-    static bool check_block(Builder& builder,
+    static void check_block(Builder& builder,
                             auto& block,
+                            size_t block_idx,
+                            size_t start_row,
                             TagCheckData& tag_data,
-                            MemoryCheckData& memory_data,
-                            LookupHashTable& lookup_hash_table);
+                            const MemoryCheckData& memory_data,
+                            const LookupHashTable& lookup_hash_table,
+                            std::vector<Failure>& failures);
 
     /**
      * @brief Check that a given relation is satisfied for the provided inputs corresponding to a single row
@@ -73,7 +122,7 @@ class UltraCircuitChecker {
      * @param values Values of the relation inputs at a single row
      * @param params
      */
-    template <typename Relation> static bool check_relation(auto& values, auto& params);
+    template <typename Relation> static bool check_relation(const auto& values, const auto& params);
 
     /**
      * @brief Check whether the values in a lookup gate are contained within a corresponding hash table
@@ -81,7 +130,7 @@ class UltraCircuitChecker {
      * @param values Inputs to a lookup gate
      * @param lookup_hash_table Preconstructed hash table representing entries of all tables in circuit
      */
-    static bool check_lookup(auto& values, auto& lookup_hash_table);
+    static bool check_lookup(const auto& values, const LookupHashTable& lookup_hash_table);
 
     /**
      * @brief Check that the {index, value} pair contained in a databus read gate reflects the actual value present in
@@ -89,7 +138,7 @@ class UltraCircuitChecker {
      *
      * @param values Inputs to a databus read gate
      */
-    template <typename Builder> static bool check_databus_read(auto& values, Builder& builder);
+    template <typename Builder> static bool check_databus_read(const auto& values, Builder& builder);
 
     /**
      * @brief Check whether the left and right running tag products are equal
@@ -111,18 +160,41 @@ class UltraCircuitChecker {
 
     /**
      * @brief Populate the values required to check the correctness of a single "row" of the circuit
-     * @details Populates all wire values (plus shifts) and selectors. Updates running tag product information.
+     * @details Populates all wire values (plus shifts) and selectors. Records the tagged variables encountered.
      * Populates 4th wire with memory records (as needed).
      *
      * @tparam Builder
      * @param builder
      * @param values
-     * @param tag_data
+     * @param tagged_variables
+     * @param memory_data
      * @param idx
      */
     template <typename Builder>
-    static void populate_values(
-        Builder& builder, auto& block, auto& values, TagCheckData& tag_data, MemoryCheckData& memory_data, size_t idx);
+    static void populate_values(Builder& builder,
+                                auto& block,
+                                auto& values,
+                                TaggedVariables& tagged_variables,
+                                const MemoryCheckData& memory_data,
+                                size_t idx);
+
+    /**
+     * @brief A variable carrying a (non-dummy) tag, as encountered on some row
+     */
+    struct TaggedVariable {
+        size_t real_index;
+        uint32_t tag_in;
+        uint32_t tag_out;
+        FF value;
+    };
+
+    /**
+     * @brief The tagged variables first encountered within a chunk of rows, in row order
+     */
+    struct TaggedVariables {
+        std::vector<TaggedVariable> variables;
+        std::unordered_set<size_t> encountered_variables;
+    };
 
     /**
      * @brief Struct for managing the running tag product data for ensuring tag correctness
@@ -134,6 +206,17 @@ class UltraCircuitChecker {
 
         // We need to include each variable only once
         std::unordered_set<size_t> encountered_variables;
+
+        // Include the variables encountered by a chunk of rows that were not already encountered by an earlier one
+        void accumulate(const TaggedVariables& tagged_variables)
+        {
+            for (const auto& variable : tagged_variables.variables) {
+                if (encountered_variables.insert(variable.real_index).second) {
+                    left_product *= variable.value + gamma * FF(variable.tag_in);
+                    right_product *= variable.value + gamma * FF(variable.tag_out);
+                }
+            }
+        }
     };
 
     /**
@@ -171,6 +254,46 @@ class UltraCircuitChecker {
             return static_cast<size_t>(result.reduce_once().data[0]);
         }
     };
+
+  public:
+    /**
+     * @brief Checker that only checks the gates added to a builder since its previous check
+     * @details Meant for checking a circuit cheaply after each batch of constraints while it is being built (e.g. in
+     * fuzzers and acir_format tests). The builder is not finalized, so each check covers the gates present so far, with
+     * RAM/ROM read/write gates checked against their memory records. The last row of each block was checked against a
+     * zero shift, so it is checked again once rows have been appended to the block (and a failure on it may be reported
+     * twice).
+     * @note Tag correctness and the gates only added at finalization (range lists, RAM/ROM consistency checks and
+     * cached non-native field multiplications) are only covered by a full check of the completed circuit.
+     *
+     * @tparam Builder
+     */
+    template <typename Builder> class IncrementalChecker;
+};
+
+template <typename Builder> class UltraCircuitChecker::IncrementalChecker {
+  public:
+    explicit IncrementalChecker(Builder& builder);
+
+    /**
+     * @brief Check the gates added since the previous call (all gates on the first call)
+     */
+    CheckResult check();
+
+  private:
+    void update_lookup_tables();
+    void update_memory_records();
+
+    Builder& builder;
+    std::vector<size_t> checked_block_sizes;
+    LookupHashTable lookup_hash_table;
+    size_t num_hashed_tables = 0;
+    MemoryCheckData memory_data;
+    // Number of records of each RAM/ROM array (and of the builder's memory record lists) already accounted for
+    std::vector<size_t> num_rom_records;
+    std::vector<size_t> num_ram_records;
+    size_t num_memory_read_records = 0;
+    size_t num_memory_write_records = 0;
 };
 
 } // namespace bb
@@ -1,6 +1,7 @@
 
 #include "gemini.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
 
 #include <bit>
 #include <memory>
@@ -57,10 +58,7 @@ std::vector<typename GeminiProver_<Curve>::Polynomial> GeminiProver_<Curve>::com
     std::span<const Fr> mle_opening_point, Polynomial&& batched_unshifted, Polynomial&& batched_to_be_shifted)
 {
     const size_t num_variables = mle_opening_point.size(); // m
-
-    const size_t num_threads = get_num_cpus_pow2();
-    constexpr size_t efficient_operations_per_thread = 64; // A guess of the number of operation for which there
-                                                           // would be a point in sending them to a separate thread
+    const size_t n = size_t(1) << num_variables;
 
     // Allocate space for m+1 Fold polynomials
     //
@@ -71,56 +69,70 @@ std::vector<typename GeminiProver_<Curve>::Polynomial> GeminiProver_<Curve>::com
     gemini_polynomials.reserve(num_variables + 1);
 
     // F(X) = ∑ⱼ ρʲ fⱼ(X) and G(X) = ∑ⱼ ρᵏ⁺ʲ gⱼ(X)
-    Polynomial& batched_F = gemini_polynomials.emplace_back(std::move(batched_unshifted));
-    Polynomial& batched_G = gemini_polynomials.emplace_back(std::move(batched_to_be_shifted));
+    const Polynomial& batched_F = gemini_polynomials.emplace_back(std::move(batched_unshifted));
+    const Polynomial& batched_G = gemini_polynomials.emplace_back(std::move(batched_to_be_shifted));
     constexpr size_t offset_to_folded = 2; // Offset because of F an G
-    // A₀(X) = F(X) + G↺(X) = F(X) + G(X)/X.
-    Polynomial A_0 = batched_F;
-    A_0 += batched_G.shifted();
 
-    // Allocate everything before parallel computation
+    // Allocate the folds up front, every coefficient is written below
     for (size_t l = 0; l < num_variables - 1; ++l) {
         // size of the previous polynomial/2
-        const size_t n_l = 1 << (num_variables - l - 1);
+        const size_t n_l = size_t(1) << (num_variables - l - 1);
 
         // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-        gemini_polynomials.emplace_back(Polynomial(n_l));
+        gemini_polynomials.emplace_back(Polynomial(n_l, n_l, Polynomial::DontZeroMemory::FLAG));
     }
 
-    // A_l = Aₗ(X) is the polynomial being folded
-    // in the first iteration, we take the batched polynomial
-    // in the next iteration, it is the previously folded one
-    auto A_l = A_0.data();
-    for (size_t l = 0; l < num_variables - 1; ++l) {
-        // size of the previous polynomial/2
-        const size_t n_l = 1 << (num_variables - l - 1);
-
-        // Use as many threads as it is useful so that 1 thread doesn't process 1 element, but make sure that there is
-        // at least 1
-        size_t num_used_threads = std::min(n_l / efficient_operations_per_thread, num_threads);
-        num_used_threads = num_used_threads ? num_used_threads : 1;
-        size_t chunk_size = n_l / num_used_threads;
-        size_t last_chunk_size = (n_l % chunk_size) ? (n_l % num_used_threads) : chunk_size;
-
-        // Openning point is the same for all
-        const Fr u_l = mle_opening_point[l];
-
-        // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-        auto A_l_fold = gemini_polynomials[l + offset_to_folded].data();
-
-        parallel_for(num_used_threads, [&](size_t i) {
-            size_t current_chunk_size = (i == (num_used_threads - 1)) ? last_chunk_size : chunk_size;
-            for (std::ptrdiff_t j = (std::ptrdiff_t)(i * chunk_size);
-                 j < (std::ptrdiff_t)((i * chunk_size) + current_chunk_size);
-                 j++) {
-                // fold(Aₗ)[j] = (1-uₗ)⋅even(Aₗ)[j] + uₗ⋅odd(Aₗ)[j]
-                //            = (1-uₗ)⋅Aₗ[2j]      + uₗ⋅Aₗ[2j+1]
-                //            = Aₗ₊₁[j]
+    // A₀(X) = F(X) + G↺(X) = F(X) + G(X)/X is never materialized, its coefficients are read directly from F and G.
+    // The backing memory of G holds a zero past its end, which is the last coefficient of its shift.
+    const Fr* F = batched_F.data();
+    const Fr* G = batched_G.data();
+    const size_t G_size = batched_G.size();
+    auto A_0 = [&](size_t i) { return i < G_size ? F[i] + G[i + 1] : F[i]; };
+
+    // fold(Aₗ)[j] = (1-uₗ)⋅even(Aₗ)[j] + uₗ⋅odd(Aₗ)[j]
+    //            = (1-uₗ)⋅Aₗ[2j]      + uₗ⋅Aₗ[2j+1]
+    //            = Aₗ₊₁[j]
+    // Since Aₗ₊₁[j] only depends on Aₗ[2j] and Aₗ[2j+1], a contiguous block of Aₗ folds into a contiguous block of Aₗ₊₁
+    // of half the size. We therefore split A₀ into one block per thread and let each thread fold its block through as
+    // many levels as it can on its own: all folds are computed in a single parallel pass (rather than one parallel pass
+    // per fold), without synchronization, and with each thread working on data it has just written.
+    constexpr size_t efficient_operations_per_thread = 64; // A guess of the number of operation for which there
+                                                           // would be a point in sending them to a separate thread
+    size_t num_blocks = get_num_cpus_pow2();
+    while (num_blocks > 1 && n / num_blocks < 2 * efficient_operations_per_thread) {
+        num_blocks /= 2;
+    }
+    const size_t log_num_blocks = numeric::get_msb(num_blocks);
+    // Folds Aₗ₊₁ for l < num_block_levels have at least one coefficient per block
+    const size_t num_block_levels = std::min(num_variables - 1, num_variables - log_num_blocks);
+
+    auto fold_range = [&](size_t level, size_t start, size_t end) {
+        const Fr u_l = mle_opening_point[level];
+        Fr* A_l_fold = gemini_polynomials[level + offset_to_folded].data();
+        if (level == 0) {
+            for (size_t j = start; j < end; ++j) {
+                const Fr even = A_0(j << 1);
+                A_l_fold[j] = even + u_l * (A_0((j << 1) + 1) - even);
+            }
+        } else {
+            const Fr* A_l = gemini_polynomials[level - 1 + offset_to_folded].data();
+            for (size_t j = start; j < end; ++j) {
                 A_l_fold[j] = A_l[j << 1] + u_l * (A_l[(j << 1) + 1] - A_l[j << 1]);
             }
-        });
-        // set Aₗ₊₁ = Aₗ for the next iteration
-        A_l = A_l_fold;
+        }
+    };
+
+    parallel_for(num_blocks, [&](size_t block_idx) {
+        for (size_t l = 0; l < num_block_levels; ++l) {
+            // Size of the block of Aₗ₊₁ owned by this thread
+            const size_t block_size = (n >> (l + 1)) / num_blocks;
+            fold_range(l, block_idx * block_size, (block_idx + 1) * block_size);
+        }
+    });
+
+    // The last few folds have fewer coefficients than there are blocks
+    for (size_t l = num_block_levels; l < num_variables - 1; ++l) {
+        fold_range(l, 0, n >> (l + 1));
     }
 
     return gemini_polynomials;
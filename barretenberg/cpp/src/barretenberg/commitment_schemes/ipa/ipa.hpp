@@ -8,6 +8,7 @@
 #include "barretenberg/transcript/transcript.hpp"
 #include <cstddef>
 #include <numeric>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -93,6 +94,124 @@ template <typename Curve_> class IPA {
 #ifdef IPA_FUZZ_TEST
    friend class ProxyCaller;
 #endif
+
+    // Rounds with at most this many generators per half compute their commitments with small_msm instead of
+    // pippenger, and fold the generators point by point so that the fold overlaps with the next round's commitments
+    static constexpr size_t SMALL_MSM_THRESHOLD = 1 << 6;
+
+    /**
+     * @brief Normalize a batch of projective points (with a single inversion) and write them out in affine form
+     */
+    static void batch_to_affine(std::span<GroupElement> elements, std::span<Commitment> result)
+    {
+        GroupElement::batch_normalize(elements.data(), elements.size());
+        for (size_t i = 0; i < elements.size(); i++) {
+            result[i] = elements[i].is_point_at_infinity() ? Commitment::infinity()
+                                                           : Commitment(elements[i].x, elements[i].y);
+        }
+    }
+
+    /**
+     * @brief Serially compute the MSM of a handful of points, where pippenger's bucket setup would cost more than the
+     * MSM itself (the last rounds of the prover, the proof elements in batch verification)
+     *
+     * @details Straus' method with signed 4-bit windows: every point gets a table of its multiples 1..8 and the scalars
+     * are recoded into digits in [-8, 8), so that each window costs 4 doublings plus one mixed addition per point.
+     * The additions are complete, so the points need not be distinct.
+     */
+    static GroupElement small_msm(std::span<const Fr> scalars, std::span<const Commitment> points)
+    {
+        constexpr size_t WINDOW_BITS = 4;
+        constexpr size_t NUM_WINDOWS = 256 / WINDOW_BITS;
+        constexpr size_t TABLE_SIZE = 1 << (WINDOW_BITS - 1);
+        constexpr int WINDOW_RANGE = 1 << WINDOW_BITS;
+
+        std::vector<size_t> indices;
+        indices.reserve(points.size());
+        for (size_t i = 0; i < points.size(); i++) {
+            if (!points[i].is_point_at_infinity() && !scalars[i].is_zero()) {
+                indices.emplace_back(i);
+            }
+        }
+        const size_t num_points = indices.size();
+
+        // Tables of multiples [1]P..[8]P
+        std::vector<GroupElement> multiples(num_points * TABLE_SIZE);
+        for (size_t i = 0; i < num_points; i++) {
+            const Commitment& point = points[indices[i]];
+            multiples[i * TABLE_SIZE] = point;
+            for (size_t k = 1; k < TABLE_SIZE; k++) {
+                multiples[i * TABLE_SIZE + k] = multiples[i * TABLE_SIZE + k - 1] + point;
+            }
+        }
+        std::vector<Commitment> table(num_points * TABLE_SIZE);
+        batch_to_affine(multiples, table);
+
+        // Signed digits, least significant window first
+        std::vector<int8_t> digits(num_points * NUM_WINDOWS);
+        for (size_t i = 0; i < num_points; i++) {
+            const uint256_t scalar(scalars[indices[i]]);
+            int carry = 0;
+            for (size_t w = 0; w < NUM_WINDOWS; w++) {
+                int digit = static_cast<int>(scalar.slice(w * WINDOW_BITS, (w + 1) * WINDOW_BITS).data[0]) + carry;
+                carry = digit >= WINDOW_RANGE / 2 ? 1 : 0;
+                digits[i * NUM_WINDOWS + w] = static_cast<int8_t>(digit - carry * WINDOW_RANGE);
+            }
+        }
+
+        GroupElement result = GroupElement::infinity();
+        for (size_t w = NUM_WINDOWS - 1; w < NUM_WINDOWS; w--) {
+            for (size_t k = 0; k < WINDOW_BITS; k++) {
+                result.self_dbl();
+            }
+            for (size_t i = 0; i < num_points; i++) {
+                const int digit = digits[i * NUM_WINDOWS + w];
+                if (digit > 0) {
+                    result += table[i * TABLE_SIZE + static_cast<size_t>(digit - 1)];
+                } else if (digit < 0) {
+                    result -= table[i * TABLE_SIZE + static_cast<size_t>(-digit - 1)];
+                }
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Serially fold generators: G_lo[j] <- G_lo[j] + challenge * G_hi[j]
+     */
+    static void fold_generators(std::span<Commitment> G_lo, std::span<const Commitment> G_hi, const Fr& challenge)
+    {
+        std::vector<GroupElement> folded(G_lo.size());
+        for (size_t j = 0; j < G_lo.size(); j++) {
+            folded[j] = GroupElement(G_hi[j]) * challenge + G_lo[j];
+        }
+        batch_to_affine(folded, G_lo);
+    }
+
+    /**
+     * @brief Compute the vector \f$\vec{s}\f$ whose i-th entry is the product of the inverse round challenges selected by
+     * the bits of i, as a tree of products in linear time
+     *
+     * @param round_challenges_inv Inverses of the round challenges in the order they were received
+     */
+    static std::vector<Fr> compute_s_vec(const std::vector<Fr>& round_challenges_inv, size_t poly_length)
+    {
+        const size_t log_poly_degree = round_challenges_inv.size();
+        std::vector<Fr> s_vec(poly_length);
+        s_vec[0] = Fr::one();
+        // After step j, the first 2^{j+1} entries are final: the upper half of them is the lower half times the
+        // challenge that bit j selects
+        for (size_t j = 0; j < log_poly_degree; j++) {
+            const size_t half = size_t(1) << j;
+            const Fr& challenge = round_challenges_inv[log_poly_degree - 1 - j];
+            parallel_for_heuristic(
+                half,
+                [&](size_t i) {
+                    s_vec[half + i] = s_vec[i] * challenge;
+                }, thread_heuristics::FF_MULTIPLICATION_COST);
+        }
+        return s_vec;
+    }
    /**
     * @brief Compute an inner product argument proof for opening a single polynomial at a single evaluation point.
     *
@@ -191,38 +310,57 @@ template <typename Curve_> class IPA {
         // Iterate for log(poly_degree) rounds to compute the round commitments.
         auto log_poly_degree = static_cast<size_t>(numeric::get_msb(poly_length));
 
-        // Allocate space for L_i and R_i elements
-        GroupElement L_i;
-        GroupElement R_i;
-        std::size_t round_size = poly_length;
+        // The generators are folded in place in G_vec_local. The rounds that use pippenger read the generators from
+        // a pippenger point table: the SRS itself in the first round, then a single table buffer that is refreshed
+        // after each fold, so that no MSM has to allocate and build its own.
+        std::vector<Commitment> G_table(poly_length / 2 > SMALL_MSM_THRESHOLD ? poly_length : 0);
+        Commitment* G_table_ptr = srs_elements;
+
+        // Scalar products < a_vec_lo, b_vec_hi > and < a_vec_hi, b_vec_lo > of the first round, the following ones
+        // are computed while folding a_vec and b_vec
+        std::size_t round_size = poly_length / 2;
+        auto [inner_prod_L, inner_prod_R] = sum_pairs(parallel_for_heuristic(
+            round_size,
+            std::pair{Fr::zero(), Fr::zero()},
+            [&](size_t j, std::pair<Fr, Fr>& inner_prod_left_right) {
+                inner_prod_left_right.first += a_vec[j] * b_vec[round_size + j];
+                inner_prod_left_right.second += a_vec[round_size + j] * b_vec[j];
+            }, thread_heuristics::FF_ADDITION_COST * 2 + thread_heuristics::FF_MULTIPLICATION_COST * 2));
+
+        // < a_vec_lo, G_vec_hi > and < a_vec_hi, G_vec_lo >, computed ahead of their round when the folding of the
+        // previous round can overlap with them
+        GroupElement L_msm;
+        GroupElement R_msm;
+        bool round_msms_computed = false;
 
         // Step 6.
         // Perform IPA reduction rounds
         for (size_t i = 0; i < log_poly_degree; i++) {
-            round_size /= 2;
-            // Run scalar products in parallel
-            auto inner_prods = parallel_for_heuristic(
-                round_size,
-                std::pair{Fr::zero(), Fr::zero()},
-                [&](size_t j, std::pair<Fr, Fr>& inner_prod_left_right) {
-                    // Compute inner_prod_L := < a_vec_lo, b_vec_hi >
-                    inner_prod_left_right.first += a_vec[j] * b_vec[round_size + j];
-                    // Compute inner_prod_R := < a_vec_hi, b_vec_lo >
-                    inner_prod_left_right.second += a_vec[round_size + j] * b_vec[j];
-                }, thread_heuristics::FF_ADDITION_COST * 2 + thread_heuristics::FF_MULTIPLICATION_COST * 2);
-            // Sum inner product contributions computed in parallel and unpack the std::pair
-            auto [inner_prod_L, inner_prod_R] = sum_pairs(inner_prods);
+            if (!round_msms_computed) {
+                if (round_size > SMALL_MSM_THRESHOLD) {
+                    L_msm = bb::scalar_multiplication::pippenger<Curve>(
+                        &a_vec[0], &G_table_ptr[round_size * 2], round_size, ck->pippenger_runtime_state, false);
+                    R_msm = bb::scalar_multiplication::pippenger<Curve>(
+                        &a_vec[round_size], &G_table_ptr[0], round_size, ck->pippenger_runtime_state, false);
+                } else {
+                    parallel_for(2, [&](size_t task) {
+                        if (task == 0) {
+                            L_msm = small_msm(std::span{ &a_vec[0], round_size },
+                                              std::span{ &G_vec_local[round_size], round_size });
+                        } else {
+                            R_msm = small_msm(std::span{ &a_vec[round_size], round_size },
+                                              std::span{ &G_vec_local[0], round_size });
+                        }
+                    });
+                }
+            }
             // Step 6.a (using letters, because doxygen automaticall converts the sublist counters to letters :( )
             // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
-            L_i = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                &a_vec[0], &G_vec_local[round_size], round_size, ck->pippenger_runtime_state);
-            L_i += aux_generator * inner_prod_L;
+            GroupElement L_i = L_msm + aux_generator * inner_prod_L;
 
             // Step 6.b
             // R_i = < a_vec_hi, G_vec_lo > + inner_prod_R * aux_generator
-            R_i = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                &a_vec[round_size], &G_vec_local[0], round_size, ck->pippenger_runtime_state);
-            R_i += aux_generator * inner_prod_R;
+            GroupElement R_i = R_msm + aux_generator * inner_prod_R;
 
             // Step 6.c
             // Send commitments to the verifier
@@ -239,27 +377,69 @@ template <typename Curve_> class IPA {
             }
             const Fr round_challenge_inv = round_challenge.invert();
 
-            // Step 6.e
-            // G_vec_new = G_vec_lo + G_vec_hi * round_challenge_inv
-            auto G_hi_by_inverse_challenge = GroupElement::batch_mul_with_endomorphism(
-                std::span{ G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size),
-                           G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size * 2) },
-                round_challenge_inv);
-            GroupElement::batch_affine_add(
-                std::span{ G_vec_local.begin(), G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size) },
-                G_hi_by_inverse_challenge,
-                G_vec_local);
+            // In the last round only a_0 is needed
+            if (round_size == 1) {
+                a_vec[0] += round_challenge * a_vec[1];
+                break;
+            }
+            const size_t next_round_size = round_size / 2;
 
             // Steps 6.e and 6.f
             // Update the vectors a_vec, b_vec.
             // a_vec_new = a_vec_lo + a_vec_hi * round_challenge
             // b_vec_new = b_vec_lo + b_vec_hi * round_challenge_inv
-            parallel_for_heuristic(
-                round_size,
-                [&](size_t j) {
+            // Each iteration folds the pair of coefficients j, j + next_round_size, which contributes to both scalar
+            // products of the next round
+            std::tie(inner_prod_L, inner_prod_R) = sum_pairs(parallel_for_heuristic(
+                next_round_size,
+                std::pair{Fr::zero(), Fr::zero()},
+                [&](size_t j, std::pair<Fr, Fr>& inner_prod_left_right) {
+                    const size_t k = j + next_round_size;
                     a_vec[j] += round_challenge * a_vec[round_size + j];
+                    a_vec[k] += round_challenge * a_vec[round_size + k];
                     b_vec[j] += round_challenge_inv * b_vec[round_size + j];
-                }, thread_heuristics::FF_ADDITION_COST * 2 + thread_heuristics::FF_MULTIPLICATION_COST * 2);
+                    b_vec[k] += round_challenge_inv * b_vec[round_size + k];
+                    inner_prod_left_right.first += a_vec[j] * b_vec[k];
+                    inner_prod_left_right.second += a_vec[k] * b_vec[j];
+                }, thread_heuristics::FF_ADDITION_COST * 6 + thread_heuristics::FF_MULTIPLICATION_COST * 6));
+
+            // Step 6.e
+            // G_vec_new = G_vec_lo + G_vec_hi * round_challenge_inv
+            if (round_size > SMALL_MSM_THRESHOLD) {
+                auto G_hi_by_inverse_challenge = GroupElement::batch_mul_with_endomorphism(
+                    std::span{ G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size),
+                               G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size * 2) },
+                    round_challenge_inv);
+                GroupElement::batch_affine_add(
+                    std::span{ G_vec_local.begin(), G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size) },
+                    G_hi_by_inverse_challenge,
+                    G_vec_local);
+                if (next_round_size > SMALL_MSM_THRESHOLD) {
+                    bb::scalar_multiplication::generate_pippenger_point_table<Curve>(
+                        G_vec_local.data(), G_table.data(), round_size);
+                    G_table_ptr = G_table.data();
+                }
+                round_msms_computed = false;
+            } else {
+                // Few generators are left: one task folds the upper half of them and commits to it for L, the other
+                // folds the lower half and commits to it for R, so that the MSMs of the next round overlap with this
+                // fold instead of waiting for all of it
+                parallel_for(2, [&](size_t task) {
+                    const size_t start = task == 0 ? next_round_size : 0;
+                    fold_generators(std::span{ &G_vec_local[start], next_round_size },
+                                    std::span{ &G_vec_local[round_size + start], next_round_size },
+                                    round_challenge_inv);
+                    if (task == 0) {
+                        L_msm = small_msm(std::span{ &a_vec[0], next_round_size },
+                                          std::span{ &G_vec_local[next_round_size], next_round_size });
+                    } else {
+                        R_msm = small_msm(std::span{ &a_vec[next_round_size], next_round_size },
+                                          std::span{ &G_vec_local[0], next_round_size });
+                    }
+                });
+                round_msms_computed = true;
+            }
+            round_size = next_round_size;
         }
 
         // Step 7
@@ -360,41 +540,12 @@ template <typename Curve_> class IPA {
 
         // Step 7.
         // Construct vector s
-        std::vector<Fr> s_vec(poly_length, Fr::one());
-
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/857): This code is not efficient as its
-        // O(nlogn). This can be optimized to be linear by computing a tree of products. Its very readable, so we're
-        // leaving it unoptimized for now.
-        parallel_for_heuristic(
-            poly_length,
-            [&](size_t i) {
-                for (size_t j = (log_poly_degree - 1); j != static_cast<size_t>(-1); j--) {
-                    auto bit = (i >> j) & 1;
-                    bool b = static_cast<bool>(bit);
-                    if (b) {
-                        s_vec[i] *= round_challenges_inv[log_poly_degree - 1 - j];
-                    }
-                }
-            }, thread_heuristics::FF_MULTIPLICATION_COST * log_poly_degree);
-
-        auto* srs_elements = vk->get_monomial_points();
-
-        // Copy the G_vector to local memory.
-        std::vector<Commitment> G_vec_local(poly_length);
-
-        // The SRS stored in the commitment key is the result after applying the pippenger point table so the
-        // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
-        // G_vec_local should use only the original SRS thus we extract only the even indices.
-        parallel_for_heuristic(
-            poly_length,
-            [&](size_t i) {
-                G_vec_local[i] = srs_elements[i * 2];
-            }, thread_heuristics::FF_COPY_COST * 2);
+        std::vector<Fr> s_vec = compute_s_vec(round_challenges_inv, poly_length);
 
         // Step 8.
-        // Compute G₀
-        Commitment G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-            &s_vec[0], &G_vec_local[0], poly_length, vk->pippenger_runtime_state);
+        // Compute G₀. The SRS is already stored as a pippenger point table, so it is used as is.
+        Commitment G_zero = bb::scalar_multiplication::pippenger<Curve>(
+            &s_vec[0], vk->get_monomial_points(), poly_length, vk->pippenger_runtime_state, false);
 
         // Step 9.
         // Receive a₀ from the prover
@@ -572,6 +723,104 @@ template <typename Curve_> class IPA {
     {
         return reduce_verify_internal(vk, opening_claim, transcript);
     }
+
+    /**
+     * @brief Natively verify a batch of IPA proofs with a single MSM over the SRS
+     *
+     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param opening_claims Opening claims, one per proof
+     * @param transcripts Verifier transcripts holding the proofs, in the same order as the claims
+     *
+     * @return true if every proof verifies
+     *
+     * @details The verification equation of the j-th proof is
+     * \f$C_j + v_j U_j + \sum_i (u_{j,i}^{-1}L_{j,i} + u_{j,i}R_{j,i}) - a_{0,j}\langle\vec{s}_j,\vec{G}\rangle -
+     * a_{0,j}b_{0,j}U_j = 0\f$ with \f$U_j = u_j\cdot G\f$. The equations are combined with random weights
+     * \f$\rho_j\f$ (\f$\rho_0 = 1\f$), so that the SRS is multiplied only once, by the weighted sum of the
+     * \f$a_{0,j}\vec{s}_j\f$ and all the other terms go in a small second MSM. Proofs may have different lengths.
+     */
+    static bool batch_reduce_verify(const std::shared_ptr<VK>& vk,
+                                    std::span<const OpeningClaim<Curve>> opening_claims,
+                                    std::span<const std::shared_ptr<NativeTranscript>> transcripts)
+        requires(!Curve::is_stdlib_type)
+    {
+        ASSERT(opening_claims.size() == transcripts.size());
+        if (opening_claims.empty()) {
+            return true;
+        }
+
+        size_t max_poly_length = 0;
+        std::vector<Fr> srs_scalars;
+        Fr generator_scalar = Fr::zero();
+        std::vector<Fr> msm_scalars;
+        std::vector<Commitment> msm_elements;
+
+        for (size_t j = 0; j < opening_claims.size(); j++) {
+            const auto& opening_claim = opening_claims[j];
+            const auto& transcript = transcripts[j];
+            const Fr rho = j == 0 ? Fr::one() : Fr::random_element();
+
+            auto poly_length = static_cast<uint32_t>(
+                transcript->template receive_from_prover<typename Curve::BaseField>("IPA:poly_degree_plus_1"));
+            const Fr generator_challenge = transcript->template get_challenge<Fr>("IPA:generator_challenge");
+            if (generator_challenge.is_zero()) {
+                throw_or_abort("The generator challenge can't be zero");
+            }
+            auto log_poly_degree = static_cast<size_t>(numeric::get_msb(poly_length));
+
+            // ρ⋅C
+            msm_elements.emplace_back(opening_claim.commitment);
+            msm_scalars.emplace_back(rho);
+
+            // ρ⋅u_i^{-1}⋅L_i and ρ⋅u_i⋅R_i
+            std::vector<Fr> round_challenges_inv(log_poly_degree);
+            for (size_t i = 0; i < log_poly_degree; i++) {
+                std::string index = std::to_string(log_poly_degree - i - 1);
+                auto element_L = transcript->template receive_from_prover<Commitment>("IPA:L_" + index);
+                auto element_R = transcript->template receive_from_prover<Commitment>("IPA:R_" + index);
+                const Fr round_challenge = transcript->template get_challenge<Fr>("IPA:round_challenge_" + index);
+                if (round_challenge.is_zero()) {
+                    throw_or_abort("Round challenges can't be zero");
+                }
+                round_challenges_inv[i] = round_challenge.invert();
+                msm_elements.emplace_back(element_L);
+                msm_scalars.emplace_back(rho * round_challenges_inv[i]);
+                msm_elements.emplace_back(element_R);
+                msm_scalars.emplace_back(rho * round_challenge);
+            }
+            auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
+
+            Fr b_zero = Fr::one();
+            for (size_t i = 0; i < log_poly_degree; i++) {
+                b_zero *= Fr::one() + (round_challenges_inv[log_poly_degree - 1 - i] *
+                                       opening_claim.opening_pair.challenge.pow(1 << i));
+            }
+
+            // ρ⋅u⋅(v - a₀⋅b₀)⋅G
+            generator_scalar += rho * generator_challenge * (opening_claim.opening_pair.evaluation - a_zero * b_zero);
+
+            // -ρ⋅a₀⋅s_i⋅G_i
+            std::vector<Fr> s_vec = compute_s_vec(round_challenges_inv, poly_length);
+            if (poly_length > max_poly_length) {
+                srs_scalars.resize(poly_length, Fr::zero());
+                max_poly_length = poly_length;
+            }
+            const Fr s_scalar = -rho * a_zero;
+            parallel_for_heuristic(
+                poly_length,
+                [&](size_t i) {
+                    srs_scalars[i] += s_scalar * s_vec[i];
+                }, thread_heuristics::FF_ADDITION_COST + thread_heuristics::FF_MULTIPLICATION_COST);
+        }
+        msm_elements.emplace_back(Commitment::one());
+        msm_scalars.emplace_back(generator_scalar);
+
+        GroupElement result = bb::scalar_multiplication::pippenger<Curve>(
+            &srs_scalars[0], vk->get_monomial_points(), max_poly_length, vk->pippenger_runtime_state, false);
+        // The points of the second MSM come from the proofs, so they are combined with complete additions
+        result += small_msm(msm_scalars, msm_elements);
+        return result.is_point_at_infinity();
+    }
 };
 
 } // namespace bb
\ No newline at end of file
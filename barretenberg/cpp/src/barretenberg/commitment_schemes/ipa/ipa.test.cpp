@@ -231,6 +231,75 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
 }
 
+// Large enough for the first rounds to use pippenger and fold the generators in batch
+TEST_F(IPATest, OpenLarge)
+{
+    using IPA = IPA<Curve>;
+    size_t n = 1024;
+    auto poly = this->random_polynomial(n);
+    auto [x, eval] = this->random_eval(poly);
+    auto commitment = this->commit(poly);
+    const OpeningPair<Curve> opening_pair = { x, eval };
+    const OpeningClaim<Curve> opening_claim{ opening_pair, commitment };
+
+    auto prover_transcript = std::make_shared<NativeTranscript>();
+    IPA::compute_opening_proof(this->ck(), { poly, opening_pair }, prover_transcript);
+
+    auto verifier_transcript = std::make_shared<NativeTranscript>(prover_transcript->proof_data);
+    EXPECT_TRUE(IPA::reduce_verify(this->vk(), opening_claim, verifier_transcript));
+}
+
+TEST_F(IPATest, BatchVerify)
+{
+    using IPA = IPA<Curve>;
+    std::vector<OpeningClaim<Curve>> opening_claims;
+    std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts;
+    for (size_t n : { 4, 128, 1024, 128 }) {
+        auto poly = this->random_polynomial(n);
+        auto [x, eval] = this->random_eval(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        opening_claims.push_back({ opening_pair, this->commit(poly) });
+
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA::compute_opening_proof(this->ck(), { poly, opening_pair }, prover_transcript);
+        verifier_transcripts.emplace_back(std::make_shared<NativeTranscript>(prover_transcript->proof_data));
+    }
+    EXPECT_TRUE(IPA::batch_reduce_verify(this->vk(), opening_claims, verifier_transcripts));
+}
+
+TEST_F(IPATest, BatchVerifyFailsOnBadProof)
+{
+    using IPA = IPA<Curve>;
+    std::vector<OpeningClaim<Curve>> opening_claims;
+    std::vector<HonkProof> proofs;
+    for (size_t n : { 128, 1024, 256 }) {
+        auto poly = this->random_polynomial(n);
+        auto [x, eval] = this->random_eval(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        opening_claims.push_back({ opening_pair, this->commit(poly) });
+
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA::compute_opening_proof(this->ck(), { poly, opening_pair }, prover_transcript);
+        proofs.emplace_back(prover_transcript->proof_data);
+    }
+    auto make_transcripts = [&]() {
+        std::vector<std::shared_ptr<NativeTranscript>> transcripts;
+        for (auto& proof : proofs) {
+            transcripts.emplace_back(std::make_shared<NativeTranscript>(proof));
+        }
+        return transcripts;
+    };
+
+    // A wrong evaluation in one claim
+    opening_claims[1].opening_pair.evaluation += Fr::one();
+    EXPECT_FALSE(IPA::batch_reduce_verify(this->vk(), opening_claims, make_transcripts()));
+    opening_claims[1].opening_pair.evaluation -= Fr::one();
+
+    // A wrong a_0 in one proof
+    proofs[2].back() += 1;
+    EXPECT_FALSE(IPA::batch_reduce_verify(this->vk(), opening_claims, make_transcripts()));
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     using IPA = IPA<Curve>;
@@ -2,8 +2,12 @@
 #include "barretenberg/commitment_schemes/claim.hpp"
 #include "barretenberg/commitment_schemes/commitment_key.hpp"
 #include "barretenberg/commitment_schemes/verification_key.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 
+#include <algorithm>
+
 /**
  * @brief Reduces multiple claims about commitments, each opened at a single point
  *  into a single claim for a single polynomial opened at a single point.
@@ -32,6 +36,10 @@ template <typename Curve> class ShplonkProver_ {
   public:
     /**
      * @brief Compute batched quotient polynomial Q(X) = ∑ⱼ ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( X − xⱼ )
+     * @details Division by (X − x) is linear, so the claims are grouped by opening point and there is a single division
+     * per distinct point: Q(X) = ∑ₓ Nₓ(X) / ( X − x ) with Nₓ(X) = ∑_{j : xⱼ = x} ρʲ ⋅ ( fⱼ(X) − vⱼ). Each numerator
+     * Nₓ is batched in a single parallel pass, the first one directly into Q and the others into a scratch buffer that
+     * is reused across points, and its quotient is accumulated into Q by the division itself.
      *
      * @param opening_claims list of prover opening claims {fⱼ(X), (xⱼ, vⱼ)} for a witness polynomial fⱼ(X), s.t. fⱼ(xⱼ)
      * = vⱼ.
@@ -40,26 +48,55 @@ template <typename Curve> class ShplonkProver_ {
      */
     static Polynomial compute_batched_quotient(std::span<const ProverOpeningClaim<Curve>> opening_claims, const Fr& nu)
     {
+        BB_OP_COUNT_TIME_NAME("Shplonk::compute_batched_quotient");
+        const size_t num_opening_claims = opening_claims.size();
+
         // Find n, the maximum size of all polynomials fⱼ(X)
         size_t max_poly_size{ 0 };
         for (const auto& claim : opening_claims) {
             max_poly_size = std::max(max_poly_size, claim.polynomial.size());
         }
-        // Q(X) = ∑ⱼ ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( X − xⱼ )
-        Polynomial Q(max_poly_size);
-        Polynomial tmp(max_poly_size);
 
+        // {ρʲ}ⱼ
+        std::vector<Fr> nu_powers(num_opening_claims);
         Fr current_nu = Fr::one();
-        for (const auto& claim : opening_claims) {
+        for (auto& nu_power : nu_powers) {
+            nu_power = current_nu;
+            current_nu *= nu;
+        }
 
-            // Compute individual claim quotient tmp = ( fⱼ(X) − vⱼ) / ( X − xⱼ )
-            tmp = claim.polynomial;
-            tmp[0] -= claim.opening_pair.evaluation;
-            tmp.factor_roots(claim.opening_pair.challenge);
+        // Group the claims by opening point, in order of first appearance
+        std::vector<OpeningPointGroup> groups;
+        for (size_t idx = 0; idx < num_opening_claims; ++idx) {
+            const auto& claim = opening_claims[idx];
+            auto group = std::find_if(groups.begin(), groups.end(), [&](const OpeningPointGroup& group) {
+                return group.point == claim.opening_pair.challenge;
+            });
+            if (group == groups.end()) {
+                group = groups.emplace(groups.end());
+                group->point = claim.opening_pair.challenge;
+            }
+            group->claim_indices.emplace_back(idx);
+            group->size = std::max(group->size, claim.polynomial.size());
+        }
 
-            // Add the claim quotient to the batched quotient polynomial
-            Q.add_scaled(tmp, current_nu);
-            current_nu *= nu;
+        // Q(X) = ∑ⱼ ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( X − xⱼ )
+        Polynomial Q(max_poly_size);
+        if (groups.empty()) {
+            return Q;
+        }
+        // The first numerator is divided in place in Q, the others share a single scratch buffer
+        size_t max_scratch_size = 0;
+        for (size_t group_idx = 1; group_idx < groups.size(); ++group_idx) {
+            max_scratch_size = std::max(max_scratch_size, groups[group_idx].size);
+        }
+        Polynomial numerator(max_scratch_size, max_scratch_size, Polynomial::DontZeroMemory::FLAG);
+
+        for (size_t group_idx = 0; group_idx < groups.size(); ++group_idx) {
+            const auto& group = groups[group_idx];
+            Polynomial& target = group_idx == 0 ? Q : numerator;
+            batch_numerator(target, group, opening_claims, nu_powers);
+            divide_by_linear_factor(target, group.size, group.point, Q, /*accumulate=*/group_idx != 0);
         }
 
         // Return batched quotient polynomial Q(X)
@@ -68,6 +105,8 @@ template <typename Curve> class ShplonkProver_ {
 
     /**
      * @brief Compute partially evaluated batched quotient polynomial difference Q(X) - Q_z(X)
+     * @details G(X) is computed in place in Q(X) in a single parallel pass, each coefficient of G accumulating the
+     * contributions of all witness polynomials.
      *
      * @param opening_pairs list of opening pairs (xⱼ, vⱼ) for a witness polynomial fⱼ(X), s.t. fⱼ(xⱼ) = vⱼ.
      * @param witness_polynomials list of polynomials fⱼ(X).
@@ -82,9 +121,10 @@ template <typename Curve> class ShplonkProver_ {
         const Fr& nu_challenge,
         const Fr& z_challenge)
     {
+        BB_OP_COUNT_TIME_NAME("Shplonk::compute_partially_evaluated_batched_quotient");
         const size_t num_opening_claims = opening_claims.size();
 
-        // {ẑⱼ(r)}ⱼ , where ẑⱼ(r) = 1/zⱼ(r) = 1/(r - xⱼ)
+        // {ẑⱼ(r)}ⱼ , where ẑⱼ(r) = 1/zⱼ(r) = 1/(r - xⱼ)
         std::vector<Fr> inverse_vanishing_evals;
         inverse_vanishing_evals.reserve(num_opening_claims);
         for (const auto& claim : opening_claims) {
@@ -92,25 +132,37 @@ template <typename Curve> class ShplonkProver_ {
         }
         Fr::batch_invert(inverse_vanishing_evals);
 
+        // {ρʲ / ( r − xⱼ )}ⱼ
+        std::vector<Fr> scaling_factors(num_opening_claims);
+        Fr current_nu = Fr::one();
+        for (size_t idx = 0; idx < num_opening_claims; ++idx) {
+            scaling_factors[idx] = current_nu * inverse_vanishing_evals[idx];
+            current_nu *= nu_challenge;
+        }
+
         // G(X) = Q(X) - Q_z(X) = Q(X) - ∑ⱼ ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ ),
         // s.t. G(r) = 0
         Polynomial G(std::move(batched_quotient_Q)); // G(X) = Q(X)
 
-        // G₀ = ∑ⱼ ρʲ ⋅ vⱼ / ( r − xⱼ )
-        Fr current_nu = Fr::one();
-        Polynomial tmp(G.size());
-        size_t idx = 0;
-        for (const auto& claim : opening_claims) {
-            // tmp = ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ )
-            tmp = claim.polynomial;
-            tmp[0] -= claim.opening_pair.evaluation;
-            Fr scaling_factor = current_nu * inverse_vanishing_evals[idx]; // = ρʲ / ( r − xⱼ )
-
-            // G -= ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ )
-            G.add_scaled(tmp, -scaling_factor);
-
-            current_nu *= nu_challenge;
-            idx++;
+        parallel_for_heuristic(
+            G.size(),
+            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                for (size_t i = start; i < end; ++i) {
+                    Fr sum = Fr::zero();
+                    for (size_t idx = 0; idx < num_opening_claims; ++idx) {
+                        const auto& polynomial = opening_claims[idx].polynomial;
+                        if (i < polynomial.size()) {
+                            sum += scaling_factors[idx] * polynomial[i];
+                        }
+                    }
+                    G[i] -= sum;
+                }
+            },
+            num_opening_claims * (thread_heuristics::FF_ADDITION_COST + thread_heuristics::FF_MULTIPLICATION_COST));
+
+        // G₀ += ∑ⱼ ρʲ ⋅ vⱼ / ( r − xⱼ )
+        for (size_t idx = 0; idx < num_opening_claims; ++idx) {
+            G[0] += scaling_factors[idx] * opening_claims[idx].opening_pair.evaluation;
         }
 
         // Return opening pair (z, 0) and polynomial G(X) = Q(X) - Q_z(X)
@@ -137,6 +189,133 @@ template <typename Curve> class ShplonkProver_ {
         const Fr z = transcript->template get_challenge<Fr>("Shplonk:z");
         return compute_partially_evaluated_batched_quotient(opening_claims, batched_quotient, nu, z);
     }
+
+  private:
+    // Claims sharing an opening point, and the maximum size of their polynomials
+    struct OpeningPointGroup {
+        Fr point;
+        std::vector<size_t> claim_indices;
+        size_t size = 0;
+    };
+
+    /**
+     * @brief Write Nₓ(X) = ∑_{j : xⱼ = x} ρʲ ⋅ ( fⱼ(X) − vⱼ) to the first group.size coefficients of result
+     */
+    static void batch_numerator(Polynomial& result,
+                                const OpeningPointGroup& group,
+                                std::span<const ProverOpeningClaim<Curve>> opening_claims,
+                                std::span<const Fr> nu_powers)
+    {
+        const size_t num_claims = group.claim_indices.size();
+        parallel_for_heuristic(
+            group.size,
+            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                for (size_t i = start; i < end; ++i) {
+                    Fr sum = Fr::zero();
+                    for (const size_t idx : group.claim_indices) {
+                        const auto& polynomial = opening_claims[idx].polynomial;
+                        if (i < polynomial.size()) {
+                            sum += nu_powers[idx] * polynomial[i];
+                        }
+                    }
+                    result[i] = sum;
+                }
+            },
+            num_claims * (thread_heuristics::FF_ADDITION_COST + thread_heuristics::FF_MULTIPLICATION_COST));
+        for (const size_t idx : group.claim_indices) {
+            result[0] -= nu_powers[idx] * opening_claims[idx].opening_pair.evaluation;
+        }
+    }
+
+    /**
+     * @brief Divide the first `size` coefficients of numerator by (X − r), assuming the division is exact as in
+     * polynomial_arithmetic::factor_roots, and either write the quotient to result (which must then be numerator) or
+     * add it to result.
+     * @details The quotient coefficients satisfy bᵢ = (aᵢ − bᵢ₋₁)⋅c with c = (−r)⁻¹ and b₋₁ = 0. This recurrence is
+     * split into one chunk per thread: each thread first runs it on its chunk starting from 0, which yields the correct
+     * bᵢ up to a term B⋅(−c)ⁱ⁻ˢ⁺¹ where B is the (unknown) last coefficient of the previous chunk and s the start of the
+     * chunk. The values of B are then propagated across chunks serially, and each thread corrects its chunk.
+     */
+    static void divide_by_linear_factor(
+        Polynomial& numerator, const size_t size, const Fr& root, Polynomial& result, const bool accumulate)
+    {
+        if (size == 0) {
+            return;
+        }
+        // The last coefficient of the quotient is zero
+        const size_t quotient_size = size - 1;
+        if (root.is_zero()) {
+            // Division by X is a shift to the left
+            if (accumulate) {
+                parallel_for_heuristic(
+                    quotient_size,
+                    [&](size_t i) { result[i] += numerator[i + 1]; },
+                    thread_heuristics::FF_ADDITION_COST);
+            } else {
+                // result is numerator, so the shift is done in place serially: a chunk would otherwise read the first
+                // coefficient of the next chunk after it has been overwritten
+                for (size_t i = 0; i < quotient_size; ++i) {
+                    result[i] = numerator[i + 1];
+                }
+                result[quotient_size] = Fr::zero();
+            }
+            return;
+        }
+
+        const Fr root_inverse = (-root).invert();
+        const Fr minus_root_inverse = -root_inverse;
+        constexpr size_t MIN_ITERATIONS_PER_CHUNK = 1 << 12;
+        const size_t num_chunks = calculate_num_threads(quotient_size, MIN_ITERATIONS_PER_CHUNK);
+        const size_t chunk_size = (quotient_size + num_chunks - 1) / num_chunks;
+
+        // Run the recurrence on each chunk, assuming the previous quotient coefficient is zero
+        std::vector<Fr> chunk_carries(num_chunks, Fr::zero());
+        parallel_for(num_chunks, [&](size_t chunk_idx) {
+            const size_t start = chunk_idx * chunk_size;
+            const size_t end = std::min(start + chunk_size, quotient_size);
+            Fr temp = Fr::zero();
+            for (size_t i = start; i < end; ++i) {
+                temp = (numerator[i] - temp) * root_inverse;
+                numerator[i] = temp;
+            }
+        });
+
+        // Propagate the last coefficient of each chunk to the next one: B_{k+1} = bₑ₋₁ = local bₑ₋₁ + B_k⋅(−c)ᵉ⁻ˢ
+        if (num_chunks > 1) {
+            const Fr chunk_factor = minus_root_inverse.pow(chunk_size);
+            for (size_t chunk_idx = 1; chunk_idx < num_chunks; ++chunk_idx) {
+                const size_t last = chunk_idx * chunk_size - 1;
+                chunk_carries[chunk_idx] = numerator[last] + chunk_carries[chunk_idx - 1] * chunk_factor;
+            }
+        }
+
+        // Correct each chunk and write or accumulate the quotient
+        parallel_for(num_chunks, [&](size_t chunk_idx) {
+            const size_t start = chunk_idx * chunk_size;
+            const size_t end = std::min(start + chunk_size, quotient_size);
+            const Fr& carry = chunk_carries[chunk_idx];
+            if (carry.is_zero()) {
+                if (accumulate) {
+                    for (size_t i = start; i < end; ++i) {
+                        result[i] += numerator[i];
+                    }
+                }
+                return;
+            }
+            Fr correction = carry;
+            for (size_t i = start; i < end; ++i) {
+                correction *= minus_root_inverse;
+                if (accumulate) {
+                    result[i] += numerator[i] + correction;
+                } else {
+                    result[i] = numerator[i] + correction;
+                }
+            }
+        });
+        if (!accumulate) {
+            result[quotient_size] = Fr::zero();
+        }
+    }
 };
 
 /**
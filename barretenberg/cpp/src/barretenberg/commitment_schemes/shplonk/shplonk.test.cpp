@@ -61,4 +61,87 @@ TYPED_TEST(ShplonkTest, ShplonkSimple)
 
     this->verify_opening_claim(batched_verifier_claim, batched_opening_claim.polynomial);
 }
+
+// Test that the batched quotient, computed with a single division per distinct opening point, matches the sum of the
+// individual claim quotients, for claims of different sizes sharing opening points (one of which is zero)
+TYPED_TEST(ShplonkTest, BatchedQuotientSharedOpeningPoints)
+{
+    using ShplonkProver = ShplonkProver_<TypeParam>;
+    using Fr = typename TypeParam::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+    using ProverOpeningClaim = ProverOpeningClaim<TypeParam>;
+
+    const size_t n = 1 << 14;
+    const std::vector<Fr> points = { Fr::random_element(), Fr::zero(), Fr::random_element() };
+
+    std::vector<ProverOpeningClaim> opening_claims;
+    for (size_t idx = 0; idx < 8; ++idx) {
+        const Fr& point = points[idx % points.size()];
+        auto polynomial = this->random_polynomial(n >> (idx % 4));
+        const auto evaluation = polynomial.evaluate(point);
+        opening_claims.push_back({ polynomial, { point, evaluation } });
+    }
+
+    const auto nu = Fr::random_element();
+    const auto z = Fr::random_element();
+
+    // Q(X) = ∑ⱼ ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( X − xⱼ ) and G(X) = Q(X) - ∑ⱼ ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( z − xⱼ ), claim by claim
+    Polynomial expected_Q(n);
+    Polynomial expected_G(n);
+    Fr current_nu = Fr::one();
+    for (const auto& claim : opening_claims) {
+        Polynomial tmp = claim.polynomial;
+        tmp[0] -= claim.opening_pair.evaluation;
+        expected_G.add_scaled(tmp, -current_nu * (z - claim.opening_pair.challenge).invert());
+        tmp.factor_roots(claim.opening_pair.challenge);
+        expected_Q.add_scaled(tmp, current_nu);
+        current_nu *= nu;
+    }
+    expected_G += expected_Q;
+
+    auto batched_quotient = ShplonkProver::compute_batched_quotient(opening_claims, nu);
+    EXPECT_EQ(batched_quotient, expected_Q);
+
+    const auto partially_evaluated_claim =
+        ShplonkProver::compute_partially_evaluated_batched_quotient(opening_claims, batched_quotient, nu, z);
+    EXPECT_EQ(partially_evaluated_claim.polynomial, expected_G);
+    EXPECT_EQ(partially_evaluated_claim.polynomial.evaluate(z), Fr::zero());
+}
+
+// Test that the batched quotient matches the sum of the individual claim quotients when the first opening point is
+// zero, in which case the first numerator is divided in place in the quotient by a shift of its coefficients
+TYPED_TEST(ShplonkTest, BatchedQuotientFirstOpeningPointZero)
+{
+    using ShplonkProver = ShplonkProver_<TypeParam>;
+    using Fr = typename TypeParam::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+    using ProverOpeningClaim = ProverOpeningClaim<TypeParam>;
+
+    const size_t n = 1 << 14;
+    const std::vector<Fr> points = { Fr::zero(), Fr::random_element() };
+
+    std::vector<ProverOpeningClaim> opening_claims;
+    for (size_t idx = 0; idx < 4; ++idx) {
+        const Fr& point = points[idx % points.size()];
+        auto polynomial = this->random_polynomial(n >> idx);
+        const auto evaluation = polynomial.evaluate(point);
+        opening_claims.push_back({ polynomial, { point, evaluation } });
+    }
+
+    const auto nu = Fr::random_element();
+
+    // Q(X) = ∑ⱼ ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( X − xⱼ ), dividing claim by claim
+    Polynomial expected_Q(n);
+    Fr current_nu = Fr::one();
+    for (const auto& claim : opening_claims) {
+        Polynomial tmp = claim.polynomial;
+        tmp[0] -= claim.opening_pair.evaluation;
+        tmp.factor_roots(claim.opening_pair.challenge);
+        expected_Q.add_scaled(tmp, current_nu);
+        current_nu *= nu;
+    }
+
+    auto batched_quotient = ShplonkProver::compute_batched_quotient(opening_claims, nu);
+    EXPECT_EQ(batched_quotient, expected_Q);
+}
 } // namespace bb
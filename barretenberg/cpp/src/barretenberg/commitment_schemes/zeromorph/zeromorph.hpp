@@ -2,13 +2,16 @@
 #include "barretenberg/commitment_schemes/claim.hpp"
 #include "barretenberg/commitment_schemes/commitment_key.hpp"
 #include "barretenberg/commitment_schemes/verification_key.hpp"
+#include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/zip_view.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/stdlib/primitives/biggroup/biggroup.hpp"
 #include "barretenberg/stdlib/primitives/witness/witness.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include <functional>
 
 namespace bb {
 
@@ -63,51 +66,55 @@ template <typename Curve> class ZeroMorphProver_ {
      *          Compute q_{n-3} of size N/(2^3) by
      *          q_{n-3}[l] = f[N/2^3 + l] - f[l]. Repeat similarly until you reach q_0.
      *
+     *          Each step computes q_k and the update of f in the same parallel pass, and f is updated in place in a
+     *          single scratch buffer of size N/2.
+     *
      * @param polynomial Multilinear polynomial f(X_0, ..., X_{d-1})
      * @param u_challenge Multivariate challenge u = (u_0, ..., u_{d-1})
+     * @param on_quotient_computed If provided, called with (k, q_k) as soon as q_k is computed, i.e. in the order
+     * k = n - 1, ..., 0, so that e.g. its commitment is computed while q_k is still hot in cache
      * @return std::vector<Polynomial> The quotients q_k
      */
-    static std::vector<Polynomial> compute_multilinear_quotients(Polynomial& polynomial,
-                                                                 std::span<const FF> u_challenge)
+    static std::vector<Polynomial> compute_multilinear_quotients(
+        const Polynomial& polynomial,
+        std::span<const FF> u_challenge,
+        const std::function<void(size_t, const Polynomial&)>& on_quotient_computed = nullptr)
     {
-        size_t log_N = numeric::get_msb(polynomial.size());
+        BB_OP_COUNT_TIME_NAME("ZM::compute_multilinear_quotients");
+        const size_t log_N = numeric::get_msb(polynomial.size());
         // Define the vector of quotients q_k, k = 0, ..., log_N-1
-        std::vector<Polynomial> quotients;
-        for (size_t k = 0; k < log_N; ++k) {
-            size_t size = 1 << k;
-            quotients.emplace_back(Polynomial(size)); // degree 2^k - 1
-        }
+        std::vector<Polynomial> quotients(log_N);
 
-        // Compute the coefficients of q_{n-1}
+        // The partial evaluations f(X_0, ..., X_{k-1}, u_k, ..., u_{n-1}), folded in place
         size_t size_q = 1 << (log_N - 1);
-        Polynomial q{ size_q };
-        for (size_t l = 0; l < size_q; ++l) {
-            q[l] = polynomial[size_q + l] - polynomial[l];
-        }
-
-        quotients[log_N - 1] = q.share();
-
-        std::vector<FF> f_k;
-        f_k.resize(size_q);
-
-        std::vector<FF> g(polynomial.data(), polynomial.data() + size_q);
-
-        // Compute q_k in reverse order from k= n-2, i.e. q_{n-2}, ..., q_0
-        for (size_t k = 1; k < log_N; ++k) {
-            // Compute f_k
-            for (size_t l = 0; l < size_q; ++l) {
-                f_k[l] = g[l] + u_challenge[log_N - k] * q[l];
-            }
-
-            size_q = size_q / 2;
-            q = Polynomial{ size_q };
-
-            for (size_t l = 0; l < size_q; ++l) {
-                q[l] = f_k[size_q + l] - f_k[l];
+        Polynomial f_k(size_q, size_q, Polynomial::DontZeroMemory::FLAG);
+        constexpr size_t cost_per_coefficient =
+            2 * thread_heuristics::FF_ADDITION_COST + thread_heuristics::FF_MULTIPLICATION_COST;
+
+        // Compute q_k in reverse order from k = n-1, i.e. q_{n-1}, ..., q_0
+        const FF* f = polynomial.data();
+        for (size_t k = log_N; k-- > 0; size_q /= 2) {
+            Polynomial& q = quotients[k] = Polynomial(size_q, size_q, Polynomial::DontZeroMemory::FLAG);
+            const FF u_k = u_challenge[k];
+            // f_k is not needed after computing q_0
+            const bool update_f = k > 0;
+            parallel_for_heuristic(
+                size_q,
+                [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                    for (size_t l = start; l < end; ++l) {
+                        // q_k[l] = f[2^k + l] - f[l]
+                        q[l] = f[size_q + l] - f[l];
+                        // f_k[l] <- f[l] + u_k * q_k[l]
+                        if (update_f) {
+                            f_k[l] = f[l] + u_k * q[l];
+                        }
+                    }
+                },
+                cost_per_coefficient);
+            f = f_k.data();
+            if (on_quotient_computed) {
+                on_quotient_computed(k, q);
             }
-
-            quotients[log_N - k - 1] = q.share();
-            g = f_k;
         }
 
         return quotients;
@@ -129,23 +136,29 @@ template <typename Curve> class ZeroMorphProver_ {
                                                              FF y_challenge,
                                                              size_t N)
     {
+        BB_OP_COUNT_TIME_NAME("ZM::compute_batched_lifted_degree_quotient");
+        const size_t log_N = quotients.size();
+        const std::vector<FF> y_powers = powers_of_challenge(y_challenge, log_N); // y^k
+
         // Batched lifted degree quotient polynomial
-        auto result = Polynomial(N);
-
-        // Compute \hat{q} = \sum_k y^k * X^{N - d_k - 1} * q_k
-        size_t k = 0;
-        auto scalar = FF(1); // y^k
-        for (auto& quotient : quotients) {
-            // Rather than explicitly computing the shifts of q_k by N - d_k - 1 (i.e. multiplying q_k by X^{N - d_k -
-            // 1}) then accumulating them, we simply accumulate y^k*q_k into \hat{q} at the index offset N - d_k - 1
-            auto deg_k = static_cast<size_t>((1 << k) - 1);
-            size_t offset = N - deg_k - 1;
-            for (size_t idx = 0; idx < deg_k + 1; ++idx) {
-                result[offset + idx] += scalar * quotient[idx];
-            }
-            scalar *= y_challenge; // update batching scalar y^k
-            k++;
-        }
+        Polynomial result(N, N, Polynomial::DontZeroMemory::FLAG);
+
+        // Compute \hat{q} = \sum_k y^k * X^{N - d_k - 1} * q_k in a single pass over \hat{q}. Rather than explicitly
+        // computing the shifts of q_k by N - d_k - 1 (i.e. multiplying q_k by X^{N - d_k - 1}) then accumulating them,
+        // each chunk of \hat{q} accumulates y^k*q_k at the index offset N - d_k - 1 = N - 2^k for the q_k that reach
+        // into it.
+        parallel_for_heuristic(
+            N,
+            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                std::fill(&result[start], &result[start] + (end - start), FF(0));
+                for (size_t k = 0; k < log_N; ++k) {
+                    const size_t offset = N - (size_t(1) << k);
+                    for (size_t idx = std::max(start, offset); idx < end; ++idx) {
+                        result[idx] += y_powers[k] * quotients[k][idx - offset];
+                    }
+                }
+            },
+            2 * (thread_heuristics::FF_ADDITION_COST + thread_heuristics::FF_MULTIPLICATION_COST));
 
         return result;
     }
@@ -167,23 +180,34 @@ template <typename Curve> class ZeroMorphProver_ {
                                                                           FF y_challenge,
                                                                           FF x_challenge)
     {
+        BB_OP_COUNT_TIME_NAME("ZM::compute_partially_evaluated_degree_check_polynomial");
         size_t N = batched_quotient.size();
         size_t log_N = quotients.size();
 
-        // Initialize partially evaluated degree check polynomial \zeta_x to \hat{q}
-        auto result = batched_quotient;
-
+        // Scalars -y^k * x^{N - d_k - 1}
+        std::vector<FF> scalars(log_N);
         auto y_power = FF(1); // y^k
         for (size_t k = 0; k < log_N; ++k) {
-            // Accumulate y^k * x^{N - d_k - 1} * q_k into \hat{q}
             auto deg_k = static_cast<size_t>((1 << k) - 1);
-            auto x_power = x_challenge.pow(N - deg_k - 1); // x^{N - d_k - 1}
-
-            result.add_scaled(quotients[k], -y_power * x_power);
-
+            scalars[k] = -y_power * x_challenge.pow(N - deg_k - 1);
             y_power *= y_challenge; // update batching scalar y^k
         }
 
+        // \zeta_x = \hat{q} - \sum_k y^k * x^{N - d_k - 1} * q_k, computed in a single pass over \zeta_x
+        Polynomial result(N, N, Polynomial::DontZeroMemory::FLAG);
+        parallel_for_heuristic(
+            N,
+            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                std::copy(&batched_quotient[start], &batched_quotient[start] + (end - start), &result[start]);
+                for (size_t k = 0; k < log_N; ++k) {
+                    const size_t quotient_end = std::min(end, size_t(1) << k);
+                    for (size_t idx = start; idx < quotient_end; ++idx) {
+                        result[idx] += scalars[k] * quotients[k][idx];
+                    }
+                }
+            },
+            2 * (thread_heuristics::FF_ADDITION_COST + thread_heuristics::FF_MULTIPLICATION_COST));
+
         return result;
     }
 
@@ -216,19 +240,13 @@ template <typename Curve> class ZeroMorphProver_ {
         FF x_challenge,
         std::vector<Polynomial> concatenation_groups_batched = {})
     {
+        BB_OP_COUNT_TIME_NAME("ZM::compute_partially_evaluated_zeromorph_identity_polynomial");
         size_t N = f_batched.size();
         size_t log_N = quotients.size();
 
-        // Initialize Z_x with x * \sum_{i=0}^{m-1} f_i + \sum_{i=0}^{l-1} g_i
-        auto result = g_batched;
-        result.add_scaled(f_batched, x_challenge);
-
-        // Compute Z_x -= v * x * \Phi_n(x)
+        // Compute the scalars of the q_k contributions
         auto phi_numerator = x_challenge.pow(N) - 1; // x^N - 1
-        auto phi_n_x = phi_numerator / (x_challenge - 1);
-        result[0] -= v_evaluation * x_challenge * phi_n_x;
-
-        // Add contribution from q_k polynomials
+        std::vector<FF> quotient_scalars(log_N);
         auto x_power = x_challenge; // x^{2^k}
         for (size_t k = 0; k < log_N; ++k) {
             x_power = x_challenge.pow(1 << k); // x^{2^k}
@@ -245,9 +263,30 @@ template <typename Curve> class ZeroMorphProver_ {
             scalar *= x_challenge;
             scalar *= FF(-1);
 
-            result.add_scaled(quotients[k], scalar);
+            quotient_scalars[k] = scalar;
         }
 
+        // Z_x = x * \sum_{i=0}^{m-1} f_i + \sum_{i=0}^{l-1} g_i + \sum_k scalar_k * q_k, computed in a single pass
+        Polynomial result(N, N, Polynomial::DontZeroMemory::FLAG);
+        parallel_for_heuristic(
+            N,
+            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                for (size_t idx = start; idx < end; ++idx) {
+                    result[idx] = g_batched[idx] + x_challenge * f_batched[idx];
+                }
+                for (size_t k = 0; k < log_N; ++k) {
+                    const size_t quotient_end = std::min(end, size_t(1) << k);
+                    for (size_t idx = start; idx < quotient_end; ++idx) {
+                        result[idx] += quotient_scalars[k] * quotients[k][idx];
+                    }
+                }
+            },
+            3 * (thread_heuristics::FF_ADDITION_COST + thread_heuristics::FF_MULTIPLICATION_COST));
+
+        // Compute Z_x -= v * x * \Phi_n(x)
+        auto phi_n_x = phi_numerator / (x_challenge - 1);
+        result[0] -= v_evaluation * x_challenge * phi_n_x;
+
         // If necessary, add to Z_x the contribution related to concatenated polynomials:
         // \sum_{i=0}^{num_chunks_per_group}(x^{i * min_n + 1}concatenation_groups_batched_{i}).
         // We are effectively reconstructing concatenated polynomials from their chunks now that we know x
@@ -309,6 +348,35 @@ template <typename Curve> class ZeroMorphProver_ {
         return batched_polynomial;
     }
 
+    /**
+     * @brief Compute result = \sum_i scalars_i * polynomials_i in a single parallel pass over result
+     * @details Each thread accumulates all polynomials into cache-sized blocks of its range of result, rather than
+     * streaming the whole of result through memory once per polynomial.
+     */
+    static void batch_polynomials(Polynomial& result, RefSpan<Polynomial> polynomials, std::span<const FF> scalars)
+    {
+        BB_OP_COUNT_TIME_NAME("ZM::batch_polynomials");
+        if (polynomials.size() == 0) {
+            return;
+        }
+        constexpr size_t BLOCK_SIZE = 1 << 10;
+        parallel_for_heuristic(
+            result.size(),
+            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                for (size_t block_start = start; block_start < end; block_start += BLOCK_SIZE) {
+                    const size_t block_end = std::min(end, block_start + BLOCK_SIZE);
+                    for (size_t i = 0; i < polynomials.size(); ++i) {
+                        const Polynomial& polynomial = polynomials[i];
+                        const FF& scalar = scalars[i];
+                        for (size_t idx = block_start; idx < std::min(block_end, polynomial.size()); ++idx) {
+                            result[idx] += scalar * polynomial[idx];
+                        }
+                    }
+                }
+            },
+            polynomials.size() * (thread_heuristics::FF_ADDITION_COST + thread_heuristics::FF_MULTIPLICATION_COST));
+    }
+
     /**
      * @brief  * @brief Returns a univariate opening claim equivalent to a set of multilinear evaluation claims for
      * unshifted polynomials f_i and to-be-shifted polynomials g_i to be subsequently proved with a univariate PCS
@@ -350,20 +418,25 @@ template <typename Curve> class ZeroMorphProver_ {
         // Note: g_batched is formed from the to-be-shifted polynomials, but the batched evaluation incorporates the
         // evaluations produced by sumcheck of h_i = g_i_shifted.
         FF batched_evaluation{ 0 };
-        Polynomial f_batched(N); // batched unshifted polynomials
         FF batching_scalar{ 1 };
-        for (auto [f_poly, f_eval] : zip_view(f_polynomials, f_evaluations)) {
-            f_batched.add_scaled(f_poly, batching_scalar);
+        std::vector<FF> f_batching_scalars;
+        f_batching_scalars.reserve(f_polynomials.size());
+        for (auto& f_eval : f_evaluations) {
+            f_batching_scalars.emplace_back(batching_scalar);
             batched_evaluation += batching_scalar * f_eval;
             batching_scalar *= rho;
         }
-
-        Polynomial g_batched{ N }; // batched to-be-shifted polynomials
-        for (auto [g_poly, g_shift_eval] : zip_view(g_polynomials, g_shift_evaluations)) {
-            g_batched.add_scaled(g_poly, batching_scalar);
+        std::vector<FF> g_batching_scalars;
+        g_batching_scalars.reserve(g_polynomials.size());
+        for (auto& g_shift_eval : g_shift_evaluations) {
+            g_batching_scalars.emplace_back(batching_scalar);
             batched_evaluation += batching_scalar * g_shift_eval;
             batching_scalar *= rho;
-        };
+        }
+        Polynomial f_batched(N); // batched unshifted polynomials
+        Polynomial g_batched(N); // batched to-be-shifted polynomials
+        batch_polynomials(f_batched, f_polynomials, f_batching_scalars);
+        batch_polynomials(g_batched, g_polynomials, g_batching_scalars);
 
         size_t num_groups = concatenation_groups.size();
         size_t num_chunks_per_group = concatenation_groups.empty() ? 0 : concatenation_groups[0].size();
@@ -388,17 +461,26 @@ template <typename Curve> class ZeroMorphProver_ {
 
         // Compute the full batched polynomial f = f_batched + g_batched.shifted() = f_batched + h_batched. This is the
         // polynomial for which we compute the quotients q_k and prove f(u) = v_batched.
-        Polynomial f_polynomial = f_batched;
-        f_polynomial += g_batched.shifted();
-        f_polynomial += concatenated_batched;
-
-        // Compute the multilinear quotients q_k = q_k(X_0, ..., X_{k-1})
-        std::vector<Polynomial> quotients = compute_multilinear_quotients(f_polynomial, u_challenge);
-        // Compute and send commitments C_{q_k} = [q_k], k = 0,...,d-1
+        Polynomial f_polynomial(N, N, Polynomial::DontZeroMemory::FLAG);
+        // The backing memory of g_batched holds a zero past its end, which is the last coefficient of its shift
+        const FF* g_shifted = g_batched.data() + 1;
+        parallel_for_heuristic(
+            N,
+            [&](size_t idx) { f_polynomial[idx] = f_batched[idx] + g_shifted[idx] + concatenated_batched[idx]; },
+            2 * thread_heuristics::FF_ADDITION_COST);
+
+        // Compute the multilinear quotients q_k = q_k(X_0, ..., X_{k-1}), committing to each one as soon as it is
+        // computed, then send the commitments C_{q_k} = [q_k], k = 0,...,d-1
+        std::vector<Commitment> quotient_commitments(log_N);
+        std::vector<Polynomial> quotients =
+            compute_multilinear_quotients(f_polynomial, u_challenge, [&](size_t k, const Polynomial& quotient) {
+                BB_OP_COUNT_TIME_NAME("ZM::commit_quotients");
+                quotient_commitments[k] = commitment_key->commit(quotient);
+            });
+        f_polynomial = Polynomial{};
         for (size_t idx = 0; idx < log_N; ++idx) {
-            Commitment q_k_commitment = commitment_key->commit(quotients[idx]);
             std::string label = "ZM:C_q_" + std::to_string(idx);
-            transcript->send_to_verifier(label, q_k_commitment);
+            transcript->send_to_verifier(label, quotient_commitments[idx]);
         }
         // Add buffer elements to remove log_N dependence in proof
         for (size_t idx = log_N; idx < CONST_PROOF_SIZE_LOG_N; ++idx) {
@@ -0,0 +1,68 @@
+#pragma once
+
+#if defined(__x86_64__) && !defined(__wasm__)
+#include <cpuid.h>
+#include <cstdint>
+#endif
+
+namespace bb {
+
+/**
+ * @brief Instruction set extensions available at runtime, for code that dispatches to hand-vectorized kernels
+ * @details Kernels using these extensions are compiled with per-function target attributes, so that a binary built for a
+ * baseline architecture still uses them on machines that support them.
+ */
+struct CpuFeatures {
+    bool sha = false;     // SHA-NI
+    bool avx2 = false;    // AVX2, with OS support for the YMM state
+    bool avx512f = false; // AVX-512 Foundation, with OS support for the ZMM and opmask state
+};
+
+#if defined(__x86_64__) && !defined(__wasm__)
+inline CpuFeatures detect_cpu_features()
+{
+    CpuFeatures features;
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) {
+        return features;
+    }
+    const bool has_ssse3_sse41 = (ecx & bit_SSSE3) != 0 && (ecx & bit_SSE4_1) != 0;
+    uint64_t xcr0 = 0;
+    if ((ecx & bit_OSXSAVE) != 0) {
+        uint32_t xcr0_lo = 0;
+        uint32_t xcr0_hi = 0;
+        __asm__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+        xcr0 = (static_cast<uint64_t>(xcr0_hi) << 32) | xcr0_lo;
+    }
+    const bool os_ymm = (xcr0 & 0x6) == 0x6;
+    const bool os_zmm = os_ymm && (xcr0 & 0xe0) == 0xe0;
+
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0) {
+        return features;
+    }
+    features.sha = has_ssse3_sse41 && (ebx & bit_SHA) != 0;
+    features.avx2 = os_ymm && (ebx & bit_AVX2) != 0;
+    features.avx512f = os_zmm && (ebx & bit_AVX512F) != 0;
+    return features;
+}
+#else
+inline CpuFeatures detect_cpu_features()
+{
+    return {};
+}
+#endif
+
+/**
+ * @brief The features used for dispatch, detected once
+ * @note Tests may switch features off (never on) to exercise the fallback paths.
+ */
+inline CpuFeatures& get_cpu_features()
+{
+    static CpuFeatures features = detect_cpu_features();
+    return features;
+}
+
+} // namespace bb
@@ -7,6 +7,10 @@
 
 #include "./hash_types.hpp"
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 #if _MSC_VER
 #include <string.h>
 #define __builtin_memcpy memcpy
@@ -48,32 +52,15 @@ static inline uint64_t load_le(const uint8_t* data)
     return to_le64(word);
 }
 
-static inline void keccak(uint64_t* out, size_t bits, const uint8_t* data, size_t size)
+/** Absorbs the final size < block_size bytes of a message followed by the padding, leaving the state to be permuted. */
+static inline void absorb_last_block(uint64_t* state, const uint8_t* data, size_t size, size_t block_size)
 {
     static const size_t word_size = sizeof(uint64_t);
-    const size_t hash_size = bits / 8;
-    const size_t block_size = (1600 - bits * 2) / 8;
 
-    size_t i;
-    uint64_t* state_iter;
+    uint64_t* state_iter = state;
     uint64_t last_word = 0;
     uint8_t* last_word_iter = (uint8_t*)&last_word;
 
-    uint64_t state[25] = { 0 };
-
-    while (size >= block_size) {
-        for (i = 0; i < (block_size / word_size); ++i) {
-            state[i] ^= load_le(data);
-            data += word_size;
-        }
-
-        ethash_keccakf1600(state);
-
-        size -= block_size;
-    }
-
-    state_iter = state;
-
     while (size >= word_size) {
         *state_iter ^= load_le(data);
         ++state_iter;
@@ -91,6 +78,30 @@ static inline void keccak(uint64_t* out, size_t bits, const uint8_t* data, size_
     *state_iter ^= to_le64(last_word);
 
     state[(block_size / word_size) - 1] ^= 0x8000000000000000;
+}
+
+static inline void keccak(uint64_t* out, size_t bits, const uint8_t* data, size_t size)
+{
+    static const size_t word_size = sizeof(uint64_t);
+    const size_t hash_size = bits / 8;
+    const size_t block_size = (1600 - bits * 2) / 8;
+
+    size_t i;
+
+    uint64_t state[25] = { 0 };
+
+    while (size >= block_size) {
+        for (i = 0; i < (block_size / word_size); ++i) {
+            state[i] ^= load_le(data);
+            data += word_size;
+        }
+
+        ethash_keccakf1600(state);
+
+        size -= block_size;
+    }
+
+    absorb_last_block(state, data, size, block_size);
 
     ethash_keccakf1600(state);
 
@@ -105,6 +116,55 @@ struct keccak256 ethash_keccak256(const uint8_t* data, size_t size) NOEXCEPT
     return hash;
 }
 
+void ethash_keccak256_batch(const uint8_t* const* data,
+                            const size_t* sizes,
+                            size_t num_inputs,
+                            struct keccak256* out) NOEXCEPT
+{
+    static const size_t word_size = sizeof(uint64_t);
+    static const size_t hash_size = 256 / 8;
+    static const size_t block_size = (1600 - 256 * 2) / 8;
+
+    /* Order the inputs by decreasing number of full blocks, so that the states still absorbing are always a prefix of
+       the batch */
+    std::vector<size_t> order(num_inputs);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        return sizes[lhs] / block_size > sizes[rhs] / block_size;
+    });
+    std::vector<uint64_t> states(num_inputs * 25, 0);
+
+    size_t num_active = num_inputs;
+    for (size_t block = 0;; ++block) {
+        /* Every input absorbs its full blocks and then one last, padded, block */
+        while (num_active > 0 && sizes[order[num_active - 1]] / block_size < block) {
+            --num_active;
+        }
+        if (num_active == 0) {
+            break;
+        }
+        for (size_t i = 0; i < num_active; ++i) {
+            uint64_t* state = &states[i * 25];
+            const size_t size = sizes[order[i]];
+            const uint8_t* block_data = data[order[i]] + block * block_size;
+            if (size / block_size > block) {
+                for (size_t j = 0; j < (block_size / word_size); ++j) {
+                    state[j] ^= load_le(block_data + j * word_size);
+                }
+            } else {
+                absorb_last_block(state, block_data, size - block * block_size, block_size);
+            }
+        }
+        ethash_keccakf1600_batch(states.data(), num_active);
+    }
+
+    for (size_t i = 0; i < num_inputs; ++i) {
+        for (size_t j = 0; j < (hash_size / word_size); ++j) {
+            out[order[i]].word64s[j] = to_le64(states[i * 25 + j]);
+        }
+    }
+}
+
 struct keccak256 hash_field_elements(const uint64_t* limbs, size_t num_elements)
 {
     uint8_t input_buffer[num_elements * 32];
@@ -29,8 +29,33 @@ extern "C" {
  */
 void ethash_keccakf1600(uint64_t state[25]) NOEXCEPT;
 
+/**
+ * The Keccak-f[1600] function applied to a batch of independent states.
+ *
+ * Groups of states are permuted together with AVX-512 (8 states) or AVX2 (4 states) when the CPU supports them, the
+ * remainder with ethash_keccakf1600.
+ *
+ * @param states      num_states consecutive states of 25 64-bit words each.
+ * @param num_states  The number of states.
+ */
+void ethash_keccakf1600_batch(uint64_t* states, size_t num_states) NOEXCEPT;
+
 struct keccak256 ethash_keccak256(const uint8_t* data, size_t size) NOEXCEPT;
 
+/**
+ * Keccak-256 of each of a batch of independent inputs, absorbed in lockstep so that every permutation goes through
+ * ethash_keccakf1600_batch.
+ *
+ * @param data        The inputs.
+ * @param sizes       The size in bytes of each input.
+ * @param num_inputs  The number of inputs.
+ * @param out         The num_inputs hashes, out[i] = ethash_keccak256(data[i], sizes[i]).
+ */
+void ethash_keccak256_batch(const uint8_t* const* data,
+                            const size_t* sizes,
+                            size_t num_inputs,
+                            struct keccak256* out) NOEXCEPT;
+
 struct keccak256 hash_field_elements(const uint64_t* limbs, size_t num_elements);
 
 struct keccak256 hash_field_element(const uint64_t* limb);
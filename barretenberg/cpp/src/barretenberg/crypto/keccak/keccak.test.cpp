@@ -0,0 +1,90 @@
+#include "keccak.hpp"
+#include "barretenberg/common/cpu_features.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace bb;
+
+namespace {
+// Deterministic, well mixed test data without depending on the random engine
+uint64_t mix(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return x;
+}
+
+// Runs the test body once with every kernel available on this machine, then with none
+template <typename Fn> void for_each_kernel(Fn fn)
+{
+    CpuFeatures& features = get_cpu_features();
+    const CpuFeatures detected = features;
+    fn();
+    features.avx512f = false;
+    fn();
+    features.avx2 = false;
+    fn();
+    features = detected;
+}
+} // namespace
+
+TEST(keccak, empty_input)
+{
+    const auto hash = ethash_keccak256(nullptr, 0);
+    // keccak256("") = 0xc5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470, as little-endian words
+    EXPECT_EQ(hash.word64s[0], 0x3c23f7860146d2c5ULL);
+    EXPECT_EQ(hash.word64s[1], 0xc003c7dcb27d7e92ULL);
+    EXPECT_EQ(hash.word64s[2], 0x3b2782ca53b600e5ULL);
+    EXPECT_EQ(hash.word64s[3], 0x70a4855d04d8fa7bULL);
+}
+
+// The batched permutation agrees with ethash_keccakf1600 for batch sizes exercising every kernel and remainder
+TEST(keccak, batch_permutation_matches_single)
+{
+    for_each_kernel([] {
+        for (size_t num_states : std::vector<size_t>{ 1, 3, 4, 8, 13, 21 }) {
+            std::vector<uint64_t> states(num_states * 25);
+            for (size_t i = 0; i < states.size(); ++i) {
+                states[i] = mix(i + num_states);
+            }
+            std::vector<uint64_t> expected = states;
+            for (size_t i = 0; i < num_states; ++i) {
+                ethash_keccakf1600(&expected[i * 25]);
+            }
+            ethash_keccakf1600_batch(states.data(), num_states);
+            EXPECT_EQ(states, expected);
+        }
+    });
+}
+
+// Batch hashing of inputs of different lengths, around the 136-byte rate, agrees with hashing them one by one
+TEST(keccak, batch_hash_matches_single)
+{
+    std::vector<std::vector<uint8_t>> inputs;
+    const std::vector<size_t> input_sizes{ 0, 1, 7, 8, 31, 32, 135, 136, 137, 200, 271, 272, 273, 1000, 64, 64, 64, 5 };
+    for (size_t size : input_sizes) {
+        std::vector<uint8_t> input(size);
+        for (size_t i = 0; i < size; ++i) {
+            input[i] = static_cast<uint8_t>(mix(i + size * 1000));
+        }
+        inputs.emplace_back(std::move(input));
+    }
+    std::vector<const uint8_t*> data;
+    std::vector<size_t> sizes;
+    for (const auto& input : inputs) {
+        data.push_back(input.data());
+        sizes.push_back(input.size());
+    }
+
+    for_each_kernel([&] {
+        std::vector<keccak256> hashes(inputs.size());
+        ethash_keccak256_batch(data.data(), sizes.data(), inputs.size(), hashes.data());
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            const auto expected = ethash_keccak256(inputs[i].data(), inputs[i].size());
+            for (size_t j = 0; j < 4; ++j) {
+                EXPECT_EQ(hashes[i].word64s[j], expected.word64s[j]);
+            }
+        }
+    });
+}
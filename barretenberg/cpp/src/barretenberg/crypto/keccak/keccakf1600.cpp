@@ -6,6 +6,12 @@
 #include "keccak.hpp"
 #include <stdint.h>
 
+#if defined(__x86_64__) && !defined(__wasm__)
+#define KECCAK_X86_KERNELS
+#include "barretenberg/common/cpu_features.hpp"
+#include <immintrin.h>
+#endif
+
 static uint64_t rol(uint64_t x, unsigned s)
 {
     return (x << s) | (x >> (64 - s));
@@ -233,3 +239,161 @@ void ethash_keccakf1600(uint64_t state[25]) NOEXCEPT
     state[23] = Aso;
     state[24] = Asu;
 }
+
+#ifdef KECCAK_X86_KERNELS
+/*
+ * Multi-state kernels. Each 64-bit lane of a vector register holds the same word of a different state, and the
+ * permutation is written in its compact form: lane i = x + 5y is rotated by rho_offsets[i] and moved to pi_targets[i].
+ * The loops over lanes are fully unrolled so that the state stays in registers.
+ */
+
+static constexpr int rho_offsets[25] = {
+    0, 1, 62, 28, 27, 36, 44, 6, 55, 20, 3, 10, 43, 25, 39, 41, 45, 15, 21, 8, 18, 2, 61, 56, 14,
+};
+
+static constexpr int pi_targets[25] = {
+    0, 10, 20, 5, 15, 16, 1, 11, 21, 6, 7, 17, 2, 12, 22, 23, 8, 18, 3, 13, 14, 24, 9, 19, 4,
+};
+
+__attribute__((target("avx512f"))) static inline __m512i rol_x8(__m512i x, int s)
+{
+    return _mm512_rolv_epi64(x, _mm512_set1_epi64(s));
+}
+
+/* Permute 8 consecutive states */
+__attribute__((target("avx512f"))) static void keccakf1600_x8_avx512(uint64_t* states)
+{
+    __m512i A[25];
+    __m512i B[25];
+    __m512i C[5];
+    for (int i = 0; i < 25; ++i) {
+        A[i] = _mm512_setr_epi64((long long)states[i],
+                                 (long long)states[25 + i],
+                                 (long long)states[50 + i],
+                                 (long long)states[75 + i],
+                                 (long long)states[100 + i],
+                                 (long long)states[125 + i],
+                                 (long long)states[150 + i],
+                                 (long long)states[175 + i]);
+    }
+
+    for (int round = 0; round < 24; ++round) {
+        /* theta; 0x96 is a three-way xor */
+#pragma GCC unroll 25
+        for (int x = 0; x < 5; ++x) {
+            C[x] = _mm512_ternarylogic_epi64(A[x], A[x + 5], A[x + 10], 0x96);
+            C[x] = _mm512_ternarylogic_epi64(C[x], A[x + 15], A[x + 20], 0x96);
+        }
+#pragma GCC unroll 25
+        for (int x = 0; x < 5; ++x) {
+            const __m512i D = _mm512_xor_si512(C[(x + 4) % 5], rol_x8(C[(x + 1) % 5], 1));
+#pragma GCC unroll 25
+            for (int y = 0; y < 25; y += 5) {
+                A[x + y] = _mm512_xor_si512(A[x + y], D);
+            }
+        }
+        /* rho and pi */
+#pragma GCC unroll 25
+        for (int i = 0; i < 25; ++i) {
+            B[pi_targets[i]] = rol_x8(A[i], rho_offsets[i]);
+        }
+        /* chi; 0xD2 is a ^ (~b & c) */
+#pragma GCC unroll 25
+        for (int y = 0; y < 25; y += 5) {
+#pragma GCC unroll 25
+            for (int x = 0; x < 5; ++x) {
+                A[x + y] = _mm512_ternarylogic_epi64(B[x + y], B[(x + 1) % 5 + y], B[(x + 2) % 5 + y], 0xD2);
+            }
+        }
+        /* iota */
+        A[0] = _mm512_xor_si512(A[0], _mm512_set1_epi64((long long)round_constants[round]));
+    }
+
+    for (int i = 0; i < 25; ++i) {
+        uint64_t words[8];
+        _mm512_storeu_si512(words, A[i]);
+        for (int lane = 0; lane < 8; ++lane) {
+            states[lane * 25 + i] = words[lane];
+        }
+    }
+}
+
+__attribute__((target("avx2"))) static inline __m256i rol_x4(__m256i x, int s)
+{
+    return _mm256_or_si256(_mm256_sllv_epi64(x, _mm256_set1_epi64x(s)),
+                           _mm256_srlv_epi64(x, _mm256_set1_epi64x(64 - s)));
+}
+
+/* Permute 4 consecutive states */
+__attribute__((target("avx2"))) static void keccakf1600_x4_avx2(uint64_t* states)
+{
+    __m256i A[25];
+    __m256i B[25];
+    __m256i C[5];
+    for (int i = 0; i < 25; ++i) {
+        A[i] = _mm256_setr_epi64x(
+            (long long)states[i], (long long)states[25 + i], (long long)states[50 + i], (long long)states[75 + i]);
+    }
+
+    for (int round = 0; round < 24; ++round) {
+        /* theta */
+#pragma GCC unroll 25
+        for (int x = 0; x < 5; ++x) {
+            C[x] = _mm256_xor_si256(_mm256_xor_si256(A[x], A[x + 5]), _mm256_xor_si256(A[x + 10], A[x + 15]));
+            C[x] = _mm256_xor_si256(C[x], A[x + 20]);
+        }
+#pragma GCC unroll 25
+        for (int x = 0; x < 5; ++x) {
+            const __m256i D = _mm256_xor_si256(C[(x + 4) % 5], rol_x4(C[(x + 1) % 5], 1));
+#pragma GCC unroll 25
+            for (int y = 0; y < 25; y += 5) {
+                A[x + y] = _mm256_xor_si256(A[x + y], D);
+            }
+        }
+        /* rho and pi */
+#pragma GCC unroll 25
+        for (int i = 0; i < 25; ++i) {
+            B[pi_targets[i]] = rol_x4(A[i], rho_offsets[i]);
+        }
+        /* chi */
+#pragma GCC unroll 25
+        for (int y = 0; y < 25; y += 5) {
+#pragma GCC unroll 25
+            for (int x = 0; x < 5; ++x) {
+                A[x + y] = _mm256_xor_si256(B[x + y], _mm256_andnot_si256(B[(x + 1) % 5 + y], B[(x + 2) % 5 + y]));
+            }
+        }
+        /* iota */
+        A[0] = _mm256_xor_si256(A[0], _mm256_set1_epi64x((long long)round_constants[round]));
+    }
+
+    for (int i = 0; i < 25; ++i) {
+        uint64_t words[4];
+        _mm256_storeu_si256((__m256i*)words, A[i]);
+        for (int lane = 0; lane < 4; ++lane) {
+            states[lane * 25 + i] = words[lane];
+        }
+    }
+}
+#endif
+
+void ethash_keccakf1600_batch(uint64_t* states, size_t num_states) NOEXCEPT
+{
+    size_t i = 0;
+#ifdef KECCAK_X86_KERNELS
+    const bb::CpuFeatures& features = bb::get_cpu_features();
+    if (features.avx512f) {
+        for (; i + 8 <= num_states; i += 8) {
+            keccakf1600_x8_avx512(states + i * 25);
+        }
+    }
+    if (features.avx2) {
+        for (; i + 4 <= num_states; i += 4) {
+            keccakf1600_x4_avx2(states + i * 25);
+        }
+    }
+#endif
+    for (; i < num_states; ++i) {
+        ethash_keccakf1600(states + i * 25);
+    }
+}
@@ -1,8 +1,11 @@
 #include "./sha256.hpp"
+#include "./sha256_simd.hpp"
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/net.hpp"
+#include <algorithm>
 #include <array>
 #include <memory.h>
+#include <numeric>
 
 namespace {
 constexpr uint32_t init_constants[8]{ 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
@@ -24,6 +27,49 @@ constexpr uint32_t ror(uint32_t val, uint32_t shift)
     return (val >> (shift & 31U)) | (val << (32U - (shift & 31U)));
 }
 
+using State = std::array<uint32_t, 8>;
+using Block = std::array<uint32_t, 16>;
+
+/**
+ * @brief Pad a message and split it into blocks of big-endian words converted to host order
+ */
+template <typename ByteContainer> std::vector<Block> pad_message(const ByteContainer& input)
+{
+    // The message is followed by a 1 bit, zeros and its length in bits as a 64-bit big-endian integer
+    const size_t size = input.size();
+    const size_t num_blocks = (size + 1 + 8 + 63) / 64;
+    std::vector<Block> blocks(num_blocks);
+    auto* message_schedule = reinterpret_cast<uint8_t*>(blocks.data());
+
+    std::copy(input.begin(), input.end(), message_schedule);
+    message_schedule[size] = 0x80;
+    const uint64_t l = size * 8;
+    for (size_t i = 0; i < 8; ++i) {
+        message_schedule[num_blocks * 64 - 8 + i] = static_cast<uint8_t>(l >> (uint64_t)(56 - (i * 8)));
+    }
+    if (is_little_endian()) {
+        for (auto& block : blocks) {
+            for (auto& word : block) {
+                word = __builtin_bswap32(word);
+            }
+        }
+    }
+    return blocks;
+}
+
+bb::crypto::Sha256Hash state_to_hash(const State& state)
+{
+    bb::crypto::Sha256Hash output;
+    memcpy((void*)&output[0], (void*)&state[0], 32);
+    if (is_little_endian()) {
+        uint32_t* output_uint32 = (uint32_t*)&output[0];
+        for (size_t j = 0; j < 8; ++j) {
+            output_uint32[j] = __builtin_bswap32(output_uint32[j]);
+        }
+    }
+    return output;
+}
+
 } // namespace
 
 namespace bb::crypto {
@@ -39,7 +85,11 @@ void prepare_constants(std::array<uint32_t, 8>& input)
     input[7] = init_constants[7];
 }
 
-std::array<uint32_t, 8> sha256_block(const std::array<uint32_t, 8>& h_init, const std::array<uint32_t, 16>& input)
+/**
+ * @brief Portable implementation of the compression function
+ */
+std::array<uint32_t, 8> sha256_block_scalar(const std::array<uint32_t, 8>& h_init,
+                                            const std::array<uint32_t, 16>& input)
 {
     std::array<uint32_t, 64> w;
 
@@ -107,6 +157,60 @@ std::array<uint32_t, 8> sha256_block(const std::array<uint32_t, 8>& h_init, cons
     return output;
 }
 
+std::array<uint32_t, 8> sha256_block(const std::array<uint32_t, 8>& h_init, const std::array<uint32_t, 16>& input)
+{
+    if (sha256_simd::has_sha_ni()) {
+        State state = h_init;
+        sha256_simd::compress_sha_ni(state, &input, 1);
+        return state;
+    }
+    return sha256_block_scalar(h_init, input);
+}
+
+/**
+ * @brief Compress a sequence of blocks into a state
+ */
+void compress_blocks(State& state, const std::vector<Block>& blocks)
+{
+    if (sha256_simd::has_sha_ni()) {
+        sha256_simd::compress_sha_ni(state, blocks.data(), blocks.size());
+        return;
+    }
+    for (const auto& block : blocks) {
+        state = sha256_block_scalar(state, block);
+    }
+}
+
+void sha256_block_batch(std::span<const std::array<uint32_t, 8>> h_inits,
+                        std::span<const std::array<uint32_t, 16>> inputs,
+                        std::span<std::array<uint32_t, 8>> outputs)
+{
+    ASSERT(h_inits.size() == inputs.size() && outputs.size() == inputs.size());
+    const size_t num_inputs = inputs.size();
+    if (sha256_simd::has_sha_ni() || !sha256_simd::has_avx2()) {
+        for (size_t i = 0; i < num_inputs; ++i) {
+            outputs[i] = sha256_block(h_inits[i], inputs[i]);
+        }
+        return;
+    }
+
+    constexpr size_t LANES = sha256_simd::AVX2_LANES;
+    // Lanes past the end of the last group compress a copy of the first pair into a scratch state
+    std::array<State, LANES> scratch_states{};
+    std::array<State*, LANES> states;
+    std::array<const Block*, LANES> blocks;
+    for (size_t group_start = 0; group_start < num_inputs; group_start += LANES) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            const size_t idx = group_start + lane;
+            const bool in_range = idx < num_inputs;
+            states[lane] = in_range ? &outputs[idx] : &scratch_states[lane];
+            *states[lane] = in_range ? h_inits[idx] : h_inits[0];
+            blocks[lane] = in_range ? &inputs[idx] : &inputs[0];
+        }
+        sha256_simd::compress_x8_avx2(states.data(), blocks.data());
+    }
+}
+
 Sha256Hash sha256_block(const std::vector<uint8_t>& input)
 {
     ASSERT(input.size() == 64);
@@ -121,64 +225,77 @@ Sha256Hash sha256_block(const std::vector<uint8_t>& input)
     }
     result = sha256_block(result, hash_input);
 
-    Sha256Hash output;
-    memcpy((void*)&output[0], (void*)&result[0], 32);
-    if (is_little_endian()) {
-        uint32_t* output_uint32 = (uint32_t*)&output[0];
-        for (size_t j = 0; j < 8; ++j) {
-            output_uint32[j] = __builtin_bswap32(output_uint32[j]);
-        }
-    }
-
-    return output;
+    return state_to_hash(result);
 }
 
 template <typename ByteContainer> Sha256Hash sha256(const ByteContainer& input)
 {
-    std::vector<uint8_t> message_schedule;
-
-    std::copy(input.begin(), input.end(), std::back_inserter(message_schedule));
-    uint64_t l = message_schedule.size() * 8;
-    message_schedule.push_back(0x80);
+    const std::vector<Block> blocks = pad_message(input);
+    std::array<uint32_t, 8> rolling_hash;
+    prepare_constants(rolling_hash);
+    compress_blocks(rolling_hash, blocks);
 
-    uint32_t num_zero_bytes = ((448U - (message_schedule.size() << 3U)) & 511U) >> 3U;
+    return state_to_hash(rolling_hash);
+}
 
-    for (size_t i = 0; i < num_zero_bytes; ++i) {
-        message_schedule.push_back(0x00);
-    }
-    for (size_t i = 0; i < 8; ++i) {
-        uint8_t byte = static_cast<uint8_t>(l >> (uint64_t)(56 - (i * 8)));
-        message_schedule.push_back(byte);
+std::vector<Sha256Hash> sha256_batch(std::span<const std::vector<uint8_t>> inputs)
+{
+    const size_t num_inputs = inputs.size();
+    std::vector<std::vector<Block>> padded(num_inputs);
+    std::vector<State> states(num_inputs);
+    for (size_t i = 0; i < num_inputs; ++i) {
+        padded[i] = pad_message(inputs[i]);
+        prepare_constants(states[i]);
     }
-    std::array<uint32_t, 8> rolling_hash;
-    prepare_constants(rolling_hash);
-    const size_t num_blocks = message_schedule.size() / 64;
-    for (size_t i = 0; i < num_blocks; ++i) {
-        std::array<uint32_t, 16> hash_input;
-        memcpy((void*)&hash_input[0], (void*)&message_schedule[i * 64], 64);
-        if (is_little_endian()) {
-            for (size_t j = 0; j < hash_input.size(); ++j) {
-                hash_input[j] = __builtin_bswap32(hash_input[j]);
-            }
+
+    if (sha256_simd::has_sha_ni() || !sha256_simd::has_avx2()) {
+        for (size_t i = 0; i < num_inputs; ++i) {
+            compress_blocks(states[i], padded[i]);
         }
-        rolling_hash = sha256_block(rolling_hash, hash_input);
-    }
+    } else {
+        // Messages with similar numbers of blocks are grouped together so that few lanes idle
+        std::vector<size_t> order(num_inputs);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+            return padded[lhs].size() < padded[rhs].size();
+        });
 
-    Sha256Hash output;
-    memcpy((void*)&output[0], (void*)&rolling_hash[0], 32);
-    if (is_little_endian()) {
-        uint32_t* output_uint32 = (uint32_t*)&output[0];
-        for (size_t j = 0; j < 8; ++j) {
-            output_uint32[j] = __builtin_bswap32(output_uint32[j]);
+        constexpr size_t LANES = sha256_simd::AVX2_LANES;
+        // Idle lanes compress a dummy block into a scratch state
+        const Block dummy_block{};
+        std::array<State, LANES> scratch_states{};
+        std::array<State*, LANES> lane_states;
+        std::array<const Block*, LANES> lane_blocks;
+        for (size_t group_start = 0; group_start < num_inputs; group_start += LANES) {
+            const size_t group_end = std::min(group_start + LANES, num_inputs);
+            const size_t num_steps = padded[order[group_end - 1]].size();
+            for (size_t step = 0; step < num_steps; ++step) {
+                for (size_t lane = 0; lane < LANES; ++lane) {
+                    const size_t idx = group_start + lane;
+                    if (idx < group_end && step < padded[order[idx]].size()) {
+                        lane_states[lane] = &states[order[idx]];
+                        lane_blocks[lane] = &padded[order[idx]][step];
+                    } else {
+                        lane_states[lane] = &scratch_states[lane];
+                        lane_blocks[lane] = &dummy_block;
+                    }
+                }
+                sha256_simd::compress_x8_avx2(lane_states.data(), lane_blocks.data());
+            }
         }
     }
 
-    return output;
+    std::vector<Sha256Hash> outputs(num_inputs);
+    for (size_t i = 0; i < num_inputs; ++i) {
+        outputs[i] = state_to_hash(states[i]);
+    }
+    return outputs;
 }
 
 template Sha256Hash sha256<std::vector<uint8_t>>(const std::vector<uint8_t>& input);
 template Sha256Hash sha256<std::array<uint8_t, 32>>(const std::array<uint8_t, 32>& input);
 template Sha256Hash sha256<std::string>(const std::string& input);
 template Sha256Hash sha256<std::span<uint8_t>>(const std::span<uint8_t>& input);
+template Sha256Hash sha256<std::span<const uint8_t>>(const std::span<const uint8_t>& input);
 
 } // namespace bb::crypto
@@ -5,16 +5,44 @@
 #include <array>
 #include <iomanip>
 #include <ostream>
+#include <span>
 #include <vector>
 
 namespace bb::crypto {
 
 using Sha256Hash = std::array<uint8_t, 32>;
 
+/**
+ * @brief The SHA-256 compression function applied to a single block (as big-endian words converted to host order)
+ * @details Uses the SHA extensions when the CPU supports them.
+ */
+std::array<uint32_t, 8> sha256_block(const std::array<uint32_t, 8>& h_init, const std::array<uint32_t, 16>& input);
+
+/**
+ * @brief Portable implementation of the compression function, whatever the CPU supports
+ */
+std::array<uint32_t, 8> sha256_block_scalar(const std::array<uint32_t, 8>& h_init,
+                                            const std::array<uint32_t, 16>& input);
+
+/**
+ * @brief The SHA-256 compression function applied to many independent (state, block) pairs
+ * @details Uses the SHA extensions when available, otherwise compresses eight pairs at a time with AVX2 when available.
+ */
+void sha256_block_batch(std::span<const std::array<uint32_t, 8>> h_inits,
+                        std::span<const std::array<uint32_t, 16>> inputs,
+                        std::span<std::array<uint32_t, 8>> outputs);
+
 Sha256Hash sha256_block(const std::vector<uint8_t>& input);
 
 template <typename T> Sha256Hash sha256(const T& input);
 
+/**
+ * @brief Hash many independent messages
+ * @details Messages are padded up front and their blocks compressed with the SHA extensions when available, otherwise
+ * eight messages at a time with AVX2 when available.
+ */
+std::vector<Sha256Hash> sha256_batch(std::span<const std::vector<uint8_t>> inputs);
+
 inline bb::fr sha256_to_field(std::vector<uint8_t> const& input)
 {
     auto result = sha256(input);
@@ -1,4 +1,7 @@
 #include "sha256.hpp"
+#include "barretenberg/common/cpu_features.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "sha256_simd.hpp"
 #include <gtest/gtest.h>
 #include <iostream>
 #include <memory>
@@ -101,3 +104,95 @@ TEST(misc_sha256, test_NIST_vector_five)
         EXPECT_EQ(result[i], expected[i]);
     }
 }
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+std::array<uint32_t, 8> random_state()
+{
+    std::array<uint32_t, 8> state;
+    for (auto& word : state) {
+        word = engine.get_random_uint32();
+    }
+    return state;
+}
+
+std::array<uint32_t, 16> random_block()
+{
+    std::array<uint32_t, 16> block;
+    for (auto& word : block) {
+        word = engine.get_random_uint32();
+    }
+    return block;
+}
+} // namespace
+
+TEST(misc_sha256, simd_kernels_match_compression_function)
+{
+    constexpr size_t num_blocks = 19; // not a multiple of the number of AVX2 lanes
+    std::vector<std::array<uint32_t, 8>> states;
+    std::vector<std::array<uint32_t, 16>> blocks;
+    std::vector<std::array<uint32_t, 8>> expected;
+    for (size_t i = 0; i < num_blocks; ++i) {
+        states.emplace_back(random_state());
+        blocks.emplace_back(random_block());
+        expected.emplace_back(sha256_block_scalar(states.back(), blocks.back()));
+    }
+
+    std::vector<std::array<uint32_t, 8>> outputs(num_blocks);
+    sha256_block_batch(states, blocks, outputs);
+    EXPECT_EQ(outputs, expected);
+
+    if (sha256_simd::has_sha_ni()) {
+        // A chain of blocks compressed in one call
+        auto state = states[0];
+        auto chained = states[0];
+        sha256_simd::compress_sha_ni(state, blocks.data(), num_blocks);
+        for (const auto& block : blocks) {
+            chained = sha256_block_scalar(chained, block);
+        }
+        EXPECT_EQ(state, chained);
+    }
+    if (sha256_simd::has_avx2()) {
+        std::array<std::array<uint32_t, 8>*, sha256_simd::AVX2_LANES> lane_states;
+        std::array<const std::array<uint32_t, 16>*, sha256_simd::AVX2_LANES> lane_blocks;
+        auto lane_outputs = states;
+        for (size_t lane = 0; lane < sha256_simd::AVX2_LANES; ++lane) {
+            lane_states[lane] = &lane_outputs[lane];
+            lane_blocks[lane] = &blocks[lane];
+        }
+        sha256_simd::compress_x8_avx2(lane_states.data(), lane_blocks.data());
+        for (size_t lane = 0; lane < sha256_simd::AVX2_LANES; ++lane) {
+            EXPECT_EQ(lane_outputs[lane], expected[lane]);
+        }
+    }
+}
+
+TEST(misc_sha256, batch_matches_single_hashes)
+{
+    // Messages of assorted lengths, spanning one to several blocks
+    std::vector<std::vector<uint8_t>> inputs;
+    for (size_t i = 0; i < 37; ++i) {
+        std::vector<uint8_t> input((i * 29) % 300);
+        for (auto& byte : input) {
+            byte = static_cast<uint8_t>(engine.get_random_uint8());
+        }
+        inputs.emplace_back(input);
+    }
+
+    std::vector<Sha256Hash> expected;
+    for (const auto& input : inputs) {
+        expected.emplace_back(sha256(input));
+    }
+    EXPECT_EQ(sha256_batch(inputs), expected);
+    EXPECT_TRUE(sha256_batch({}).empty());
+
+    // Exercise the multi-buffer and portable paths as well
+    auto& features = get_cpu_features();
+    const auto detected = features;
+    features.sha = false;
+    EXPECT_EQ(sha256_batch(inputs), expected);
+    features.avx2 = false;
+    EXPECT_EQ(sha256_batch(inputs), expected);
+    features = detected;
+}
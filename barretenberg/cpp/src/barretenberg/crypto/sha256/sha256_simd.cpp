@@ -0,0 +1,208 @@
+#include "./sha256_simd.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/cpu_features.hpp"
+
+#if defined(__x86_64__) && !defined(__wasm__)
+#define BB_SHA256_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace bb::crypto::sha256_simd {
+
+#ifdef BB_SHA256_X86_KERNELS
+namespace {
+alignas(64) constexpr uint32_t round_constants[64]{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+__attribute__((target("avx2"))) inline __m256i ror_x8(__m256i x, int shift)
+{
+    return _mm256_or_si256(_mm256_srli_epi32(x, shift), _mm256_slli_epi32(x, 32 - shift));
+}
+} // namespace
+
+bool has_sha_ni()
+{
+    return get_cpu_features().sha;
+}
+
+bool has_avx2()
+{
+    return get_cpu_features().avx2;
+}
+
+/**
+ * @details The SHA extensions operate on the state split as (A, B, E, F) and (C, D, G, H). Each sha256rnds2 performs
+ * two rounds, each quad-round consumes four message words which are expanded four at a time with sha256msg1/2.
+ */
+__attribute__((target("sha,sse4.1,ssse3"))) void compress_sha_ni(std::array<uint32_t, 8>& state,
+                                                                   const std::array<uint32_t, 16>* blocks,
+                                                                   size_t num_blocks)
+{
+    // Load the state as ABEF / CDGH
+    __m128i tmp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0]));     // DCBA
+    __m128i state_1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4])); // HGFE
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);                                             // CDAB
+    state_1 = _mm_shuffle_epi32(state_1, 0x1B);                                     // EFGH
+    __m128i state_0 = _mm_alignr_epi8(tmp, state_1, 8);                             // ABEF
+    state_1 = _mm_blend_epi16(state_1, tmp, 0xF0);                                  // CDGH
+
+    for (size_t block_idx = 0; block_idx < num_blocks; ++block_idx) {
+        const __m128i abef_save = state_0;
+        const __m128i cdgh_save = state_1;
+        const auto* words = reinterpret_cast<const __m128i*>(blocks[block_idx].data());
+
+        // Message schedule, four words at a time, as a rolling window of the last four quads
+        __m128i schedule[4]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        for (size_t quad = 0; quad < 16; ++quad) {
+            __m128i message;
+            if (quad < 4) {
+                message = _mm_loadu_si128(words + quad);
+            } else {
+                const __m128i& previous = schedule[(quad - 1) & 3];
+                message = _mm_sha256msg1_epu32(schedule[quad & 3], schedule[(quad - 3) & 3]);
+                message = _mm_add_epi32(message, _mm_alignr_epi8(previous, schedule[(quad - 2) & 3], 4));
+                message = _mm_sha256msg2_epu32(message, previous);
+            }
+            schedule[quad & 3] = message;
+
+            __m128i message_plus_constants =
+                _mm_add_epi32(message, _mm_load_si128(reinterpret_cast<const __m128i*>(&round_constants[quad * 4])));
+            state_1 = _mm_sha256rnds2_epu32(state_1, state_0, message_plus_constants);
+            message_plus_constants = _mm_shuffle_epi32(message_plus_constants, 0x0E);
+            state_0 = _mm_sha256rnds2_epu32(state_0, state_1, message_plus_constants);
+        }
+
+        state_0 = _mm_add_epi32(state_0, abef_save);
+        state_1 = _mm_add_epi32(state_1, cdgh_save);
+    }
+
+    // Store ABEF / CDGH back as ABCD / EFGH
+    tmp = _mm_shuffle_epi32(state_0, 0x1B);        // FEBA
+    state_1 = _mm_shuffle_epi32(state_1, 0xB1);    // DCHG
+    state_0 = _mm_blend_epi16(tmp, state_1, 0xF0); // DCBA
+    state_1 = _mm_alignr_epi8(state_1, tmp, 8);    // HGFE
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state_0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state_1);
+}
+
+/**
+ * @details Each 32-bit lane of a YMM register holds the corresponding word of a different (state, block) pair, so the
+ * scalar round function is applied to eight pairs at once.
+ */
+__attribute__((target("avx2"))) void compress_x8_avx2(std::array<uint32_t, 8>* const* states,
+                                                        const std::array<uint32_t, 16>* const* blocks)
+{
+    // Transpose the inputs into lanes
+    __m256i w[16]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    for (size_t i = 0; i < 16; ++i) {
+        w[i] = _mm256_setr_epi32(static_cast<int>((*blocks[0])[i]),
+                                 static_cast<int>((*blocks[1])[i]),
+                                 static_cast<int>((*blocks[2])[i]),
+                                 static_cast<int>((*blocks[3])[i]),
+                                 static_cast<int>((*blocks[4])[i]),
+                                 static_cast<int>((*blocks[5])[i]),
+                                 static_cast<int>((*blocks[6])[i]),
+                                 static_cast<int>((*blocks[7])[i]));
+    }
+    __m256i h_init[8]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    for (size_t i = 0; i < 8; ++i) {
+        h_init[i] = _mm256_setr_epi32(static_cast<int>((*states[0])[i]),
+                                      static_cast<int>((*states[1])[i]),
+                                      static_cast<int>((*states[2])[i]),
+                                      static_cast<int>((*states[3])[i]),
+                                      static_cast<int>((*states[4])[i]),
+                                      static_cast<int>((*states[5])[i]),
+                                      static_cast<int>((*states[6])[i]),
+                                      static_cast<int>((*states[7])[i]));
+    }
+
+    __m256i a = h_init[0];
+    __m256i b = h_init[1];
+    __m256i c = h_init[2];
+    __m256i d = h_init[3];
+    __m256i e = h_init[4];
+    __m256i f = h_init[5];
+    __m256i g = h_init[6];
+    __m256i h = h_init[7];
+
+    for (size_t i = 0; i < 64; ++i) {
+        // Extend the message schedule in place over a rolling window of 16 words
+        __m256i w_i;
+        if (i < 16) {
+            w_i = w[i];
+        } else {
+            const __m256i w_15 = w[(i - 15) & 15];
+            const __m256i w_2 = w[(i - 2) & 15];
+            const __m256i s0 =
+                _mm256_xor_si256(_mm256_xor_si256(ror_x8(w_15, 7), ror_x8(w_15, 18)), _mm256_srli_epi32(w_15, 3));
+            const __m256i s1 =
+                _mm256_xor_si256(_mm256_xor_si256(ror_x8(w_2, 17), ror_x8(w_2, 19)), _mm256_srli_epi32(w_2, 10));
+            w_i = _mm256_add_epi32(_mm256_add_epi32(w[i & 15], w[(i - 7) & 15]), _mm256_add_epi32(s0, s1));
+            w[i & 15] = w_i;
+        }
+
+        const __m256i S1 = _mm256_xor_si256(_mm256_xor_si256(ror_x8(e, 6), ror_x8(e, 11)), ror_x8(e, 25));
+        const __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+        const __m256i temp1 = _mm256_add_epi32(
+            _mm256_add_epi32(_mm256_add_epi32(h, S1), _mm256_add_epi32(ch, w_i)),
+            _mm256_set1_epi32(static_cast<int>(round_constants[i])));
+        const __m256i S0 = _mm256_xor_si256(_mm256_xor_si256(ror_x8(a, 2), ror_x8(a, 13)), ror_x8(a, 22));
+        const __m256i maj =
+            _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b))); // === majority
+        const __m256i temp2 = _mm256_add_epi32(S0, maj);
+
+        h = g;
+        g = f;
+        f = e;
+        e = _mm256_add_epi32(d, temp1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm256_add_epi32(temp1, temp2);
+    }
+
+    // Add into the previous states and transpose back
+    alignas(32) std::array<std::array<uint32_t, 8>, 8> result;
+    const __m256i words[8]{ a, b, c, d, e, f, g, h }; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    for (size_t i = 0; i < 8; ++i) {
+        _mm256_store_si256(reinterpret_cast<__m256i*>(result[i].data()), _mm256_add_epi32(words[i], h_init[i]));
+    }
+    for (size_t lane = 0; lane < AVX2_LANES; ++lane) {
+        for (size_t i = 0; i < 8; ++i) {
+            (*states[lane])[i] = result[i][lane];
+        }
+    }
+}
+#else
+bool has_sha_ni()
+{
+    return false;
+}
+
+bool has_avx2()
+{
+    return false;
+}
+
+void compress_sha_ni(std::array<uint32_t, 8>& /*unused*/,
+                     const std::array<uint32_t, 16>* /*unused*/,
+                     size_t /*unused*/)
+{
+    ASSERT(false);
+}
+
+void compress_x8_avx2(std::array<uint32_t, 8>* const* /*unused*/, const std::array<uint32_t, 16>* const* /*unused*/)
+{
+    ASSERT(false);
+}
+#endif
+
+} // namespace bb::crypto::sha256_simd
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Hand-vectorized SHA-256 compression kernels, used by the dispatching functions in sha256.hpp
+ * @details The kernels are compiled with per-function target attributes and must only be called when the corresponding
+ * has_* predicate holds. On platforms other than x86-64 the predicates are false.
+ */
+namespace bb::crypto::sha256_simd {
+
+// Number of independent blocks compressed at once by the AVX2 kernel
+constexpr size_t AVX2_LANES = 8;
+
+bool has_sha_ni();
+bool has_avx2();
+
+/**
+ * @brief Compress a sequence of blocks (given as big-endian words converted to host order) into a state with the SHA
+ * extensions
+ */
+void compress_sha_ni(std::array<uint32_t, 8>& state, const std::array<uint32_t, 16>* blocks, size_t num_blocks);
+
+/**
+ * @brief Compress AVX2_LANES independent blocks, one into each of AVX2_LANES independent states
+ */
+void compress_x8_avx2(std::array<uint32_t, 8>* const* states, const std::array<uint32_t, 16>* const* blocks);
+
+} // namespace bb::crypto::sha256_simd
@@ -260,6 +260,9 @@ void process_plonk_recursion_constraints(Builder& builder,
     // the proof we are verifying contains a recursive proof itself
     auto proof_size_no_pub_inputs = recursion_proof_size_without_public_inputs();
 
+    // The in-circuit verification keys, shared by the constraints verifying proofs against the same key witnesses
+    RecursionKeyCache key_cache;
+
     // Add recursion constraints
     for (size_t constraint_idx = 0; constraint_idx < constraint_system.recursion_constraints.size(); ++constraint_idx) {
         auto constraint = constraint_system.recursion_constraints[constraint_idx];
@@ -301,7 +304,8 @@ void process_plonk_recursion_constraints(Builder& builder,
                                                                          constraint,
                                                                          current_input_aggregation_object,
                                                                          nested_aggregation_object,
-                                                                         has_valid_witness_assignments);
+                                                                         has_valid_witness_assignments,
+                                                                         &key_cache);
         current_input_aggregation_object = current_output_aggregation_object;
         gate_counter.track_diff(constraint_system.gates_per_opcode,
                                 constraint_system.original_opcode_indices.recursion_constraints[constraint_idx]);
@@ -331,6 +335,8 @@ void process_honk_recursion_constraints(Builder& builder,
 {
     AggregationObjectIndices current_aggregation_object =
         stdlib::recursion::init_default_agg_obj_indices<Builder>(builder);
+    // The in-circuit verification keys, shared by the constraints verifying proofs against the same key witnesses
+    HonkRecursionKeyCache key_cache;
 
     // Add recursion constraints
     for (size_t i = 0; i < constraint_system.honk_recursion_constraints.size(); ++i) {
@@ -350,7 +356,7 @@ void process_honk_recursion_constraints(Builder& builder,
             constraint.proof.begin() +
                 static_cast<std::ptrdiff_t>(HONK_RECURSION_PUBLIC_INPUT_OFFSET + bb::AGGREGATION_OBJECT_SIZE));
         current_aggregation_object = create_honk_recursion_constraints(
-            builder, constraint, current_aggregation_object, has_valid_witness_assignments);
+            builder, constraint, current_aggregation_object, has_valid_witness_assignments, &key_cache);
         gate_counter.track_diff(constraint_system.gates_per_opcode,
                                 constraint_system.original_opcode_indices.honk_recursion_constraints.at(i));
     }
@@ -428,6 +434,7 @@ MegaCircuitBuilder create_circuit(AcirFormat& constraint_system,
     return builder;
 };
 
+template void build_constraints<UltraCircuitBuilder>(UltraCircuitBuilder&, AcirFormat&, bool, bool, bool);
 template void build_constraints<MegaCircuitBuilder>(MegaCircuitBuilder&, AcirFormat&, bool, bool, bool);
 
 } // namespace acir_format
@@ -1,6 +1,9 @@
 #include "acir_to_constraint_buf.hpp"
 #include "barretenberg/common/container.hpp"
+#include <algorithm>
 #include <cstddef>
+#include <limits>
+#include <span>
 #include <tuple>
 #include <utility>
 #ifndef __wasm__
@@ -557,6 +560,63 @@ void handle_memory_op(Program::Opcode::MemoryOp const& mem_op, BlockConstraint&
     block.trace.push_back(acir_mem_op);
 }
 
+// Map to a pair of: BlockConstraint, and list of opcodes associated with that BlockConstraint
+using BlockConstraints = std::unordered_map<uint32_t, std::pair<BlockConstraint, std::vector<size_t>>>;
+
+/**
+ * @brief Converts an opcode of an ACIR circuit and adds the resulting constraints to the AcirFormat
+ *
+ * @param block_id_to_block_constraint The memory blocks of the circuit, which are only added to the AcirFormat once all
+ * the opcodes have been converted (see add_block_constraints)
+ */
+void handle_opcode(Program::Opcode const& opcode,
+                   AcirFormat& af,
+                   BlockConstraints& block_id_to_block_constraint,
+                   bool honk_recursion,
+                   size_t opcode_index)
+{
+    std::visit(
+        [&](auto&& arg) {
+            using T = std::decay_t<decltype(arg)>;
+            if constexpr (std::is_same_v<T, Program::Opcode::AssertZero>) {
+                handle_arithmetic(arg, af, opcode_index);
+            } else if constexpr (std::is_same_v<T, Program::Opcode::BlackBoxFuncCall>) {
+                handle_blackbox_func_call(arg, af, honk_recursion, opcode_index);
+            } else if constexpr (std::is_same_v<T, Program::Opcode::MemoryInit>) {
+                auto block = handle_memory_init(arg);
+                uint32_t block_id = arg.block_id.value;
+                std::vector<size_t> opcode_indices = { opcode_index };
+                block_id_to_block_constraint[block_id] = std::make_pair(block, opcode_indices);
+            } else if constexpr (std::is_same_v<T, Program::Opcode::MemoryOp>) {
+                auto block = block_id_to_block_constraint.find(arg.block_id.value);
+                if (block == block_id_to_block_constraint.end()) {
+                    throw_or_abort("unitialized MemoryOp");
+                }
+                handle_memory_op(arg, block->second.first);
+                block->second.second.push_back(opcode_index);
+            }
+        },
+        opcode.value);
+}
+
+void add_block_constraints(AcirFormat& af, BlockConstraints const& block_id_to_block_constraint)
+{
+    for (const auto& [block_id, block] : block_id_to_block_constraint) {
+        // Note: the trace will always be empty for ReturnData since it cannot be explicitly read from in noir
+        if (!block.first.trace.empty() || block.first.type == BlockType::ReturnData) {
+            af.block_constraints.push_back(block.first);
+            af.original_opcode_indices.block_constraints.push_back(block.second);
+        }
+    }
+}
+
+std::vector<uint32_t> get_public_inputs(Program::PublicInputs const& public_parameters,
+                                        Program::PublicInputs const& return_values)
+{
+    return join({ map(public_parameters.value, [](auto e) { return e.value; }),
+                  map(return_values.value, [](auto e) { return e.value; }) });
+}
+
 AcirFormat circuit_serde_to_acir_format(Program::Circuit const& circuit, bool honk_recursion)
 {
     AcirFormat af;
@@ -564,53 +624,100 @@ AcirFormat circuit_serde_to_acir_format(Program::Circuit const& circuit, bool ho
     af.varnum = circuit.current_witness_index + 1;
     af.recursive = circuit.recursive;
     af.num_acir_opcodes = static_cast<uint32_t>(circuit.opcodes.size());
-    af.public_inputs = join({ map(circuit.public_parameters.value, [](auto e) { return e.value; }),
-                              map(circuit.return_values.value, [](auto e) { return e.value; }) });
-    // Map to a pair of: BlockConstraint, and list of opcodes associated with that BlockConstraint
-    std::unordered_map<uint32_t, std::pair<BlockConstraint, std::vector<size_t>>> block_id_to_block_constraint;
+    af.public_inputs = get_public_inputs(circuit.public_parameters, circuit.return_values);
+    BlockConstraints block_id_to_block_constraint;
     for (size_t i = 0; i < circuit.opcodes.size(); ++i) {
-        auto gate = circuit.opcodes[i];
-        std::visit(
-            [&](auto&& arg) {
-                using T = std::decay_t<decltype(arg)>;
-                if constexpr (std::is_same_v<T, Program::Opcode::AssertZero>) {
-                    handle_arithmetic(arg, af, i);
-                } else if constexpr (std::is_same_v<T, Program::Opcode::BlackBoxFuncCall>) {
-                    handle_blackbox_func_call(arg, af, honk_recursion, i);
-                } else if constexpr (std::is_same_v<T, Program::Opcode::MemoryInit>) {
-                    auto block = handle_memory_init(arg);
-                    uint32_t block_id = arg.block_id.value;
-                    std::vector<size_t> opcode_indices = { i };
-                    block_id_to_block_constraint[block_id] = std::make_pair(block, opcode_indices);
-                } else if constexpr (std::is_same_v<T, Program::Opcode::MemoryOp>) {
-                    auto block = block_id_to_block_constraint.find(arg.block_id.value);
-                    if (block == block_id_to_block_constraint.end()) {
-                        throw_or_abort("unitialized MemoryOp");
-                    }
-                    handle_memory_op(arg, block->second.first);
-                    block->second.second.push_back(i);
-                }
-            },
-            gate.value);
+        handle_opcode(circuit.opcodes[i], af, block_id_to_block_constraint, honk_recursion, i);
     }
-    for (const auto& [block_id, block] : block_id_to_block_constraint) {
-        // Note: the trace will always be empty for ReturnData since it cannot be explicitly read from in noir
-        if (!block.first.trace.empty() || block.first.type == BlockType::ReturnData) {
-            af.block_constraints.push_back(block.first);
-            af.original_opcode_indices.block_constraints.push_back(block.second);
-        }
+    add_block_constraints(af, block_id_to_block_constraint);
+    return af;
+}
+
+/**
+ * @brief Deserializes a `Program::Circuit` from a bincode buffer and converts it to an `AcirFormat` on the fly
+ *
+ * @details Equivalent to `circuit_serde_to_acir_format` applied to the deserialized circuit, without materializing
+ * the serde object tree of the whole circuit: each opcode is converted as soon as it has been read, so that a single
+ * deserialized opcode is alive at a time. The fields are read in the order of
+ * `serde::Deserializable<Program::Circuit>::deserialize`.
+ */
+AcirFormat deserialize_circuit(serde::BincodeDeserializer& deserializer, bool honk_recursion)
+{
+    using Circuit = Program::Circuit;
+    deserializer.increase_container_depth();
+
+    AcirFormat af;
+    // `varnum` is the true number of variables, thus we add one to the index which starts at zero
+    af.varnum = serde::Deserializable<decltype(Circuit::current_witness_index)>::deserialize(deserializer) + 1;
+
+    const size_t num_opcodes = deserializer.deserialize_len();
+    af.num_acir_opcodes = static_cast<uint32_t>(num_opcodes);
+    BlockConstraints block_id_to_block_constraint;
+    for (size_t i = 0; i < num_opcodes; ++i) {
+        const auto opcode = serde::Deserializable<Program::Opcode>::deserialize(deserializer);
+        handle_opcode(opcode, af, block_id_to_block_constraint, honk_recursion, i);
     }
+    add_block_constraints(af, block_id_to_block_constraint);
+
+    // The remaining fields are skipped, apart from the public inputs and the recursive flag
+    serde::Deserializable<decltype(Circuit::expression_width)>::deserialize(deserializer);
+    serde::Deserializable<decltype(Circuit::private_parameters)>::deserialize(deserializer);
+    using PublicInputs = Program::PublicInputs;
+    const auto public_parameters = serde::Deserializable<PublicInputs>::deserialize(deserializer);
+    const auto return_values = serde::Deserializable<PublicInputs>::deserialize(deserializer);
+    serde::Deserializable<decltype(Circuit::assert_messages)>::deserialize(deserializer);
+    af.recursive = serde::Deserializable<decltype(Circuit::recursive)>::deserialize(deserializer);
+    af.public_inputs = get_public_inputs(public_parameters, return_values);
+
+    deserializer.decrease_container_depth();
     return af;
 }
 
+/**
+ * @brief Deserializes the ACIR functions of a `Program::Program` from a bincode buffer, converting each of them to an
+ * `AcirFormat` on the fly (see deserialize_circuit)
+ *
+ * @param max_functions The number of functions to convert. The buffer is only checked to be fully consumed if all the
+ * functions of the program have been converted.
+ */
+std::vector<AcirFormat> deserialize_program(std::span<const uint8_t> buf,
+                                            bool honk_recursion,
+                                            size_t max_functions = std::numeric_limits<size_t>::max())
+{
+    // The deserializer reads the buffer in place, without copying it
+    serde::BincodeDeserializer deserializer(buf);
+    deserializer.increase_container_depth();
+
+    const size_t num_functions = deserializer.deserialize_len();
+    std::vector<AcirFormat> constraint_systems;
+    constraint_systems.reserve(std::min(num_functions, max_functions));
+    for (size_t i = 0; i < num_functions && i < max_functions; ++i) {
+        constraint_systems.emplace_back(deserialize_circuit(deserializer, honk_recursion));
+    }
+    if (num_functions > max_functions) {
+        return constraint_systems;
+    }
+
+    // The unconstrained functions are only read to check the validity of the buffer
+    serde::Deserializable<decltype(Program::Program::unconstrained_functions)>::deserialize(deserializer);
+    deserializer.decrease_container_depth();
+    if (deserializer.get_buffer_offset() < buf.size()) {
+        throw_or_abort("Some input bytes were not read");
+    }
+    return constraint_systems;
+}
+
 AcirFormat circuit_buf_to_acir_format(std::vector<uint8_t> const& buf, bool honk_recursion)
 {
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/927): Move to using just
     // `program_buf_to_acir_format` once Honk fully supports all ACIR test flows For now the backend still expects
     // to work with a single ACIR function
-    auto circuit = Program::Program::bincodeDeserialize(buf).functions[0];
+    auto constraint_systems = deserialize_program(buf, honk_recursion, /*max_functions=*/1);
+    if (constraint_systems.empty()) {
+        throw_or_abort("ACIR program without any function");
+    }
 
-    return circuit_serde_to_acir_format(circuit, honk_recursion);
+    return std::move(constraint_systems[0]);
 }
 
 /**
@@ -639,6 +746,33 @@ WitnessVector witness_map_to_witness_vector(WitnessStack::WitnessMap const& witn
     return wv;
 }
 
+/**
+ * @brief Deserializes a `WitnessMap` from a bincode buffer directly into a `WitnessVector`
+ *
+ * @details Equivalent to `witness_map_to_witness_vector` applied to the deserialized `WitnessMap`, without building
+ * the intermediate `std::map` of witness values.
+ */
+WitnessVector deserialize_witness_map(serde::BincodeDeserializer& deserializer)
+{
+    deserializer.increase_container_depth();
+
+    const size_t num_witnesses = deserializer.deserialize_len();
+    WitnessVector wv;
+    wv.reserve(num_witnesses);
+    for (size_t i = 0; i < num_witnesses; ++i) {
+        const uint32_t index = serde::Deserializable<WitnessStack::Witness>::deserialize(deserializer).value;
+        const fr value(uint256_t(deserializer.deserialize_str()));
+        // Unassigned witness indices are filled with the dummy value of zero, as in witness_map_to_witness_vector
+        if (index >= wv.size()) {
+            wv.resize(static_cast<size_t>(index) + 1, fr(0));
+        }
+        wv[index] = value;
+    }
+
+    deserializer.decrease_container_depth();
+    return wv;
+}
+
 /**
  * @brief Converts from the ACIR-native `WitnessMap` format to Barretenberg's internal `WitnessVector` format.
  *
@@ -652,33 +786,39 @@ WitnessVector witness_buf_to_witness_data(std::vector<uint8_t> const& buf)
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/927): Move to using just
     // `witness_buf_to_witness_stack` once Honk fully supports all ACIR test flows. For now the backend still
     // expects to work with the stop of the `WitnessStack`.
-    auto witness_stack = WitnessStack::WitnessStack::bincodeDeserialize(buf);
-    auto w = witness_stack.stack[witness_stack.stack.size() - 1].witness;
+    auto witness_stack = witness_buf_to_witness_stack(buf);
+    if (witness_stack.empty()) {
+        throw_or_abort("Empty witness stack");
+    }
 
-    return witness_map_to_witness_vector(w);
+    return std::move(witness_stack.back().second);
 }
 
 std::vector<AcirFormat> program_buf_to_acir_format(std::vector<uint8_t> const& buf, bool honk_recursion)
 {
-    auto program = Program::Program::bincodeDeserialize(buf);
-
-    std::vector<AcirFormat> constraint_systems;
-    constraint_systems.reserve(program.functions.size());
-    for (auto const& function : program.functions) {
-        constraint_systems.emplace_back(circuit_serde_to_acir_format(function, honk_recursion));
-    }
-
-    return constraint_systems;
+    return deserialize_program(buf, honk_recursion);
 }
 
 WitnessVectorStack witness_buf_to_witness_stack(std::vector<uint8_t> const& buf)
 {
-    auto witness_stack = WitnessStack::WitnessStack::bincodeDeserialize(buf);
+    // The deserializer reads the buffer in place, without copying it
+    serde::BincodeDeserializer deserializer(buf);
+    deserializer.increase_container_depth();
+
+    const size_t stack_size = deserializer.deserialize_len();
     WitnessVectorStack witness_vector_stack;
-    witness_vector_stack.reserve(witness_stack.stack.size());
-    for (auto const& stack_item : witness_stack.stack) {
-        witness_vector_stack.emplace_back(
-            std::make_pair(stack_item.index, witness_map_to_witness_vector(stack_item.witness)));
+    witness_vector_stack.reserve(stack_size);
+    for (size_t i = 0; i < stack_size; ++i) {
+        // The fields of a `WitnessStack::StackItem`
+        deserializer.increase_container_depth();
+        const auto index = serde::Deserializable<decltype(WitnessStack::StackItem::index)>::deserialize(deserializer);
+        witness_vector_stack.emplace_back(index, deserialize_witness_map(deserializer));
+        deserializer.decrease_container_depth();
+    }
+
+    deserializer.decrease_container_depth();
+    if (deserializer.get_buffer_offset() < buf.size()) {
+        throw_or_abort("Some input bytes were not read");
     }
     return witness_vector_stack;
 }
@@ -4,8 +4,12 @@
 
 namespace acir_format {
 
+AcirFormat circuit_serde_to_acir_format(Program::Circuit const& circuit, bool honk_recursion);
+
 AcirFormat circuit_buf_to_acir_format(std::vector<uint8_t> const& buf, bool honk_recursion);
 
+WitnessVector witness_map_to_witness_vector(WitnessStack::WitnessMap const& witness_map);
+
 /**
  * @brief Converts from the ACIR-native `WitnessMap` format to Barretenberg's internal `WitnessVector` format.
  *
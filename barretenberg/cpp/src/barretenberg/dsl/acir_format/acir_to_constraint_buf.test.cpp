@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include "acir_to_constraint_buf.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+using namespace bb;
+using namespace acir_format;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+// ACIR field elements are serialized as 64 hex digits
+std::string field_element(uint64_t value)
+{
+    std::ostringstream os;
+    os << std::hex << std::setfill('0') << std::setw(64) << value;
+    return os.str();
+}
+
+Program::Witness witness(uint32_t index)
+{
+    return { .value = index };
+}
+
+Program::Expression expression(std::vector<std::tuple<std::string, Program::Witness, Program::Witness>> mul_terms,
+                               std::vector<std::tuple<std::string, Program::Witness>> linear_combinations,
+                               uint64_t q_c)
+{
+    return { .mul_terms = std::move(mul_terms),
+             .linear_combinations = std::move(linear_combinations),
+             .q_c = field_element(q_c) };
+}
+
+/**
+ * @brief An ACIR circuit with arithmetic, range and memory opcodes
+ */
+Program::Circuit circuit(uint32_t num_witnesses)
+{
+    std::vector<Program::Opcode> opcodes;
+    for (uint32_t i = 0; i + 2 < num_witnesses; ++i) {
+        // w_i * w_{i+1} + 2 * w_{i+2} + 3 = 0
+        auto mul_add = expression({ { field_element(1), witness(i), witness(i + 1) } },
+                                  { { field_element(2), witness(i + 2) } },
+                                  3);
+        opcodes.push_back({ Program::Opcode::AssertZero{ mul_add } });
+        // w_i + w_{i+1} + w_{i+2} + w_{i+3} = 0, which needs a width-4 gate
+        if (i + 3 < num_witnesses) {
+            opcodes.push_back({ Program::Opcode::AssertZero{ expression({},
+                                                                        { { field_element(1), witness(i) },
+                                                                          { field_element(1), witness(i + 1) },
+                                                                          { field_element(1), witness(i + 2) },
+                                                                          { field_element(1), witness(i + 3) } },
+                                                                        0) } });
+        }
+        Program::FunctionInput input{ .input = { Program::ConstantOrWitnessEnum::Witness{ witness(i) } },
+                                      .num_bits = 32 };
+        opcodes.push_back({ Program::Opcode::BlackBoxFuncCall{ { Program::BlackBoxFuncCall::RANGE{ input } } } });
+    }
+
+    // A ROM block of the first witnesses, read at a constant index
+    opcodes.push_back({ Program::Opcode::MemoryInit{ .block_id = { 0 },
+                                                     .init = { witness(0), witness(1), witness(2) },
+                                                     .block_type = { Program::BlockType::Memory{} } } });
+    opcodes.push_back(
+        { Program::Opcode::MemoryOp{ .block_id = { 0 },
+                                     .op = { .operation = expression({}, {}, 0),
+                                             .index = expression({}, {}, 1),
+                                             .value = expression({}, { { field_element(1), witness(3) } }, 0) },
+                                     .predicate = std::nullopt } });
+
+    return { .current_witness_index = num_witnesses - 1,
+             .opcodes = std::move(opcodes),
+             .expression_width = { Program::ExpressionWidth::Bounded{ 4 } },
+             .private_parameters = { witness(1) },
+             .public_parameters = { { witness(0) } },
+             .return_values = { { witness(num_witnesses - 1) } },
+             .assert_messages = {},
+             .recursive = false };
+}
+
+WitnessStack::WitnessMap witness_map(uint32_t num_witnesses)
+{
+    WitnessStack::WitnessMap witness_map;
+    for (uint32_t i = 0; i < num_witnesses; ++i) {
+        // Leave some of the witnesses unassigned
+        if (engine.get_random_uint8() % 4 != 0) {
+            witness_map.value[{ i }] = field_element(engine.get_random_uint64());
+        }
+    }
+    return witness_map;
+}
+
+// AcirFormat equality is not usable as some constraint types do not define it, so the fields produced by the opcodes
+// of the circuits above are compared one by one
+void expect_equal(AcirFormat const& lhs, AcirFormat const& rhs)
+{
+    EXPECT_EQ(lhs.varnum, rhs.varnum);
+    EXPECT_EQ(lhs.recursive, rhs.recursive);
+    EXPECT_EQ(lhs.num_acir_opcodes, rhs.num_acir_opcodes);
+    EXPECT_EQ(lhs.public_inputs, rhs.public_inputs);
+    EXPECT_EQ(lhs.range_constraints, rhs.range_constraints);
+    EXPECT_EQ(lhs.poly_triple_constraints, rhs.poly_triple_constraints);
+    ASSERT_EQ(lhs.quad_constraints.size(), rhs.quad_constraints.size());
+    for (size_t i = 0; i < lhs.quad_constraints.size(); ++i) {
+        const auto& [a, b, c, d, q_m, q_1, q_2, q_3, q_4, q_c] = lhs.quad_constraints[i];
+        const auto& expected = rhs.quad_constraints[i];
+        EXPECT_EQ(std::tie(a, b, c, d), std::tie(expected.a, expected.b, expected.c, expected.d));
+        EXPECT_EQ(std::tie(q_m, q_1, q_2, q_3, q_4, q_c),
+                  std::tie(expected.mul_scaling,
+                           expected.a_scaling,
+                           expected.b_scaling,
+                           expected.c_scaling,
+                           expected.d_scaling,
+                           expected.const_scaling));
+    }
+    ASSERT_EQ(lhs.block_constraints.size(), rhs.block_constraints.size());
+    for (size_t i = 0; i < lhs.block_constraints.size(); ++i) {
+        const auto& block = lhs.block_constraints[i];
+        const auto& expected = rhs.block_constraints[i];
+        EXPECT_EQ(block.init, expected.init);
+        EXPECT_EQ(block.type, expected.type);
+        ASSERT_EQ(block.trace.size(), expected.trace.size());
+        for (size_t j = 0; j < block.trace.size(); ++j) {
+            EXPECT_EQ(block.trace[j].access_type, expected.trace[j].access_type);
+            EXPECT_EQ(block.trace[j].index, expected.trace[j].index);
+            EXPECT_EQ(block.trace[j].value, expected.trace[j].value);
+        }
+    }
+    EXPECT_EQ(lhs.original_opcode_indices, rhs.original_opcode_indices);
+}
+
+} // namespace
+
+class AcirToConstraintBufTests : public ::testing::Test {};
+
+TEST_F(AcirToConstraintBufTests, ProgramMatchesSerdeConversion)
+{
+    Program::Program program{ .functions = { circuit(16), circuit(5) }, .unconstrained_functions = {} };
+    const auto buf = program.bincodeSerialize();
+
+    const auto constraint_systems = program_buf_to_acir_format(buf, /*honk_recursion=*/false);
+    ASSERT_EQ(constraint_systems.size(), program.functions.size());
+    for (size_t i = 0; i < program.functions.size(); ++i) {
+        auto expected = circuit_serde_to_acir_format(program.functions[i], /*honk_recursion=*/false);
+        expect_equal(constraint_systems[i], expected);
+    }
+    EXPECT_EQ(constraint_systems[0].public_inputs, std::vector<uint32_t>({ 0, 15 }));
+    EXPECT_EQ(constraint_systems[0].block_constraints.size(), 1);
+
+    expect_equal(circuit_buf_to_acir_format(buf, /*honk_recursion=*/false), constraint_systems[0]);
+}
+
+TEST_F(AcirToConstraintBufTests, WitnessStackMatchesSerdeConversion)
+{
+    WitnessStack::WitnessStack witness_stack{ .stack = { { .index = 0, .witness = witness_map(100) },
+                                                         { .index = 1, .witness = witness_map(10) } } };
+    const auto buf = witness_stack.bincodeSerialize();
+
+    const auto witness_vector_stack = witness_buf_to_witness_stack(buf);
+    ASSERT_EQ(witness_vector_stack.size(), witness_stack.stack.size());
+    for (size_t i = 0; i < witness_stack.stack.size(); ++i) {
+        EXPECT_EQ(witness_vector_stack[i].first, witness_stack.stack[i].index);
+        EXPECT_EQ(witness_vector_stack[i].second, witness_map_to_witness_vector(witness_stack.stack[i].witness));
+    }
+
+    EXPECT_EQ(witness_buf_to_witness_data(buf), witness_vector_stack.back().second);
+}
+
+TEST_F(AcirToConstraintBufTests, TrailingBytesAreRejected)
+{
+    Program::Program program{ .functions = { circuit(8) }, .unconstrained_functions = {} };
+    auto program_buf = program.bincodeSerialize();
+    program_buf.push_back(0);
+    EXPECT_ANY_THROW(program_buf_to_acir_format(program_buf, /*honk_recursion=*/false));
+
+    WitnessStack::WitnessStack witness_stack{ .stack = { { .index = 0, .witness = witness_map(8) } } };
+    auto witness_buf = witness_stack.bincodeSerialize();
+    witness_buf.push_back(0);
+    EXPECT_ANY_THROW(witness_buf_to_witness_stack(witness_buf));
+}
@@ -0,0 +1,79 @@
+#include "cached_circuit.hpp"
+#include "barretenberg/stdlib/primitives/circuit_builders/circuit_builders.hpp"
+#include "barretenberg/stdlib_circuit_builders/mega_circuit_builder.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+
+namespace acir_format {
+
+using namespace bb;
+
+namespace {
+
+/**
+ * @brief Construct a builder from the witness and public input data of an ACIR program, as create_circuit does
+ */
+template <typename Builder>
+Builder construct_builder(AcirFormat const& constraint_system,
+                          WitnessVector const& witness,
+                          std::shared_ptr<ECCOpQueue> op_queue)
+{
+    if constexpr (IsMegaBuilder<Builder>) {
+        return Builder{ op_queue, witness, constraint_system.public_inputs, constraint_system.varnum };
+    } else {
+        return Builder{ /*size_hint=*/0,
+                        witness,
+                        constraint_system.public_inputs,
+                        constraint_system.varnum,
+                        constraint_system.recursive };
+    }
+}
+
+} // namespace
+
+template <typename Builder>
+CachedCircuit<Builder>::CachedCircuit(AcirFormat constraint_system, bool honk_recursion)
+    : honk_recursion(honk_recursion)
+{
+    // Build the full circuit once without witness, as done for the computation of the verification key
+    Builder builder = construct_builder<Builder>(constraint_system, {}, std::make_shared<ECCOpQueue>());
+    const size_t start = builder.blocks.arithmetic.size();
+    build_constraints(builder, constraint_system, /*has_valid_witness_assignments=*/false, honk_recursion);
+
+    // Each AssertZero opcode yields exactly one arithmetic gate, added before any other constraint
+    const size_t num_assert_zero_gates =
+        constraint_system.poly_triple_constraints.size() + constraint_system.quad_constraints.size();
+    recorded_gates.append_gates(builder.blocks.arithmetic, start, start + num_assert_zero_gates);
+
+    for (auto& block : builder.blocks.get()) {
+        block_sizes.push_back(block.size());
+    }
+
+    remaining_constraints = std::move(constraint_system);
+    remaining_constraints.poly_triple_constraints.clear();
+    remaining_constraints.quad_constraints.clear();
+}
+
+template <typename Builder>
+Builder CachedCircuit<Builder>::create_circuit(WitnessVector const& witness, std::shared_ptr<ECCOpQueue> op_queue)
+{
+    Builder builder = construct_builder<Builder>(remaining_constraints, witness, op_queue);
+
+    // The final block sizes are known from the recording, so the gates are added without any reallocation
+    size_t block_idx = 0;
+    for (auto& block : builder.blocks.get()) {
+        block.reserve(block_sizes[block_idx++]);
+    }
+
+    builder.blocks.arithmetic.append_gates(recorded_gates, 0, recorded_gates.size());
+    builder.num_gates += recorded_gates.size();
+
+    bool has_valid_witness_assignments = !witness.empty();
+    build_constraints(builder, remaining_constraints, has_valid_witness_assignments, honk_recursion);
+
+    return builder;
+}
+
+template class CachedCircuit<UltraCircuitBuilder>;
+template class CachedCircuit<MegaCircuitBuilder>;
+
+} // namespace acir_format
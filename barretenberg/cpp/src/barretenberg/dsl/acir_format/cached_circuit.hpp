@@ -0,0 +1,43 @@
+#pragma once
+#include "acir_format.hpp"
+#include <type_traits>
+#include <vector>
+
+namespace acir_format {
+
+/**
+ * @brief The circuit structure of an ACIR program, recorded once to construct the circuits of many of its witnesses
+ *
+ * @details An ACIR program proven many times with different witnesses yields the same gates each time. The gates of
+ * its AssertZero opcodes (poly_triple_constraints and quad_constraints) only refer to ACIR witnesses, which the builder
+ * creates in its constructor, and are the first ones added by build_constraints. They are recorded once, together with
+ * the block sizes of the full circuit, and then replayed for each witness by appending them in bulk to blocks reserved
+ * to their final size. Only the remaining constraints, whose gadgets compute internal witnesses, are built again.
+ *
+ * The resulting builder is identical to the one returned by create_circuit for the same program and witness, so it
+ * can be passed as is to the prover (whose precomputed polynomials are cached across circuits of the same structure).
+ *
+ * @tparam Builder UltraCircuitBuilder or MegaCircuitBuilder
+ */
+template <typename Builder> class CachedCircuit {
+  public:
+    explicit CachedCircuit(AcirFormat constraint_system, bool honk_recursion = false);
+
+    Builder create_circuit(WitnessVector const& witness = {},
+                           std::shared_ptr<bb::ECCOpQueue> op_queue = std::make_shared<bb::ECCOpQueue>());
+
+    size_t get_num_recorded_gates() const { return recorded_gates.size(); }
+
+  private:
+    using Block = std::remove_cvref_t<decltype(std::declval<Builder&>().blocks.arithmetic)>;
+
+    // The constraints built for each witness, i.e. all but the AssertZero ones
+    AcirFormat remaining_constraints;
+    bool honk_recursion;
+    // The arithmetic gates of the AssertZero opcodes
+    Block recorded_gates;
+    // The size of each block of the recorded circuit, in the order of blocks.get()
+    std::vector<size_t> block_sizes;
+};
+
+} // namespace acir_format
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "acir_format.hpp"
+#include "acir_format_mocks.hpp"
+#include "barretenberg/circuit_checker/circuit_checker.hpp"
+#include "barretenberg/stdlib_circuit_builders/mega_circuit_builder.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "cached_circuit.hpp"
+
+using namespace bb;
+using namespace acir_format;
+
+namespace {
+
+/**
+ * @brief A program of AssertZero opcodes (a + b = c, a * b + d = e) followed by range and logic constraints
+ */
+AcirFormat program()
+{
+    poly_triple sum{
+        .a = 1,
+        .b = 2,
+        .c = 3,
+        .q_m = 0,
+        .q_l = 1,
+        .q_r = 1,
+        .q_o = -1,
+        .q_c = 0,
+    };
+    mul_quad_<fr> mul_add{
+        .a = 1,
+        .b = 2,
+        .c = 4,
+        .d = 5,
+        .mul_scaling = 1,
+        .a_scaling = 0,
+        .b_scaling = 0,
+        .c_scaling = 1,
+        .d_scaling = -1,
+        .const_scaling = 0,
+    };
+    RangeConstraint range{ .witness = 3, .num_bits = 33 };
+    LogicConstraint logic{
+        .a = WitnessOrConstant<fr>::from_index(1),
+        .b = WitnessOrConstant<fr>::from_index(2),
+        .result = 6,
+        .num_bits = 32,
+        .is_xor_gate = 1,
+    };
+
+    AcirFormat constraint_system{
+        .varnum = 7,
+        .recursive = false,
+        .num_acir_opcodes = 4,
+        .public_inputs = { 1 },
+        .logic_constraints = { logic },
+        .range_constraints = { range },
+        .aes128_constraints = {},
+        .sha256_constraints = {},
+        .sha256_compression = {},
+        .schnorr_constraints = {},
+        .ecdsa_k1_constraints = {},
+        .ecdsa_r1_constraints = {},
+        .blake2s_constraints = {},
+        .blake3_constraints = {},
+        .keccak_constraints = {},
+        .keccak_permutations = {},
+        .pedersen_constraints = {},
+        .pedersen_hash_constraints = {},
+        .poseidon2_constraints = {},
+        .multi_scalar_mul_constraints = {},
+        .ec_add_constraints = {},
+        .recursion_constraints = {},
+        .honk_recursion_constraints = {},
+        .bigint_from_le_bytes_constraints = {},
+        .bigint_to_le_bytes_constraints = {},
+        .bigint_operations = {},
+        .poly_triple_constraints = { sum },
+        .quad_constraints = { mul_add },
+        .block_constraints = {},
+        .original_opcode_indices = create_empty_original_opcode_indices(),
+    };
+    mock_opcode_indices(constraint_system);
+    return constraint_system;
+}
+
+// A valid witness of the program for the given values of a, b and d
+WitnessVector witness(uint32_t a, uint32_t b, uint32_t d)
+{
+    return { fr(0), fr(a), fr(b), fr(a) + fr(b), fr(d), fr(a) * fr(b) + fr(d), fr(a ^ b) };
+}
+
+} // namespace
+
+template <typename Builder> class AcirCachedCircuitTests : public ::testing::Test {};
+
+using BuilderTypes = testing::Types<UltraCircuitBuilder, MegaCircuitBuilder>;
+TYPED_TEST_SUITE(AcirCachedCircuitTests, BuilderTypes);
+
+TYPED_TEST(AcirCachedCircuitTests, ReplayMatchesDirectConstruction)
+{
+    using Builder = TypeParam;
+
+    CachedCircuit<Builder> cached_circuit(program());
+    EXPECT_EQ(cached_circuit.get_num_recorded_gates(), 2);
+
+    for (const auto& witness_values : { witness(3, 4, 5), witness(1234, 56789, 1), witness(0xffff, 0xfff0, 42) }) {
+        auto constraint_system = program();
+        auto expected = create_circuit<Builder>(constraint_system, /*size_hint=*/0, witness_values);
+        auto builder = cached_circuit.create_circuit(witness_values);
+
+        EXPECT_TRUE(CircuitChecker::check(builder));
+        EXPECT_EQ(builder.num_gates, expected.num_gates);
+        EXPECT_EQ(builder.get_num_variables(), expected.get_num_variables());
+        EXPECT_EQ(builder, expected);
+    }
+}
+
+TYPED_TEST(AcirCachedCircuitTests, ReplayWithoutWitness)
+{
+    using Builder = TypeParam;
+
+    CachedCircuit<Builder> cached_circuit(program());
+    auto constraint_system = program();
+    auto expected = create_circuit<Builder>(constraint_system);
+    auto builder = cached_circuit.create_circuit();
+
+    EXPECT_EQ(builder, expected);
+}
+
+TYPED_TEST(AcirCachedCircuitTests, InvalidWitnessFails)
+{
+    using Builder = TypeParam;
+
+    CachedCircuit<Builder> cached_circuit(program());
+    auto witness_values = witness(3, 4, 5);
+    witness_values[3] += 1; // a + b != c
+    auto builder = cached_circuit.create_circuit(witness_values);
+
+    EXPECT_FALSE(CircuitChecker::check(builder));
+}
@@ -16,24 +16,10 @@ using bn254 = stdlib::bn254<Builder>;
 using aggregation_state_ct = bb::stdlib::recursion::aggregation_state<bn254>;
 
 /**
- * @brief Creates a dummy vkey and proof object.
- * @details Populates the key and proof vectors with dummy values in the write_vk case when we don't have a valid
- * witness. The bulk of the logic is setting up certain values correctly like the circuit size, number of public inputs,
- * aggregation object, and commitments.
- *
- * @param builder
- * @param input
- * @param key_fields
- * @param proof_fields
+ * @brief Computes the log circuit size of the inner circuit from the size of its proof
  */
-void create_dummy_vkey_and_proof(Builder& builder,
-                                 const RecursionConstraint& input,
-                                 std::vector<field_ct>& key_fields,
-                                 std::vector<field_ct>& proof_fields)
+size_t log_circuit_size_from_proof_size(const RecursionConstraint& input)
 {
-    using Flavor = UltraRecursiveFlavor_<Builder>;
-
-    // Set vkey->circuit_size correctly based on the proof size
     size_t num_frs_comm = bb::field_conversion::calc_num_bn254_frs<UltraFlavor::Commitment>();
     size_t num_frs_fr = bb::field_conversion::calc_num_bn254_frs<UltraFlavor::FF>();
     assert((input.proof.size() - HONK_RECURSION_PUBLIC_INPUT_OFFSET - UltraFlavor::NUM_WITNESS_ENTITIES * num_frs_comm -
@@ -41,10 +27,28 @@ void create_dummy_vkey_and_proof(Builder& builder,
                (num_frs_comm + num_frs_fr * UltraFlavor::BATCHED_RELATION_PARTIAL_LENGTH) ==
            0);
     // Note: this computation should always result in log_circuit_size = CONST_PROOF_SIZE_LOG_N
-    auto log_circuit_size =
-        (input.proof.size() - HONK_RECURSION_PUBLIC_INPUT_OFFSET - UltraFlavor::NUM_WITNESS_ENTITIES * num_frs_comm -
-         UltraFlavor::NUM_ALL_ENTITIES * num_frs_fr - 2 * num_frs_comm) /
-        (num_frs_comm + num_frs_fr * UltraFlavor::BATCHED_RELATION_PARTIAL_LENGTH);
+    return (input.proof.size() - HONK_RECURSION_PUBLIC_INPUT_OFFSET -
+            UltraFlavor::NUM_WITNESS_ENTITIES * num_frs_comm - UltraFlavor::NUM_ALL_ENTITIES * num_frs_fr -
+            2 * num_frs_comm) /
+           (num_frs_comm + num_frs_fr * UltraFlavor::BATCHED_RELATION_PARTIAL_LENGTH);
+}
+
+/**
+ * @brief Creates a dummy vkey object.
+ * @details Populates the key vector with dummy values in the write_vk case when we don't have a valid witness. The bulk
+ * of the logic is setting up certain values correctly like the circuit size, number of public inputs, aggregation
+ * object, and commitments.
+ *
+ * @param builder
+ * @param input
+ * @param key_fields
+ */
+void create_dummy_vkey(Builder& builder, const RecursionConstraint& input, std::vector<field_ct>& key_fields)
+{
+    using Flavor = UltraRecursiveFlavor_<Builder>;
+
+    // Set vkey->circuit_size correctly based on the proof size
+    auto log_circuit_size = log_circuit_size_from_proof_size(input);
     // First key field is circuit size
     builder.assert_equal(builder.add_variable(1 << log_circuit_size), key_fields[0].witness_index);
     // Second key field is number of public inputs
@@ -71,8 +75,25 @@ void create_dummy_vkey_and_proof(Builder& builder,
         builder.assert_equal(builder.add_variable(frs[3]), key_fields[offset + 3].witness_index);
         offset += 4;
     }
+}
+
+/**
+ * @brief Creates a dummy proof object.
+ * @details Populates the proof vector with dummy values in the write_vk case when we don't have a valid witness, in a
+ * shape consistent with the dummy vkey: circuit size, number of public inputs, aggregation object and commitments.
+ *
+ * @param builder
+ * @param input
+ * @param proof_fields
+ */
+void create_dummy_proof(Builder& builder, const RecursionConstraint& input, std::vector<field_ct>& proof_fields)
+{
+    using Flavor = UltraRecursiveFlavor_<Builder>;
 
-    offset = HONK_RECURSION_PUBLIC_INPUT_OFFSET;
+    auto log_circuit_size = log_circuit_size_from_proof_size(input);
+    size_t num_inner_public_inputs = input.public_inputs.size() - bb::AGGREGATION_OBJECT_SIZE;
+
+    uint32_t offset = HONK_RECURSION_PUBLIC_INPUT_OFFSET;
     // first 3 things
     builder.assert_equal(builder.add_variable(1 << log_circuit_size), proof_fields[0].witness_index);
     builder.assert_equal(builder.add_variable(input.public_inputs.size()), proof_fields[1].witness_index);
@@ -144,6 +165,8 @@ void create_dummy_vkey_and_proof(Builder& builder,
  * @param input
  * @param input_aggregation_object_indices. The aggregation object coming from previous Honk recursion constraints.
  * @param has_valid_witness_assignment. Do we have witnesses or are we just generating keys?
+ * @param key_cache. The in-circuit keys of the previous Honk recursion constraints, to reuse if their key fields are
+ * those of this constraint
  *
  * @note We currently only support HonkRecursionConstraint where inner_proof_contains_recursive_proof = false.
  *       We would either need a separate ACIR opcode where inner_proof_contains_recursive_proof = true,
@@ -152,7 +175,8 @@ void create_dummy_vkey_and_proof(Builder& builder,
 AggregationObjectIndices create_honk_recursion_constraints(Builder& builder,
                                                            const RecursionConstraint& input,
                                                            AggregationObjectIndices input_aggregation_object_indices,
-                                                           bool has_valid_witness_assignments)
+                                                           bool has_valid_witness_assignments,
+                                                           HonkRecursionKeyCache* key_cache)
 {
     using Flavor = UltraRecursiveFlavor_<Builder>;
     using RecursiveVerificationKey = Flavor::VerificationKey;
@@ -160,14 +184,25 @@ AggregationObjectIndices create_honk_recursion_constraints(Builder& builder,
 
     ASSERT(input.proof_type == HONK_RECURSION);
 
+    // Proofs verified against the same key witnesses share a single in-circuit key, which is then already populated
+    std::shared_ptr<RecursiveVerificationKey> vkey;
+    if (key_cache != nullptr) {
+        auto cached_key = key_cache->find(input.key);
+        if (cached_key != key_cache->end()) {
+            vkey = cached_key->second;
+        }
+    }
+
     // Construct an in-circuit representation of the verification key.
     // For now, the v-key is a circuit constant and is fixed for the circuit.
     // (We may need a separate recursion opcode for this to vary, or add more config witnesses to this opcode)
     std::vector<field_ct> key_fields;
-    key_fields.reserve(input.key.size());
-    for (const auto& idx : input.key) {
-        auto field = field_ct::from_witness_index(&builder, idx);
-        key_fields.emplace_back(field);
+    if (vkey == nullptr) {
+        key_fields.reserve(input.key.size());
+        for (const auto& idx : input.key) {
+            auto field = field_ct::from_witness_index(&builder, idx);
+            key_fields.emplace_back(field);
+        }
     }
 
     std::vector<field_ct> proof_fields;
@@ -190,10 +225,18 @@ AggregationObjectIndices create_honk_recursion_constraints(Builder& builder,
     // Populate the key fields and proof fields with dummy values to prevent issues (usually with points not being on
     // the curve).
     if (!has_valid_witness_assignments) {
-        create_dummy_vkey_and_proof(builder, input, key_fields, proof_fields);
+        if (vkey == nullptr) {
+            create_dummy_vkey(builder, input, key_fields);
+        }
+        create_dummy_proof(builder, input, proof_fields);
+    }
+    if (vkey == nullptr) {
+        vkey = std::make_shared<RecursiveVerificationKey>(builder, key_fields);
+        if (key_cache != nullptr) {
+            key_cache->emplace(input.key, vkey);
+        }
     }
     // Recursively verify the proof
-    auto vkey = std::make_shared<RecursiveVerificationKey>(builder, key_fields);
     RecursiveVerifier verifier(&builder, vkey);
     aggregation_state_ct input_agg_obj = bb::stdlib::recursion::convert_witness_indices_to_agg_obj<Builder, bn254>(
         builder, input_aggregation_object_indices);
@@ -1,6 +1,8 @@
 #pragma once
 #include "barretenberg/dsl/acir_format/recursion_constraint.hpp"
 #include "barretenberg/stdlib/primitives/bigfield/bigfield.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_recursive_flavor.hpp"
+#include <map>
 #include <vector>
 
 namespace acir_format {
@@ -12,9 +14,20 @@ using namespace bb;
 // track of where the public inputs start.
 static constexpr size_t HONK_RECURSION_PUBLIC_INPUT_OFFSET = 3;
 
+/**
+ * @brief The in-circuit verification keys of the Honk recursion constraints of a circuit, by the witness indices of
+ * their key fields
+ * @details A kernel circuit commonly verifies several proofs against the same verification key witnesses. Converting
+ * these witnesses to an in-circuit key (whose commitments are non-native group elements) is then done once, and the key
+ * is shared by the recursive verifiers of all these proofs.
+ */
+using HonkRecursionKeyCache =
+    std::map<std::vector<uint32_t>, std::shared_ptr<UltraRecursiveFlavor_<Builder>::VerificationKey>>;
+
 AggregationObjectIndices create_honk_recursion_constraints(Builder& builder,
                                                            const RecursionConstraint& input,
                                                            AggregationObjectIndices input_aggregation_object,
-                                                           bool has_valid_witness_assignments = false);
+                                                           bool has_valid_witness_assignments = false,
+                                                           HonkRecursionKeyCache* key_cache = nullptr);
 
 } // namespace acir_format
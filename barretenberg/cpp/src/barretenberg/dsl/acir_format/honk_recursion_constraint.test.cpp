@@ -1,6 +1,7 @@
 #include "honk_recursion_constraint.hpp"
 #include "acir_format.hpp"
 #include "acir_format_mocks.hpp"
+#include "barretenberg/circuit_checker/circuit_checker.hpp"
 #include "barretenberg/sumcheck/instance/prover_instance.hpp"
 #include "barretenberg/ultra_honk/ultra_prover.hpp"
 #include "barretenberg/ultra_honk/ultra_verifier.hpp"
@@ -134,14 +135,21 @@ class AcirHonkRecursionConstraint : public ::testing::Test {
      * @brief Create a circuit that recursively verifies one or more inner circuits
      *
      * @param inner_circuits
+     * @param share_verification_key Whether the inner proofs, of circuits with the same verification key, are all
+     * verified against the key witnesses of the first one
+     * @param has_valid_witness_assignments Whether to build the circuit from the witness, or from the constraints only
+     * (as when writing the verification key)
      * @return Composer
      */
-    Builder create_outer_circuit(std::vector<Builder>& inner_circuits)
+    Builder create_outer_circuit(std::vector<Builder>& inner_circuits,
+                                 bool share_verification_key = false,
+                                 bool has_valid_witness_assignments = true)
     {
         std::vector<RecursionConstraint> honk_recursion_constraints;
 
         size_t witness_offset = 0;
         SlabVector<fr> witness;
+        std::vector<uint32_t> shared_key_indices;
 
         for (auto& inner_circuit : inner_circuits) {
 
@@ -195,9 +203,15 @@ class AcirHonkRecursionConstraint : public ::testing::Test {
                  ++i) { // goes over agg_obj_0, agg_obj_1, ..., agg_obj_15 and rest of proof
                 proof_indices.emplace_back(static_cast<uint32_t>(i + proof_indices_start_idx));
             }
-            const size_t key_size = key_witnesses.size();
-            for (size_t i = 0; i < key_size; ++i) {
-                key_indices.emplace_back(static_cast<uint32_t>(i + key_indices_start_idx));
+            if (share_verification_key && !shared_key_indices.empty()) {
+                key_indices = shared_key_indices;
+                key_witnesses.clear();
+            } else {
+                const size_t key_size = key_witnesses.size();
+                for (size_t i = 0; i < key_size; ++i) {
+                    key_indices.emplace_back(static_cast<uint32_t>(i + key_indices_start_idx));
+                }
+                shared_key_indices = key_indices;
             }
             // We keep the nested aggregation object attached to the proof,
             // thus we do not explicitly have to keep the public inputs while setting up the initial recursion
@@ -286,7 +300,10 @@ class AcirHonkRecursionConstraint : public ::testing::Test {
             .original_opcode_indices = create_empty_original_opcode_indices(),
         };
         mock_opcode_indices(constraint_system);
-        auto outer_circuit = create_circuit(constraint_system, /*size_hint*/ 0, witness, /*honk recursion*/ true);
+        auto outer_circuit = create_circuit(constraint_system,
+                                            /*size_hint*/ 0,
+                                            has_valid_witness_assignments ? witness : WitnessVector{},
+                                            /*honk recursion*/ true);
 
         return outer_circuit;
     }
@@ -420,3 +437,47 @@ TEST_F(AcirHonkRecursionConstraint, TestFullRecursiveComposition)
     Verifier verifier(verification_key);
     EXPECT_EQ(verifier.verify_proof(proof), true);
 }
+
+TEST_F(AcirHonkRecursionConstraint, TestHonkRecursionConstraintsWithSharedVerificationKey)
+{
+    std::vector<Builder> layer_1_circuits;
+    layer_1_circuits.push_back(create_inner_circuit());
+    layer_1_circuits.push_back(create_inner_circuit());
+
+    auto separate_keys_circuit = create_outer_circuit(layer_1_circuits);
+    auto layer_2_circuit = create_outer_circuit(layer_1_circuits, /*share_verification_key=*/true);
+
+    // The in-circuit key is constructed once for both proofs
+    info("circuit gates = ", layer_2_circuit.get_num_gates());
+    EXPECT_LT(layer_2_circuit.get_num_gates(), separate_keys_circuit.get_num_gates());
+
+    EXPECT_TRUE(CircuitChecker::check(layer_2_circuit));
+}
+
+/**
+ * @brief Check that a shared key is also reused when the circuit is built without a witness, e.g. to write the
+ * verification key, and that it then yields the gates of the circuit built from the witness
+ */
+TEST_F(AcirHonkRecursionConstraint, TestSharedVerificationKeyWithoutWitness)
+{
+    std::vector<Builder> layer_1_circuits;
+    layer_1_circuits.push_back(create_inner_circuit());
+    layer_1_circuits.push_back(create_inner_circuit());
+
+    auto separate_keys_circuit = create_outer_circuit(
+        layer_1_circuits, /*share_verification_key=*/false, /*has_valid_witness_assignments=*/false);
+    auto shared_key_circuit = create_outer_circuit(
+        layer_1_circuits, /*share_verification_key=*/true, /*has_valid_witness_assignments=*/false);
+    auto witness_circuit = create_outer_circuit(layer_1_circuits, /*share_verification_key=*/true);
+
+    EXPECT_LT(shared_key_circuit.get_num_gates(), separate_keys_circuit.get_num_gates());
+    EXPECT_EQ(shared_key_circuit.get_num_gates(), witness_circuit.get_num_gates());
+
+    // The selectors are those of the circuit built from the witness (unlike the wires, as the dummy proof and key values
+    // are added as new variables)
+    auto shared_key_blocks = shared_key_circuit.blocks.get();
+    auto witness_blocks = witness_circuit.blocks.get();
+    for (size_t i = 0; i < shared_key_blocks.size(); ++i) {
+        EXPECT_TRUE(shared_key_blocks[i].selectors == witness_blocks[i].selectors);
+    }
+}
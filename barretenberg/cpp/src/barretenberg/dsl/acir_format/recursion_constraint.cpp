@@ -34,6 +34,8 @@ void generate_dummy_proof() {}
  * @param builder
  * @param input
  * @tparam has_valid_witness_assignment. Do we have witnesses or are we just generating keys?
+ * @param key_cache. The in-circuit keys of the previous recursion constraints, to reuse if their key fields and nested
+ * aggregation object are those of this constraint
  * @tparam inner_proof_contains_recursive_proof. Do we expect the inner proof to also have performed recursive
  * verification? We need to know this at circuit-compile time.
  *
@@ -45,7 +47,8 @@ AggregationObjectIndices create_recursion_constraints(Builder& builder,
                                                       const RecursionConstraint& input,
                                                       const AggregationObjectIndices& input_aggregation_object,
                                                       const AggregationObjectIndices& nested_aggregation_object,
-                                                      bool has_valid_witness_assignments)
+                                                      bool has_valid_witness_assignments,
+                                                      RecursionKeyCache* key_cache)
 {
     const auto& nested_aggregation_indices = nested_aggregation_object;
     bool nested_aggregation_indices_all_zero = true;
@@ -54,6 +57,15 @@ AggregationObjectIndices create_recursion_constraints(Builder& builder,
     }
     const bool inner_proof_contains_recursive_proof = !nested_aggregation_indices_all_zero;
 
+    // Proofs verified against the same key witnesses share a single in-circuit key, which is then already populated
+    const RecursionKey* cached_key = nullptr;
+    if (key_cache != nullptr) {
+        auto it = key_cache->find({ input.key, nested_aggregation_object });
+        if (it != key_cache->end()) {
+            cached_key = &it->second;
+        }
+    }
+
     // If we do not have a witness, we must ensure that our dummy witness will not trigger
     // on-curve errors and inverting-zero errors
     {
@@ -91,7 +103,7 @@ AggregationObjectIndices create_recursion_constraints(Builder& builder,
             fr dummy_field = has_valid_witness_assignments ? builder.get_variable(proof_field_idx) : dummy_proof[i];
             builder.assert_equal(builder.add_variable(dummy_field), proof_field_idx);
         }
-        for (size_t i = 0; i < input.key.size(); ++i) {
+        for (size_t i = 0; cached_key == nullptr && i < input.key.size(); ++i) {
             const auto key_field_idx = input.key[i];
             fr dummy_field = has_valid_witness_assignments ? builder.get_variable(key_field_idx) : dummy_key[i];
             builder.assert_equal(builder.add_variable(dummy_field), key_field_idx);
@@ -132,13 +144,6 @@ AggregationObjectIndices create_recursion_constraints(Builder& builder,
 
     transcript::Manifest manifest = Composer::create_manifest(input.public_inputs.size());
 
-    std::vector<field_ct> key_fields;
-    key_fields.reserve(input.key.size());
-    for (const auto& idx : input.key) {
-        auto field = field_ct::from_witness_index(&builder, idx);
-        key_fields.emplace_back(field);
-    }
-
     std::vector<field_ct> proof_fields;
     // Prepend the public inputs to the proof fields because this is how the
     // core barretenberg library processes proofs (with the public inputs first and not separated)
@@ -152,17 +157,35 @@ AggregationObjectIndices create_recursion_constraints(Builder& builder,
         proof_fields.emplace_back(field);
     }
 
-    // recursively verify the proof
-    std::shared_ptr<verification_key_ct> vkey = verification_key_ct::from_field_elements(
-        &builder, key_fields, inner_proof_contains_recursive_proof, nested_aggregation_indices);
-    vkey->program_width = noir_recursive_settings::program_width;
+    RecursionKey vkey;
+    if (cached_key != nullptr) {
+        vkey = *cached_key;
+    } else {
+        std::vector<field_ct> key_fields;
+        key_fields.reserve(input.key.size());
+        for (const auto& idx : input.key) {
+            auto field = field_ct::from_witness_index(&builder, idx);
+            key_fields.emplace_back(field);
+        }
+        vkey.key = verification_key_ct::from_field_elements(
+            &builder, key_fields, inner_proof_contains_recursive_proof, nested_aggregation_indices);
+        vkey.key->program_width = noir_recursive_settings::program_width;
+    }
 
+    // recursively verify the proof
     Transcript_ct transcript(&builder, manifest, proof_fields, input.public_inputs.size());
     aggregation_state_ct result = stdlib::recursion::verify_proof_<bn254, noir_recursive_settings>(
-        &builder, vkey, transcript, previous_aggregation);
+        &builder, vkey.key, transcript, previous_aggregation);
+
+    if (cached_key == nullptr) {
+        vkey.key_hash = vkey.key->hash();
+        if (key_cache != nullptr) {
+            key_cache->emplace(std::make_pair(input.key, nested_aggregation_object), vkey);
+        }
+    }
 
     // Assign correct witness value to the verification key hash
-    vkey->hash().assert_equal(field_ct::from_witness_index(&builder, input.key_hash));
+    vkey.key_hash.assert_equal(field_ct::from_witness_index(&builder, input.key_hash));
 
     return result.get_witness_indices();
 }
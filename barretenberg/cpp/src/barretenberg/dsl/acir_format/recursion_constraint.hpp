@@ -2,6 +2,9 @@
 #include "barretenberg/plonk/proof_system/constants.hpp"
 #include "barretenberg/plonk/proof_system/verification_key/verification_key.hpp"
 #include "barretenberg/plonk/transcript/transcript_wrappers.hpp"
+#include "barretenberg/stdlib/plonk_recursion/verification_key/verification_key.hpp"
+#include "barretenberg/stdlib/primitives/curves/bn254.hpp"
+#include <map>
 #include <vector>
 
 namespace acir_format {
@@ -62,11 +65,29 @@ struct RecursionConstraint {
     friend bool operator==(RecursionConstraint const& lhs, RecursionConstraint const& rhs) = default;
 };
 
+/**
+ * @brief An in-circuit verification key of a recursion constraint, together with its in-circuit hash
+ */
+struct RecursionKey {
+    std::shared_ptr<bb::stdlib::recursion::verification_key<bb::stdlib::bn254<Builder>>> key;
+    bb::stdlib::field_t<Builder> key_hash;
+};
+
+/**
+ * @brief The in-circuit verification keys of the recursion constraints of a circuit, by the witness indices of their key
+ * fields and their nested aggregation object (which, as a circuit constant, is part of the key)
+ * @details A circuit commonly verifies several proofs against the same verification key witnesses. Converting these
+ * witnesses to an in-circuit key (whose commitments are non-native group elements) and hashing it are then done once,
+ * and the key is shared by the recursive verifiers of all these proofs.
+ */
+using RecursionKeyCache = std::map<std::pair<std::vector<uint32_t>, bb::AggregationObjectIndices>, RecursionKey>;
+
 bb::AggregationObjectIndices create_recursion_constraints(Builder& builder,
                                                           const RecursionConstraint& input,
                                                           const bb::AggregationObjectIndices& input_aggregation_object,
                                                           const bb::AggregationObjectIndices& nested_aggregation_object,
-                                                          bool has_valid_witness_assignments = false);
+                                                          bool has_valid_witness_assignments = false,
+                                                          RecursionKeyCache* key_cache = nullptr);
 
 std::vector<bb::fr> export_key_in_recursion_format(std::shared_ptr<verification_key> const& vkey);
 std::vector<bb::fr> export_dummy_key_in_recursion_format(const PolynomialManifest& polynomial_manifest,
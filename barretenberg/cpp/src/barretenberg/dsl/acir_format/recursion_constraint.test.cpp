@@ -132,14 +132,17 @@ Builder create_inner_circuit()
  * @brief Create a circuit that recursively verifies one or more inner circuits
  *
  * @param inner_circuits
+ * @param share_verification_key Whether the inner proofs, of circuits with the same verification key, are all
+ * verified against the key witnesses of the first one
  * @return Composer
  */
-Builder create_outer_circuit(std::vector<Builder>& inner_circuits)
+Builder create_outer_circuit(std::vector<Builder>& inner_circuits, bool share_verification_key = false)
 {
     std::vector<RecursionConstraint> recursion_constraints;
 
     size_t witness_offset = 0;
     SlabVector<fr> witness;
+    std::vector<uint32_t> shared_key_indices;
 
     for (auto& inner_circuit : inner_circuits) {
         auto inner_composer = Composer();
@@ -173,7 +176,7 @@ Builder create_outer_circuit(std::vector<Builder>& inner_circuits)
                                                                                         bb::AGGREGATION_OBJECT_SIZE));
         }
 
-        const std::vector<bb::fr> key_witnesses = export_key_in_recursion_format(inner_verifier.key);
+        std::vector<bb::fr> key_witnesses = export_key_in_recursion_format(inner_verifier.key);
 
         const uint32_t key_hash_start_idx = static_cast<uint32_t>(witness_offset);
         const uint32_t public_input_start_idx = key_hash_start_idx + 1;
@@ -187,9 +190,15 @@ Builder create_outer_circuit(std::vector<Builder>& inner_circuits)
         for (size_t i = 0; i < proof_witnesses.size(); ++i) {
             proof_indices.emplace_back(static_cast<uint32_t>(i + proof_indices_start_idx));
         }
-        const size_t key_size = key_witnesses.size();
-        for (size_t i = 0; i < key_size; ++i) {
-            key_indices.emplace_back(static_cast<uint32_t>(i + key_indices_start_idx));
+        if (share_verification_key && !shared_key_indices.empty()) {
+            key_indices = shared_key_indices;
+            key_witnesses.clear();
+        } else {
+            const size_t key_size = key_witnesses.size();
+            for (size_t i = 0; i < key_size; ++i) {
+                key_indices.emplace_back(static_cast<uint32_t>(i + key_indices_start_idx));
+            }
+            shared_key_indices = key_indices;
         }
         // In the case of a nested proof we keep the nested aggregation object attached to the proof,
         // thus we do not explicitly have to keep the public inputs while setting up the initial recursion constraint.
@@ -389,3 +398,24 @@ TEST_F(AcirRecursionConstraint, TestFullRecursiveComposition)
     auto verifier = layer_3_composer.create_ultra_with_keccak_verifier(layer_3_circuit);
     EXPECT_EQ(verifier.verify_proof(proof), true);
 }
+
+TEST_F(AcirRecursionConstraint, TestRecursionConstraintsWithSharedVerificationKey)
+{
+    std::vector<Builder> layer_1_circuits;
+    layer_1_circuits.push_back(create_inner_circuit());
+    layer_1_circuits.push_back(create_inner_circuit());
+
+    auto separate_keys_circuit = create_outer_circuit(layer_1_circuits);
+    auto layer_2_circuit = create_outer_circuit(layer_1_circuits, /*share_verification_key=*/true);
+
+    // The second constraint finds the in-circuit key of the first one in the key cache, so that the key is neither
+    // constructed nor hashed a second time
+    info("circuit gates = ", layer_2_circuit.get_num_gates());
+    EXPECT_LT(layer_2_circuit.get_num_gates(), separate_keys_circuit.get_num_gates());
+
+    auto layer_2_composer = Composer();
+    auto prover = layer_2_composer.create_ultra_with_keccak_prover(layer_2_circuit);
+    auto proof = prover.construct_proof();
+    auto verifier = layer_2_composer.create_ultra_with_keccak_verifier(layer_2_circuit);
+    EXPECT_EQ(verifier.verify_proof(proof), true);
+}
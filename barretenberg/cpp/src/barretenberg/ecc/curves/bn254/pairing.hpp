@@ -40,6 +40,8 @@ constexpr fq12 miller_loop(const g1::element& P, const miller_lines& lines);
 
 constexpr fq12 miller_loop_batch(const g1::element* points, const miller_lines* lines, size_t num_pairs);
 
+constexpr fq12 miller_loop_batch(const g1::element* points, const miller_lines* const* lines, size_t num_pairs);
+
 constexpr void final_exponentiation_easy_part(const fq12& elt, fq12& r);
 
 constexpr void final_exponentiation_exp_by_neg_z(const fq12& elt, fq12& r);
@@ -56,6 +58,27 @@ inline fq12 reduced_ate_pairing_batch_precomputed(const g1::affine_element* P_af
                                                   const miller_lines* lines,
                                                   size_t num_points);
 
+// Below this many pairs per thread, multi-pairings run their Miller loop on a single thread
+constexpr size_t MIN_PAIRS_PER_THREAD = 8;
+
+/**
+ * @brief Compute the product of the pairings e(P_i, Q_i), given the precomputed Miller lines of each Q_i, with a single
+ * shared Miller loop and a single final exponentiation
+ * @details lines[i] points to the lines of Q_i, so that pairs with the same G2 point (e.g. the fixed [1]₂ and [x]₂ of the
+ * verifier CRS) share one set of lines. Pairs whose G1 point is the point at infinity are skipped. For many pairs, the
+ * Miller loop is split across threads, whose partial products are multiplied before the final exponentiation.
+ */
+inline fq12 reduced_ate_multi_pairing_precomputed(const g1::affine_element* P_affines,
+                                                  const miller_lines* const* lines,
+                                                  size_t num_pairs);
+
+/**
+ * @brief Compute the product of the pairings e(P_i, Q_i), computing the Miller lines of the Q_i in parallel
+ */
+inline fq12 reduced_ate_multi_pairing(const g1::affine_element* P_affines,
+                                      const g2::affine_element* Q_affines,
+                                      size_t num_pairs);
+
 } // namespace bb::pairing
 
 #include "./pairing_impl.hpp"
\ No newline at end of file
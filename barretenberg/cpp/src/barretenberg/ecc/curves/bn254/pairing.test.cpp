@@ -127,4 +127,40 @@ TEST(pairing, ReducedAtePairingPrecomputeConsistencyCheckBatch)
     fq12 expected = pairing::reduced_ate_pairing_batch(&P_b[0], &Q_b[0], num_points).from_montgomery_form();
 
     EXPECT_EQ(result, expected);
-}
\ No newline at end of file
+}
+
+TEST(pairing, ReducedAteMultiPairingSharedLines)
+{
+    // Enough pairs for the Miller loop to be split across threads
+    constexpr size_t num_equations = 40;
+
+    // Two fixed G2 points, as in the verifier CRS
+    std::array<g2::affine_element, 2> Q{ g2::element::random_element(), g2::element::random_element() };
+    std::array<pairing::miller_lines, 2> fixed_lines;
+    pairing::precompute_miller_lines(g2::element(Q[0]), fixed_lines[0]);
+    pairing::precompute_miller_lines(g2::element(Q[1]), fixed_lines[1]);
+
+    std::vector<g1::affine_element> P(2 * num_equations);
+    std::vector<g2::affine_element> Q_per_pair(2 * num_equations);
+    std::vector<const pairing::miller_lines*> lines(2 * num_equations);
+    for (size_t i = 0; i < 2 * num_equations; ++i) {
+        P[i] = g1::element::random_element();
+        Q_per_pair[i] = Q[i % 2];
+        lines[i] = &fixed_lines[i % 2];
+    }
+    // Pairs with the point at infinity contribute nothing
+    P[3] = g1::affine_element::infinity();
+
+    fq12 expected = fq12::one();
+    for (size_t i = 0; i < 2 * num_equations; ++i) {
+        if (i != 3) {
+            expected *= pairing::reduced_ate_pairing(P[i], Q_per_pair[i]);
+        }
+    }
+
+    fq12 result = pairing::reduced_ate_multi_pairing_precomputed(P.data(), lines.data(), P.size());
+    EXPECT_EQ(result.from_montgomery_form(), expected.from_montgomery_form());
+
+    result = pairing::reduced_ate_multi_pairing(P.data(), Q_per_pair.data(), P.size());
+    EXPECT_EQ(result.from_montgomery_form(), expected.from_montgomery_form());
+}
@@ -3,6 +3,7 @@
 #include "./fq12.hpp"
 #include "./g1.hpp"
 #include "./g2.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 
 namespace bb::pairing {
@@ -158,50 +159,53 @@ constexpr fq12 miller_loop(g1::element& P, miller_lines& lines)
     return work_scalar;
 }
 
-constexpr fq12 miller_loop_batch(const g1::element* points, const miller_lines* lines, size_t num_pairs)
+/**
+ * @brief Miller loop shared by all pairs, where get_lines(j) returns the precomputed lines of the G2 point of pair j
+ */
+template <typename GetLines>
+constexpr fq12 miller_loop_batch_with_lines(const g1::element* points, const GetLines& get_lines, size_t num_pairs)
 {
     fq12 work_scalar = fq12::one();
 
     size_t it = 0;
     fq12::ell_coeffs work_line;
 
-    for (unsigned char loop_bit : loop_bits) {
-        work_scalar = work_scalar.sqr();
+    const auto multiply_by_lines = [&]() {
         for (size_t j = 0; j < num_pairs; ++j) {
-            work_line.o = lines[j].lines[it].o;
-            work_line.vw = lines[j].lines[it].vw.mul_by_fq(points[j].y);
-            work_line.vv = lines[j].lines[it].vv.mul_by_fq(points[j].x);
+            const miller_lines& lines = get_lines(j);
+            work_line.o = lines.lines[it].o;
+            work_line.vw = lines.lines[it].vw.mul_by_fq(points[j].y);
+            work_line.vv = lines.lines[it].vv.mul_by_fq(points[j].x);
             work_scalar.self_sparse_mul(work_line);
         }
         ++it;
+    };
+
+    for (unsigned char loop_bit : loop_bits) {
+        work_scalar = work_scalar.sqr();
+        multiply_by_lines();
         if (loop_bit != 0) {
-            for (size_t j = 0; j < num_pairs; ++j) {
-                work_line.o = lines[j].lines[it].o;
-                work_line.vw = lines[j].lines[it].vw.mul_by_fq(points[j].y);
-                work_line.vv = lines[j].lines[it].vv.mul_by_fq(points[j].x);
-                work_scalar.self_sparse_mul(work_line);
-            }
-            ++it;
+            multiply_by_lines();
         }
     }
 
-    for (size_t j = 0; j < num_pairs; ++j) {
-        work_line.o = lines[j].lines[it].o;
-        work_line.vw = lines[j].lines[it].vw.mul_by_fq(points[j].y);
-        work_line.vv = lines[j].lines[it].vv.mul_by_fq(points[j].x);
-        work_scalar.self_sparse_mul(work_line);
-    }
-    ++it;
-    for (size_t j = 0; j < num_pairs; ++j) {
-        work_line.o = lines[j].lines[it].o;
-        work_line.vw = lines[j].lines[it].vw.mul_by_fq(points[j].y);
-        work_line.vv = lines[j].lines[it].vv.mul_by_fq(points[j].x);
-        work_scalar.self_sparse_mul(work_line);
-    }
-    ++it;
+    multiply_by_lines();
+    multiply_by_lines();
     return work_scalar;
 }
 
+constexpr fq12 miller_loop_batch(const g1::element* points, const miller_lines* lines, size_t num_pairs)
+{
+    return miller_loop_batch_with_lines(
+        points, [lines](size_t j) -> const miller_lines& { return lines[j]; }, num_pairs);
+}
+
+constexpr fq12 miller_loop_batch(const g1::element* points, const miller_lines* const* lines, size_t num_pairs)
+{
+    return miller_loop_batch_with_lines(
+        points, [lines](size_t j) -> const miller_lines& { return *lines[j]; }, num_pairs);
+}
+
 constexpr fq12 final_exponentiation_easy_part(const fq12& elt)
 {
     fq12 a{ elt.c0, -elt.c1 };
@@ -267,35 +271,81 @@ fq12 reduced_ate_pairing_batch_precomputed(const g1::affine_element* P_affines,
                                            const miller_lines* lines,
                                            const size_t num_points)
 {
-    std::vector<g1::element> P(num_points);
+    std::vector<const miller_lines*> line_pointers(num_points);
     for (size_t i = 0; i < num_points; ++i) {
-        P[i] = g1::element(P_affines[i]);
+        line_pointers[i] = &lines[i];
     }
-    fq12 result = miller_loop_batch(&P[0], &lines[0], num_points);
-    result = final_exponentiation_easy_part(result);
-    result = final_exponentiation_tricky_part(result);
-    return result;
+    return reduced_ate_multi_pairing_precomputed(P_affines, line_pointers.data(), num_points);
 }
 
 fq12 reduced_ate_pairing_batch(const g1::affine_element* P_affines,
                                const g2::affine_element* Q_affines,
                                const size_t num_points)
 {
-    std::vector<g1::element> P(num_points);
-    std::vector<g2::element> Q(num_points);
-    std::vector<miller_lines> lines(num_points);
-
-    for (size_t i = 0; i < num_points; ++i) {
-        P[i] = g1::element(P_affines[i]);
-        Q[i] = g2::element(Q_affines[i]);
+    return reduced_ate_multi_pairing(P_affines, Q_affines, num_points);
+}
 
-        precompute_miller_lines(Q[i], lines[i]);
+fq12 reduced_ate_multi_pairing_precomputed(const g1::affine_element* P_affines,
+                                           const miller_lines* const* lines,
+                                           const size_t num_pairs)
+{
+    // e(∞, Q) = 1, and the line functions cannot be evaluated at ∞
+    std::vector<g1::element> P;
+    std::vector<const miller_lines*> P_lines;
+    P.reserve(num_pairs);
+    P_lines.reserve(num_pairs);
+    for (size_t i = 0; i < num_pairs; ++i) {
+        if (!P_affines[i].is_point_at_infinity()) {
+            P.emplace_back(P_affines[i]);
+            P_lines.emplace_back(lines[i]);
+        }
+    }
+    const size_t num_finite_pairs = P.size();
+
+    // The Miller loop value is multiplicative in the set of pairs, so each thread runs it on a chunk of the pairs
+    const size_t num_threads = std::min(get_num_cpus(), num_finite_pairs / MIN_PAIRS_PER_THREAD);
+    fq12 result;
+    if (num_threads <= 1) {
+        result = miller_loop_batch(P.data(), P_lines.data(), num_finite_pairs);
+    } else {
+        const size_t pairs_per_thread = (num_finite_pairs + num_threads - 1) / num_threads;
+        std::vector<fq12> partial_results(num_threads, fq12::one());
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * pairs_per_thread;
+            const size_t end = std::min(start + pairs_per_thread, num_finite_pairs);
+            if (start < end) {
+                partial_results[thread_idx] = miller_loop_batch(&P[start], &P_lines[start], end - start);
+            }
+        });
+        result = partial_results[0];
+        for (size_t i = 1; i < num_threads; ++i) {
+            result *= partial_results[i];
+        }
     }
-
-    fq12 result = miller_loop_batch(&P[0], &lines[0], num_points);
     result = final_exponentiation_easy_part(result);
     result = final_exponentiation_tricky_part(result);
     return result;
 }
 
+fq12 reduced_ate_multi_pairing(const g1::affine_element* P_affines,
+                               const g2::affine_element* Q_affines,
+                               const size_t num_pairs)
+{
+    // Each step of the loop is a G2 doubling or mixed addition, about three times as costly as in G1, so that a few
+    // pairs (e.g. the two of a proof verification) are not worth splitting across threads
+    constexpr size_t PRECOMPUTE_MILLER_LINES_COST =
+        loop_bits.size() * 3 * (thread_heuristics::GE_DOUBLING_COST + thread_heuristics::GE_ADDITION_COST);
+
+    std::vector<miller_lines> lines(num_pairs);
+    std::vector<const miller_lines*> line_pointers(num_pairs);
+    parallel_for_heuristic(
+        num_pairs,
+        [&](size_t i) {
+            precompute_miller_lines(g2::element(Q_affines[i]), lines[i]);
+            line_pointers[i] = &lines[i];
+        },
+        PRECOMPUTE_MILLER_LINES_COST);
+    return reduced_ate_multi_pairing_precomputed(P_affines, line_pointers.data(), num_pairs);
+}
+
 } // namespace bb::pairing
@@ -0,0 +1,133 @@
+#include "barretenberg/ecc/groups/batch_affine.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+template <typename Curve> std::vector<typename Curve::AffineElement> random_points(size_t num_points)
+{
+    using Element = typename Curve::Element;
+    std::vector<typename Curve::AffineElement> points(num_points);
+    // Avoid a scalar multiplication per point; consecutive multiples of a random point are in general position
+    Element accumulator = Element::random_element();
+    const Element step = Element::random_element();
+    for (auto& point : points) {
+        accumulator += step;
+        point = accumulator;
+    }
+    return points;
+}
+
+} // namespace
+
+/**
+ * @brief Benchmark: rhs[i] += lhs[i] over state.range(0) pairs in projective coordinates, for reference
+ */
+template <typename Curve> void projective_add_bench(State& state) noexcept
+{
+    using Element = typename Curve::Element;
+    const auto num_points = static_cast<size_t>(state.range(0));
+    const auto lhs = random_points<Curve>(num_points);
+    std::vector<Element> rhs(num_points);
+    for (auto _ : state) {
+        state.PauseTiming();
+        const auto rhs_affine = random_points<Curve>(num_points);
+        std::copy(rhs_affine.begin(), rhs_affine.end(), rhs.begin());
+        state.ResumeTiming();
+        parallel_for_range(num_points, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                rhs[i] += lhs[i];
+            }
+        });
+        DoNotOptimize(rhs.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * @brief Benchmark: rhs[i] += lhs[i] over state.range(0) pairs in affine coordinates, without edge case handling
+ */
+template <typename Curve> void affine_add_unchecked_bench(State& state) noexcept
+{
+    using BatchAffine = group_elements::BatchAffine<typename Curve::AffineElement>;
+    const auto num_points = static_cast<size_t>(state.range(0));
+    const auto lhs = random_points<Curve>(num_points);
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto rhs = random_points<Curve>(num_points);
+        state.ResumeTiming();
+        BatchAffine::add_in_place_unchecked(lhs, rhs);
+        DoNotOptimize(rhs.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * @brief Benchmark: rhs[i] += lhs[i] over state.range(0) pairs in affine coordinates, with edge case handling
+ */
+template <typename Curve> void affine_add_bench(State& state) noexcept
+{
+    using BatchAffine = group_elements::BatchAffine<typename Curve::AffineElement>;
+    const auto num_points = static_cast<size_t>(state.range(0));
+    const auto lhs = random_points<Curve>(num_points);
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto rhs = random_points<Curve>(num_points);
+        state.ResumeTiming();
+        BatchAffine::add_in_place(lhs, rhs);
+        DoNotOptimize(rhs.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * @brief Benchmark: Double state.range(0) points in affine coordinates
+ */
+template <typename Curve> void affine_double_bench(State& state) noexcept
+{
+    using BatchAffine = group_elements::BatchAffine<typename Curve::AffineElement>;
+    auto points = random_points<Curve>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        BatchAffine::double_in_place(points);
+        DoNotOptimize(points.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * @brief Benchmark: Convert state.range(0) projective points to affine form with a batch inversion per thread
+ */
+template <typename Curve> void normalize_bench(State& state) noexcept
+{
+    using Element = typename Curve::Element;
+    using BatchAffine = group_elements::BatchAffine<typename Curve::AffineElement>;
+    const auto num_points = static_cast<size_t>(state.range(0));
+    std::vector<Element> points(num_points, Element::random_element());
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (auto& point : points) {
+            point = point.dbl();
+        }
+        state.ResumeTiming();
+        BatchAffine::template normalize<Element>(points);
+        DoNotOptimize(points.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define BATCH_AFFINE_BENCHMARKS(Curve)                                                                                 \
+    BENCHMARK(projective_add_bench<Curve>)->RangeMultiplier(4)->Range(1 << 10, 1 << 18)->Unit(kMillisecond);           \
+    BENCHMARK(affine_add_unchecked_bench<Curve>)->RangeMultiplier(4)->Range(1 << 10, 1 << 18)->Unit(kMillisecond);     \
+    BENCHMARK(affine_add_bench<Curve>)->RangeMultiplier(4)->Range(1 << 10, 1 << 18)->Unit(kMillisecond);               \
+    BENCHMARK(affine_double_bench<Curve>)->RangeMultiplier(4)->Range(1 << 10, 1 << 18)->Unit(kMillisecond);            \
+    BENCHMARK(normalize_bench<Curve>)->RangeMultiplier(4)->Range(1 << 10, 1 << 18)->Unit(kMillisecond)
+
+BATCH_AFFINE_BENCHMARKS(curve::BN254);
+BATCH_AFFINE_BENCHMARKS(curve::Grumpkin);
+
+// NOLINTNEXTLINE macro invokation triggers style guideline errors from googletest code
+BENCHMARK_MAIN();
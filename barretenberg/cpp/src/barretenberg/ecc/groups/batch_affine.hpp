@@ -0,0 +1,375 @@
+#pragma once
+
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// NOLINTBEGIN(readability-implicit-bool-conversion)
+namespace bb::group_elements {
+
+// Forward declared, as element_impl.hpp includes this header while affine_element.hpp is being included
+template <typename Fq_, typename Fr_, typename Params> class affine_element;
+
+template <typename AffineElement> struct affine_element_params;
+template <class Fq, class Fr, class Params> struct affine_element_params<affine_element<Fq, Fr, Params>> {
+    using type = Params;
+};
+
+/**
+ * @brief Bulk elliptic curve arithmetic in affine coordinates with amortised inversions
+ * @details An affine addition or doubling costs a single field inversion plus a few multiplications. Given many
+ * independent operations, the inversions are shared with Montgomery's trick: the denominators are multiplied together,
+ * the product is inverted once, and each individual inverse is peeled off on the way back, at 3 multiplications per
+ * inverse. An affine addition then costs 6 multiplications in total against 11 for a projective one.
+ *
+ * The *_chunk methods run one batch inversion over a contiguous chunk on the calling thread and are the building blocks
+ * of algorithms with their own parallelism (e.g. Pippenger's bucket accumulation). The span methods split the work
+ * across threads, one batch inversion per chunk.
+ *
+ * Methods suffixed with _unchecked assume the operands are in general position: no point at infinity, and distinct x
+ * coordinates for additions. This holds with overwhelming probability for random points and saves the branches in the
+ * hot loop. The other methods handle equal points, inverse points and points at infinity.
+ *
+ * @tparam AffineElement An affine_element; in practice those of BN254 and Grumpkin
+ */
+template <typename AffineElement> class BatchAffine {
+  public:
+    using Fq = typename AffineElement::Fq;
+    using Params = typename affine_element_params<AffineElement>::type;
+
+    /**
+     * @brief Add two points in general position given the inverse of x2 - x1
+     */
+    static AffineElement add_with_slope_inverse(const AffineElement& point_1,
+                                                const AffineElement& point_2,
+                                                const Fq& slope_inverse)
+    {
+        const Fq lambda = slope_inverse * (point_2.y - point_1.y);
+        Fq x3 = lambda.sqr() - point_2.x - point_1.x;
+        Fq y3 = lambda * (point_1.x - x3) - point_1.y;
+        return { x3, y3 };
+    }
+
+    /**
+     * @brief Compute rhs[i] = lhs[i] + rhs[i] for points in general position
+     * @param scratch_space Space for num_points field elements
+     */
+    static void add_chunk_unchecked(const AffineElement* lhs,
+                                    AffineElement* rhs,
+                                    const size_t num_points,
+                                    Fq* scratch_space) noexcept
+    {
+        Fq batch_inversion_accumulator = Fq::one();
+
+        for (size_t i = 0; i < num_points; i += 1) {
+            scratch_space[i] = lhs[i].x + rhs[i].x;  // x2 + x1
+            rhs[i].x -= lhs[i].x;                    // x2 - x1
+            rhs[i].y -= lhs[i].y;                    // y2 - y1
+            rhs[i].y *= batch_inversion_accumulator; // (y2 - y1)*accumulator_old
+            batch_inversion_accumulator *= (rhs[i].x);
+        }
+        batch_inversion_accumulator = batch_inversion_accumulator.invert();
+
+        for (size_t i = num_points - 1; i < num_points; i -= 1) {
+            rhs[i].y *= batch_inversion_accumulator; // lambda = (y2 - y1)/(x2 - x1)
+            batch_inversion_accumulator *= rhs[i].x;
+            rhs[i].x = rhs[i].y.sqr() - scratch_space[i]; // x3 = lambda^2 - x2 - x1
+            scratch_space[i] = lhs[i].x - rhs[i].x;
+            scratch_space[i] *= rhs[i].y;
+            rhs[i].y = scratch_space[i] - lhs[i].y; // y3 = lambda*(x1 - x3) - y1
+        }
+    }
+
+    /**
+     * @brief Compute rhs[i] = lhs[i] + rhs[i] for arbitrary points
+     * @details Pairs involving the point at infinity, or of inverse points, need no inversion. Pairs of equal points
+     * are doubled, with slope (3x² + a)/2y instead of (y2 - y1)/(x2 - x1).
+     * @param scratch_space Space for 2 * num_points field elements
+     */
+    static void add_chunk(const AffineElement* lhs, AffineElement* rhs, const size_t num_points, Fq* scratch_space)
+    {
+        Fq* x_sums = scratch_space;
+        Fq* denominators = scratch_space + num_points;
+        std::vector<uint8_t> needs_inversion(num_points, 0);
+        Fq batch_inversion_accumulator = Fq::one();
+
+        for (size_t i = 0; i < num_points; i += 1) {
+            if (lhs[i].is_point_at_infinity()) {
+                continue;
+            }
+            if (rhs[i].is_point_at_infinity()) {
+                rhs[i] = lhs[i];
+                continue;
+            }
+            Fq numerator;
+            if (lhs[i].x == rhs[i].x) {
+                if (lhs[i].y != rhs[i].y || lhs[i].y.is_zero()) {
+                    rhs[i].self_set_infinity();
+                    continue;
+                }
+                const Fq x_squared = lhs[i].x.sqr();
+                numerator = x_squared + x_squared + x_squared; // 3x^2 (+ a)
+                if constexpr (Params::has_a) {
+                    numerator += Params::a;
+                }
+                denominators[i] = lhs[i].y + lhs[i].y; // 2y
+            } else {
+                numerator = rhs[i].y - lhs[i].y;       // y2 - y1
+                denominators[i] = rhs[i].x - lhs[i].x; // x2 - x1
+            }
+            needs_inversion[i] = 1;
+            x_sums[i] = lhs[i].x + rhs[i].x;
+            rhs[i].y = numerator * batch_inversion_accumulator;
+            batch_inversion_accumulator *= denominators[i];
+        }
+        batch_inversion_accumulator = batch_inversion_accumulator.invert();
+
+        for (size_t i = num_points - 1; i < num_points; i -= 1) {
+            if (!needs_inversion[i]) {
+                continue;
+            }
+            const Fq lambda = rhs[i].y * batch_inversion_accumulator;
+            batch_inversion_accumulator *= denominators[i];
+            rhs[i].x = lambda.sqr() - x_sums[i];
+            rhs[i].y = lambda * (lhs[i].x - rhs[i].x) - lhs[i].y;
+        }
+    }
+
+    /**
+     * @brief Compute points[i] = 2 * points[i], leaving points at infinity untouched
+     * @note Points of order 2 (y = 0) are not handled; neither BN254 nor Grumpkin has any.
+     * @param scratch_space Space for num_points field elements
+     */
+    static void double_chunk(AffineElement* points, const size_t num_points, Fq* scratch_space) noexcept
+    {
+        Fq batch_inversion_accumulator = Fq::one();
+
+        for (size_t i = 0; i < num_points; i += 1) {
+            if (points[i].is_point_at_infinity()) {
+                continue;
+            }
+            const Fq x_squared = points[i].x.sqr();
+            scratch_space[i] = x_squared + x_squared + x_squared; // 3x^2 (+ a)
+            if constexpr (Params::has_a) {
+                scratch_space[i] += Params::a;
+            }
+            scratch_space[i] *= batch_inversion_accumulator;
+            batch_inversion_accumulator *= (points[i].y + points[i].y);
+        }
+        batch_inversion_accumulator = batch_inversion_accumulator.invert();
+
+        for (size_t i = num_points - 1; i < num_points; i -= 1) {
+            if (points[i].is_point_at_infinity()) {
+                continue;
+            }
+            scratch_space[i] *= batch_inversion_accumulator; // lambda = (3x^2 + a)/2y
+            batch_inversion_accumulator *= (points[i].y + points[i].y);
+
+            const Fq x = points[i].x;
+            points[i].x = scratch_space[i].sqr() - (x + x);
+            points[i].y = scratch_space[i] * (x - points[i].x) - points[i].y;
+        }
+    }
+
+    /**
+     * @brief Sum adjacent pairs of points in general position, writing the sum of points[i] and points[i + 1] to
+     * points[(i + num_points) / 2]
+     * @details This is the layout of the addition chains of the Pippenger bucket accumulation, where each round halves
+     * the number of points and its results are the inputs of the next round.
+     * @param scratch_space Space for num_points / 2 field elements
+     */
+    static void add_adjacent_pairs_unchecked(AffineElement* points, const size_t num_points, Fq* scratch_space)
+    {
+        Fq batch_inversion_accumulator = Fq::one();
+
+        for (size_t i = 0; i < num_points; i += 2) {
+            scratch_space[i >> 1] = points[i].x + points[i + 1].x; // x2 + x1
+            points[i + 1].x -= points[i].x;                        // x2 - x1
+            points[i + 1].y -= points[i].y;                        // y2 - y1
+            points[i + 1].y *= batch_inversion_accumulator;        // (y2 - y1)*accumulator_old
+            batch_inversion_accumulator *= (points[i + 1].x);
+        }
+
+        if (batch_inversion_accumulator == 0) {
+            throw_or_abort("attempted to invert zero in add_adjacent_pairs_unchecked");
+        } else {
+            batch_inversion_accumulator = batch_inversion_accumulator.invert();
+        }
+
+        for (size_t i = (num_points)-2; i < num_points; i -= 2) {
+            // Memory bandwidth is a bit of a bottleneck here.
+            // There's probably a more elegant way of structuring our data so we don't need to do all of this
+            // prefetching
+            __builtin_prefetch(points + i - 2);
+            __builtin_prefetch(points + i - 1);
+            __builtin_prefetch(points + ((i + num_points - 2) >> 1));
+            __builtin_prefetch(scratch_space + ((i - 2) >> 1));
+
+            points[i + 1].y *= batch_inversion_accumulator; // update accumulator
+            batch_inversion_accumulator *= points[i + 1].x;
+            points[i + 1].x = points[i + 1].y.sqr();
+            points[(i + num_points) >> 1].x = points[i + 1].x - (scratch_space[i >> 1]); // x3 = lambda_squared - x2
+                                                                                         // - x1
+            points[i].x -= points[(i + num_points) >> 1].x;
+            points[i].x *= points[i + 1].y;
+            points[(i + num_points) >> 1].y = points[i].x - points[i].y;
+        }
+    }
+
+    /**
+     * @brief As add_adjacent_pairs_unchecked, for arbitrary points
+     */
+    static void add_adjacent_pairs(AffineElement* points, const size_t num_points, Fq* scratch_space)
+    {
+        Fq batch_inversion_accumulator = Fq::one();
+
+        for (size_t i = 0; i < num_points; i += 2) {
+            if (points[i].is_point_at_infinity() || points[i + 1].is_point_at_infinity()) {
+                continue;
+            }
+            if (points[i].x == points[i + 1].x) {
+                if (points[i].y == points[i + 1].y) {
+                    // double
+                    scratch_space[i >> 1] = points[i].x + points[i].x; // 2x
+                    Fq x_squared = points[i].x.sqr();
+                    points[i + 1].x = points[i].y + points[i].y;         // 2y
+                    points[i + 1].y = x_squared + x_squared + x_squared; // 3x^2
+                    if constexpr (Params::has_a) {
+                        points[i + 1].y += Params::a;
+                    }
+                    points[i + 1].y *= batch_inversion_accumulator;
+                    batch_inversion_accumulator *= (points[i + 1].x);
+                    continue;
+                }
+                points[i].self_set_infinity();
+                points[i + 1].self_set_infinity();
+                continue;
+            }
+
+            scratch_space[i >> 1] = points[i].x + points[i + 1].x; // x2 + x1
+            points[i + 1].x -= points[i].x;                        // x2 - x1
+            points[i + 1].y -= points[i].y;                        // y2 - y1
+            points[i + 1].y *= batch_inversion_accumulator;        // (y2 - y1)*accumulator_old
+            batch_inversion_accumulator *= (points[i + 1].x);
+        }
+        if (!batch_inversion_accumulator.is_zero()) {
+            batch_inversion_accumulator = batch_inversion_accumulator.invert();
+        }
+        for (size_t i = (num_points)-2; i < num_points; i -= 2) {
+            // Memory bandwidth is a bit of a bottleneck here.
+            // There's probably a more elegant way of structuring our data so we don't need to do all of this
+            // prefetching
+            __builtin_prefetch(points + i - 2);
+            __builtin_prefetch(points + i - 1);
+            __builtin_prefetch(points + ((i + num_points - 2) >> 1));
+            __builtin_prefetch(scratch_space + ((i - 2) >> 1));
+
+            if (points[i].is_point_at_infinity()) {
+                points[(i + num_points) >> 1] = points[i + 1];
+                continue;
+            }
+            if (points[i + 1].is_point_at_infinity()) {
+                points[(i + num_points) >> 1] = points[i];
+                continue;
+            }
+
+            points[i + 1].y *= batch_inversion_accumulator; // update accumulator
+            batch_inversion_accumulator *= points[i + 1].x;
+            points[i + 1].x = points[i + 1].y.sqr();
+            points[(i + num_points) >> 1].x = points[i + 1].x - (scratch_space[i >> 1]); // x3 = lambda_squared - x2
+                                                                                         // - x1
+            points[i].x -= points[(i + num_points) >> 1].x;
+            points[i].x *= points[i + 1].y;
+            points[(i + num_points) >> 1].y = points[i].x - points[i].y;
+        }
+    }
+
+    /**
+     * @brief Compute rhs[i] = lhs[i] + rhs[i] for points in general position, in parallel
+     * @param scratch_space If non-empty, space for rhs.size() field elements, to be reused across calls
+     */
+    static void add_in_place_unchecked(std::span<const AffineElement> lhs,
+                                       std::span<AffineElement> rhs,
+                                       std::span<Fq> scratch_space = {})
+    {
+        ASSERT(lhs.size() == rhs.size());
+        std::vector<Fq> owned_scratch_space;
+        Fq* scratch = get_scratch_space(scratch_space, owned_scratch_space, rhs.size());
+        parallel_for_heuristic(
+            rhs.size(),
+            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                add_chunk_unchecked(&lhs[start], &rhs[start], end - start, scratch + start);
+            },
+            ADDITION_COST);
+    }
+
+    /**
+     * @brief Compute rhs[i] = lhs[i] + rhs[i] for arbitrary points, in parallel
+     */
+    static void add_in_place(std::span<const AffineElement> lhs, std::span<AffineElement> rhs)
+    {
+        ASSERT(lhs.size() == rhs.size());
+        std::vector<Fq> scratch_space(2 * rhs.size());
+        parallel_for_heuristic(
+            rhs.size(),
+            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                add_chunk(&lhs[start], &rhs[start], end - start, &scratch_space[2 * start]);
+            },
+            ADDITION_COST);
+    }
+
+    /**
+     * @brief Compute points[i] = 2 * points[i], in parallel
+     * @param scratch_space If non-empty, space for points.size() field elements, to be reused across calls
+     */
+    static void double_in_place(std::span<AffineElement> points, std::span<Fq> scratch_space = {})
+    {
+        std::vector<Fq> owned_scratch_space;
+        Fq* scratch = get_scratch_space(scratch_space, owned_scratch_space, points.size());
+        parallel_for_heuristic(
+            points.size(),
+            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                double_chunk(&points[start], end - start, scratch + start);
+            },
+            DOUBLING_COST);
+    }
+
+    /**
+     * @brief Convert projective points to affine form in place (z = 1), in parallel
+     * @tparam Element The projective element type matching AffineElement
+     */
+    template <typename Element> static void normalize(std::span<Element> points)
+    {
+        parallel_for_heuristic(
+            points.size(),
+            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                Element::batch_normalize(&points[start], end - start);
+            },
+            NORMALIZATION_COST);
+    }
+
+  private:
+    // Per point costs, including the amortised inversion
+    static constexpr size_t ADDITION_COST =
+        thread_heuristics::FF_ADDITION_COST * 6 + thread_heuristics::FF_MULTIPLICATION_COST * 6;
+    static constexpr size_t DOUBLING_COST =
+        thread_heuristics::FF_ADDITION_COST * 7 + thread_heuristics::FF_MULTIPLICATION_COST * 6;
+    static constexpr size_t NORMALIZATION_COST = thread_heuristics::FF_MULTIPLICATION_COST * 7;
+
+    static Fq* get_scratch_space(std::span<Fq> provided, std::vector<Fq>& owned, size_t size)
+    {
+        if (!provided.empty()) {
+            ASSERT(provided.size() >= size);
+            return provided.data();
+        }
+        owned.resize(size);
+        return owned.data();
+    }
+};
+
+} // namespace bb::group_elements
+// NOLINTEND(readability-implicit-bool-conversion)
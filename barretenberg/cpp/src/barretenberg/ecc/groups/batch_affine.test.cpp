@@ -0,0 +1,160 @@
+#include "barretenberg/ecc/groups/batch_affine.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+} // namespace
+
+template <typename Curve> class BatchAffineTests : public ::testing::Test {
+  public:
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using BatchAffine = group_elements::BatchAffine<AffineElement>;
+
+    static std::vector<AffineElement> random_points(size_t num_points)
+    {
+        std::vector<AffineElement> points(num_points);
+        for (auto& point : points) {
+            point = AffineElement(Element::random_element(&engine));
+        }
+        return points;
+    }
+
+    static AffineElement infinity()
+    {
+        AffineElement point = AffineElement::one();
+        point.self_set_infinity();
+        return point;
+    }
+
+    static AffineElement expected_sum(const AffineElement& lhs, const AffineElement& rhs)
+    {
+        return AffineElement(Element(lhs) + Element(rhs));
+    }
+};
+
+using Curves = ::testing::Types<curve::BN254, curve::Grumpkin>;
+TYPED_TEST_SUITE(BatchAffineTests, Curves);
+
+TYPED_TEST(BatchAffineTests, AddInPlaceUnchecked)
+{
+    using BatchAffine = typename TestFixture::BatchAffine;
+    constexpr size_t num_points = 1000;
+    auto lhs = TestFixture::random_points(num_points);
+    auto rhs = TestFixture::random_points(num_points);
+    auto expected = rhs;
+    for (size_t i = 0; i < num_points; ++i) {
+        expected[i] = TestFixture::expected_sum(lhs[i], rhs[i]);
+    }
+
+    BatchAffine::add_in_place_unchecked(lhs, rhs);
+    EXPECT_EQ(rhs, expected);
+}
+
+TYPED_TEST(BatchAffineTests, AddInPlaceEdgeCases)
+{
+    using BatchAffine = typename TestFixture::BatchAffine;
+    constexpr size_t num_points = 100;
+    auto lhs = TestFixture::random_points(num_points);
+    auto rhs = TestFixture::random_points(num_points);
+    const auto infinity = TestFixture::infinity();
+    lhs[1] = infinity;
+    rhs[2] = infinity;
+    lhs[3] = infinity;
+    rhs[3] = infinity;
+    rhs[4] = lhs[4];  // doubling
+    rhs[5] = -lhs[5]; // inverse
+    rhs[num_points - 1] = lhs[num_points - 1];
+
+    std::vector<typename TestFixture::AffineElement> expected(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        expected[i] = TestFixture::expected_sum(lhs[i], rhs[i]);
+    }
+
+    BatchAffine::add_in_place(lhs, rhs);
+    for (size_t i = 0; i < num_points; ++i) {
+        EXPECT_EQ(rhs[i].is_point_at_infinity(), expected[i].is_point_at_infinity());
+        if (!expected[i].is_point_at_infinity()) {
+            EXPECT_EQ(rhs[i], expected[i]);
+        }
+    }
+    EXPECT_TRUE(rhs[3].is_point_at_infinity());
+    EXPECT_TRUE(rhs[5].is_point_at_infinity());
+}
+
+TYPED_TEST(BatchAffineTests, DoubleInPlace)
+{
+    using BatchAffine = typename TestFixture::BatchAffine;
+    using Element = typename TestFixture::Element;
+    constexpr size_t num_points = 1000;
+    auto points = TestFixture::random_points(num_points);
+    points[7] = TestFixture::infinity();
+    auto expected = points;
+    for (auto& point : expected) {
+        if (!point.is_point_at_infinity()) {
+            point = Element(point).dbl();
+        }
+    }
+
+    BatchAffine::double_in_place(points);
+    EXPECT_EQ(points, expected);
+}
+
+TYPED_TEST(BatchAffineTests, AddAdjacentPairs)
+{
+    using BatchAffine = typename TestFixture::BatchAffine;
+    using Fq = typename BatchAffine::Fq;
+    constexpr size_t num_points = 64;
+    auto points = TestFixture::random_points(num_points);
+    std::vector<Fq> scratch_space(num_points / 2);
+    auto expected = points;
+    for (size_t i = 0; i < num_points; i += 2) {
+        expected[(i + num_points) / 2] = TestFixture::expected_sum(points[i], points[i + 1]);
+    }
+
+    auto points_unchecked = points;
+    BatchAffine::add_adjacent_pairs_unchecked(points_unchecked.data(), num_points, scratch_space.data());
+    for (size_t i = num_points / 2; i < num_points; ++i) {
+        EXPECT_EQ(points_unchecked[i], expected[i]);
+    }
+
+    // Doubling, inverse and infinity cases
+    points[1] = points[0];
+    points[3] = -points[2];
+    points[4] = TestFixture::infinity();
+    expected[num_points / 2] = TestFixture::expected_sum(points[0], points[1]);
+    expected[num_points / 2 + 2] = points[5];
+    BatchAffine::add_adjacent_pairs(points.data(), num_points, scratch_space.data());
+    EXPECT_TRUE(points[num_points / 2 + 1].is_point_at_infinity());
+    for (size_t i = num_points / 2; i < num_points; ++i) {
+        if (i != num_points / 2 + 1) {
+            EXPECT_EQ(points[i], expected[i]);
+        }
+    }
+}
+
+TYPED_TEST(BatchAffineTests, Normalize)
+{
+    using BatchAffine = typename TestFixture::BatchAffine;
+    using Element = typename TestFixture::Element;
+    using AffineElement = typename TestFixture::AffineElement;
+    constexpr size_t num_points = 1000;
+    std::vector<Element> points(num_points);
+    std::vector<AffineElement> expected(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = Element::random_element(&engine);
+        points[i] = points[i].dbl(); // z != 1
+        expected[i] = AffineElement(points[i]);
+    }
+
+    BatchAffine::template normalize<Element>(points);
+    for (size_t i = 0; i < num_points; ++i) {
+        EXPECT_EQ(points[i].z, BatchAffine::Fq::one());
+        EXPECT_EQ(AffineElement(points[i].x, points[i].y), expected[i]);
+    }
+}
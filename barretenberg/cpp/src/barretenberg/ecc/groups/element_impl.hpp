@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/groups/batch_affine.hpp"
 #include "barretenberg/ecc/groups/element.hpp"
 #include "element.hpp"
 #include <cstdint>
@@ -721,61 +722,13 @@ void element<Fq, Fr, T>::batch_affine_add(const std::span<affine_element<Fq, Fr,
                                           const std::span<affine_element<Fq, Fr, T>>& second_group,
                                           const std::span<affine_element<Fq, Fr, T>>& results) noexcept
 {
-    typedef affine_element<Fq, Fr, T> affine_element;
     const size_t num_points = first_group.size();
     ASSERT(second_group.size() == first_group.size());
 
-    // Space for temporary values
-    std::vector<Fq> scratch_space(num_points);
-
     parallel_for_heuristic(
         num_points, [&](size_t i) { results[i] = first_group[i]; }, thread_heuristics::FF_COPY_COST * 2);
 
-    // TODO(#826): Same code as in batch mul
-    //  we can mutate rhs but NOT lhs!
-    //  output is stored in rhs
-    /**
-     * @brief Perform point addition rhs[i]=rhs[i]+lhs[i] with batch inversion
-     *
-     */
-    const auto batch_affine_add_chunked =
-        [](const affine_element* lhs, affine_element* rhs, const size_t point_count, Fq* personal_scratch_space) {
-            Fq batch_inversion_accumulator = Fq::one();
-
-            for (size_t i = 0; i < point_count; i += 1) {
-                personal_scratch_space[i] = lhs[i].x + rhs[i].x; // x2 + x1
-                rhs[i].x -= lhs[i].x;                            // x2 - x1
-                rhs[i].y -= lhs[i].y;                            // y2 - y1
-                rhs[i].y *= batch_inversion_accumulator;         // (y2 - y1)*accumulator_old
-                batch_inversion_accumulator *= (rhs[i].x);
-            }
-            batch_inversion_accumulator = batch_inversion_accumulator.invert();
-
-            for (size_t i = (point_count)-1; i < point_count; i -= 1) {
-                rhs[i].y *= batch_inversion_accumulator; // update accumulator
-                batch_inversion_accumulator *= rhs[i].x;
-                rhs[i].x = rhs[i].y.sqr();
-                rhs[i].x = rhs[i].x - (personal_scratch_space[i]); // x3 = lambda_squared - x2
-                                                                   // - x1
-                personal_scratch_space[i] = lhs[i].x - rhs[i].x;
-                personal_scratch_space[i] *= rhs[i].y;
-                rhs[i].y = personal_scratch_space[i] - lhs[i].y;
-            }
-        };
-
-    /**
-     * @brief Perform batch affine addition in parallel
-     *
-     */
-    const auto batch_affine_add_internal = [&](const affine_element* lhs, affine_element* rhs) {
-        parallel_for_heuristic(
-            num_points,
-            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
-                batch_affine_add_chunked(lhs + start, rhs + start, end - start, &scratch_space[0] + start);
-            },
-            thread_heuristics::FF_ADDITION_COST * 6 + thread_heuristics::FF_MULTIPLICATION_COST * 6);
-    };
-    batch_affine_add_internal(&second_group[0], &results[0]);
+    BatchAffine<affine_element<Fq, Fr, T>>::add_in_place_unchecked(second_group, results.subspan(0, num_points));
 }
 
 /**
@@ -799,94 +752,14 @@ std::vector<affine_element<Fq, Fr, T>> element<Fq, Fr, T>::batch_mul_with_endomo
     // Space for temporary values
     std::vector<Fq> scratch_space(num_points);
 
-    // TODO(#826): Same code as in batch add
-    //  we can mutate rhs but NOT lhs!
-    //  output is stored in rhs
-    /**
-     * @brief Perform point addition rhs[i]=rhs[i]+lhs[i] with batch inversion
-     *
-     */
-    const auto batch_affine_add_chunked =
-        [](const affine_element* lhs, affine_element* rhs, const size_t point_count, Fq* personal_scratch_space) {
-            Fq batch_inversion_accumulator = Fq::one();
-
-            for (size_t i = 0; i < point_count; i += 1) {
-                personal_scratch_space[i] = lhs[i].x + rhs[i].x; // x2 + x1
-                rhs[i].x -= lhs[i].x;                            // x2 - x1
-                rhs[i].y -= lhs[i].y;                            // y2 - y1
-                rhs[i].y *= batch_inversion_accumulator;         // (y2 - y1)*accumulator_old
-                batch_inversion_accumulator *= (rhs[i].x);
-            }
-            batch_inversion_accumulator = batch_inversion_accumulator.invert();
-
-            for (size_t i = (point_count)-1; i < point_count; i -= 1) {
-                rhs[i].y *= batch_inversion_accumulator; // update accumulator
-                batch_inversion_accumulator *= rhs[i].x;
-                rhs[i].x = rhs[i].y.sqr();
-                rhs[i].x = rhs[i].x - (personal_scratch_space[i]); // x3 = lambda_squared - x2
-                                                                   // - x1
-                personal_scratch_space[i] = lhs[i].x - rhs[i].x;
-                personal_scratch_space[i] *= rhs[i].y;
-                rhs[i].y = personal_scratch_space[i] - lhs[i].y;
-            }
-        };
-
-    /**
-     * @brief Perform batch affine addition in parallel
-     *
-     */
-    const auto batch_affine_add_internal =
-        [num_points, &scratch_space, &batch_affine_add_chunked](const affine_element* lhs, affine_element* rhs) {
-            parallel_for_heuristic(
-                num_points,
-                [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
-                    batch_affine_add_chunked(lhs + start, rhs + start, end - start, &scratch_space[0] + start);
-                },
-                thread_heuristics::FF_ADDITION_COST * 6 + thread_heuristics::FF_MULTIPLICATION_COST * 6);
-        };
-
-    /**
-     * @brief Perform point doubling lhs[i]=lhs[i]+lhs[i] with batch inversion
-     *
-     */
-    const auto batch_affine_double_chunked =
-        [](affine_element* lhs, const size_t point_count, Fq* personal_scratch_space) {
-            Fq batch_inversion_accumulator = Fq::one();
-
-            for (size_t i = 0; i < point_count; i += 1) {
-
-                personal_scratch_space[i] = lhs[i].x.sqr();
-                personal_scratch_space[i] =
-                    personal_scratch_space[i] + personal_scratch_space[i] + personal_scratch_space[i];
-
-                personal_scratch_space[i] *= batch_inversion_accumulator;
-
-                batch_inversion_accumulator *= (lhs[i].y + lhs[i].y);
-            }
-            batch_inversion_accumulator = batch_inversion_accumulator.invert();
-
-            Fq temp;
-            for (size_t i = (point_count)-1; i < point_count; i -= 1) {
-
-                personal_scratch_space[i] *= batch_inversion_accumulator;
-                batch_inversion_accumulator *= (lhs[i].y + lhs[i].y);
-
-                temp = lhs[i].x;
-                lhs[i].x = personal_scratch_space[i].sqr() - (lhs[i].x + lhs[i].x);
-                lhs[i].y = personal_scratch_space[i] * (temp - lhs[i].x) - lhs[i].y;
-            }
-        };
-    /**
-     * @brief Perform point doubling in parallel
-     *
-     */
-    const auto batch_affine_double = [num_points, &scratch_space, &batch_affine_double_chunked](affine_element* lhs) {
-        parallel_for_heuristic(
-            num_points,
-            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
-                batch_affine_double_chunked(lhs + start, end - start, &scratch_space[0] + start);
-            },
-            thread_heuristics::FF_ADDITION_COST * 7 + thread_heuristics::FF_MULTIPLICATION_COST * 6);
+    // Perform point addition rhs[i]=rhs[i]+lhs[i] and doubling lhs[i]=lhs[i]+lhs[i] with batch inversion
+    using BatchOps = BatchAffine<affine_element>;
+    const auto batch_affine_add_internal = [num_points, &scratch_space](const affine_element* lhs,
+                                                                          affine_element* rhs) {
+        BatchOps::add_in_place_unchecked({ lhs, num_points }, { rhs, num_points }, scratch_space);
+    };
+    const auto batch_affine_double = [num_points, &scratch_space](affine_element* lhs) {
+        BatchOps::double_in_place({ lhs, num_points }, scratch_space);
     };
 
     // We compute the resulting point through WNAF by evaluating (the (\sum_i (16ⁱ⋅
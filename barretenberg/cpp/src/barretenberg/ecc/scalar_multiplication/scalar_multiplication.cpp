@@ -12,6 +12,7 @@
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/groups/batch_affine.hpp"
 #include "barretenberg/ecc/groups/wnaf.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 
@@ -312,41 +313,8 @@ void add_affine_points(typename Curve::AffineElement* points,
                        const size_t num_points,
                        typename Curve::BaseField* scratch_space)
 {
-    using Fq = typename Curve::BaseField;
-    Fq batch_inversion_accumulator = Fq::one();
-
-    for (size_t i = 0; i < num_points; i += 2) {
-        scratch_space[i >> 1] = points[i].x + points[i + 1].x; // x2 + x1
-        points[i + 1].x -= points[i].x;                        // x2 - x1
-        points[i + 1].y -= points[i].y;                        // y2 - y1
-        points[i + 1].y *= batch_inversion_accumulator;        // (y2 - y1)*accumulator_old
-        batch_inversion_accumulator *= (points[i + 1].x);
-    }
-
-    if (batch_inversion_accumulator == 0) {
-        throw_or_abort("attempted to invert zero in add_affine_points");
-    } else {
-        batch_inversion_accumulator = batch_inversion_accumulator.invert();
-    }
-
-    for (size_t i = (num_points)-2; i < num_points; i -= 2) {
-        // Memory bandwidth is a bit of a bottleneck here.
-        // There's probably a more elegant way of structuring our data so we don't need to do all of this
-        // prefetching
-        __builtin_prefetch(points + i - 2);
-        __builtin_prefetch(points + i - 1);
-        __builtin_prefetch(points + ((i + num_points - 2) >> 1));
-        __builtin_prefetch(scratch_space + ((i - 2) >> 1));
-
-        points[i + 1].y *= batch_inversion_accumulator; // update accumulator
-        batch_inversion_accumulator *= points[i + 1].x;
-        points[i + 1].x = points[i + 1].y.sqr();
-        points[(i + num_points) >> 1].x = points[i + 1].x - (scratch_space[i >> 1]); // x3 = lambda_squared - x2
-                                                                                     // - x1
-        points[i].x -= points[(i + num_points) >> 1].x;
-        points[i].x *= points[i + 1].y;
-        points[(i + num_points) >> 1].y = points[i].x - points[i].y;
-    }
+    group_elements::BatchAffine<typename Curve::AffineElement>::add_adjacent_pairs_unchecked(
+        points, num_points, scratch_space);
 }
 
 template <typename Curve>
@@ -354,65 +322,7 @@ void add_affine_points_with_edge_cases(typename Curve::AffineElement* points,
                                        const size_t num_points,
                                        typename Curve::BaseField* scratch_space)
 {
-    using Fq = typename Curve::BaseField;
-    Fq batch_inversion_accumulator = Fq::one();
-
-    for (size_t i = 0; i < num_points; i += 2) {
-        if (points[i].is_point_at_infinity() || points[i + 1].is_point_at_infinity()) {
-            continue;
-        }
-        if (points[i].x == points[i + 1].x) {
-            if (points[i].y == points[i + 1].y) {
-                // double
-                scratch_space[i >> 1] = points[i].x + points[i].x; // 2x
-                Fq x_squared = points[i].x.sqr();
-                points[i + 1].x = points[i].y + points[i].y;         // 2y
-                points[i + 1].y = x_squared + x_squared + x_squared; // 3x^2
-                points[i + 1].y *= batch_inversion_accumulator;
-                batch_inversion_accumulator *= (points[i + 1].x);
-                continue;
-            }
-            points[i].self_set_infinity();
-            points[i + 1].self_set_infinity();
-            continue;
-        }
-
-        scratch_space[i >> 1] = points[i].x + points[i + 1].x; // x2 + x1
-        points[i + 1].x -= points[i].x;                        // x2 - x1
-        points[i + 1].y -= points[i].y;                        // y2 - y1
-        points[i + 1].y *= batch_inversion_accumulator;        // (y2 - y1)*accumulator_old
-        batch_inversion_accumulator *= (points[i + 1].x);
-    }
-    if (!batch_inversion_accumulator.is_zero()) {
-        batch_inversion_accumulator = batch_inversion_accumulator.invert();
-    }
-    for (size_t i = (num_points)-2; i < num_points; i -= 2) {
-        // Memory bandwidth is a bit of a bottleneck here.
-        // There's probably a more elegant way of structuring our data so we don't need to do all of this
-        // prefetching
-        __builtin_prefetch(points + i - 2);
-        __builtin_prefetch(points + i - 1);
-        __builtin_prefetch(points + ((i + num_points - 2) >> 1));
-        __builtin_prefetch(scratch_space + ((i - 2) >> 1));
-
-        if (points[i].is_point_at_infinity()) {
-            points[(i + num_points) >> 1] = points[i + 1];
-            continue;
-        }
-        if (points[i + 1].is_point_at_infinity()) {
-            points[(i + num_points) >> 1] = points[i];
-            continue;
-        }
-
-        points[i + 1].y *= batch_inversion_accumulator; // update accumulator
-        batch_inversion_accumulator *= points[i + 1].x;
-        points[i + 1].x = points[i + 1].y.sqr();
-        points[(i + num_points) >> 1].x = points[i + 1].x - (scratch_space[i >> 1]); // x3 = lambda_squared - x2
-                                                                                     // - x1
-        points[i].x -= points[(i + num_points) >> 1].x;
-        points[i].x *= points[i + 1].y;
-        points[(i + num_points) >> 1].y = points[i].x - points[i].y;
-    }
+    group_elements::BatchAffine<typename Curve::AffineElement>::add_adjacent_pairs(points, num_points, scratch_space);
 }
 
 /**
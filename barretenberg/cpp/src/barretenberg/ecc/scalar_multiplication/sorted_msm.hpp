@@ -3,6 +3,7 @@
 #include "./runtime_states.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/groups/batch_affine.hpp"
 #include <cstddef>
 #include <cstdint>
 
@@ -76,15 +77,7 @@ template <typename Curve> class MsmSorter {
      */
     inline G1 affine_add_with_denominator(const G1& point_1, const G1& point_2, const Fq& denominator)
     {
-        const auto& x1 = point_1.x;
-        const auto& y1 = point_1.y;
-        const auto& x2 = point_2.x;
-        const auto& y2 = point_2.y;
-
-        const Fq lambda = denominator * (y2 - y1);
-        Fq x3 = lambda.sqr() - x2 - x1;
-        Fq y3 = lambda * (x1 - x3) - y1;
-        return { x3, y3 };
+        return group_elements::BatchAffine<G1>::add_with_slope_inverse(point_1, point_2, denominator);
     }
 };
 
@@ -3,6 +3,8 @@
 #include <cstddef>
 
 #include "./eccvm_builder_types.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/groups/batch_affine.hpp"
 #include "barretenberg/stdlib_circuit_builders/op_queue/ecc_op_queue.hpp"
 
 namespace bb {
@@ -137,9 +139,9 @@ class ECCVMMSMMBuilder {
         msm_rows[0] = (MSMRow{});
         // compute "read counts" so that we can determine the number of times entries in our log-derivative lookup
         // tables are called.
-        // Note: this part is single-threaded. The amount of compute is low, however, so this is likely not a big
-        // concern.
-        for (size_t msm_idx = 0; msm_idx < msms.size(); ++msm_idx) {
+        // Each MSM reads from the tables of its own points only, i.e. from a disjoint range of rows, so MSMs can be
+        // processed in parallel.
+        parallel_for(msms.size(), [&](size_t msm_idx) {
             for (size_t digit_idx = 0; digit_idx < NUM_WNAF_DIGITS_PER_SCALAR; ++digit_idx) {
                 auto pc = static_cast<uint32_t>(pc_values[msm_idx]);
                 const auto& msm = msms[msm_idx];
@@ -182,7 +184,7 @@ class ECCVMMSMMBuilder {
                     }
                 }
             }
-        }
+        });
 
         // The execution trace data for the MSM columns requires knowledge of intermediate values from *affine* point
         // addition. The naive solution to compute this data requires 2 field inversions per in-circuit group addition
@@ -204,7 +206,8 @@ class ECCVMMSMMBuilder {
         std::span<Element> p2_trace(&points_to_normalize[num_point_adds_and_doubles], num_point_adds_and_doubles);
         std::span<Element> p3_trace(&points_to_normalize[num_point_adds_and_doubles * 2], num_point_adds_and_doubles);
         // operation_trace records whether an entry in the p1/p2/p3 trace represents a point addition or doubling
-        std::vector<bool> operation_trace(num_point_adds_and_doubles);
+        // (one byte per entry rather than std::vector<bool>, as entries are written concurrently)
+        std::vector<uint8_t> operation_trace(num_point_adds_and_doubles);
         // accumulator_trace tracks the value of the ECCVM accumulator for each row
         std::span<Element> accumulator_trace(&points_to_normalize[num_point_adds_and_doubles * 3], num_accumulators);
 
@@ -212,10 +215,11 @@ class ECCVMMSMMBuilder {
         constexpr auto offset_generator = bb::g1::derive_generators("ECCVM_OFFSET_GENERATOR", 1)[0];
         accumulator_trace[0] = offset_generator;
 
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/973): Reinstate multitreading?
         // populate point trace, and the components of the MSM execution trace that do not relate to affine point
-        // operations
-        for (size_t msm_idx = 0; msm_idx < msms.size(); msm_idx++) {
+        // operations.
+        // Every MSM restarts its accumulator at the offset generator and owns the rows starting at
+        // msm_row_counts[msm_idx] (and the corresponding point trace entries), so MSMs are processed in parallel
+        parallel_for(msms.size(), [&](size_t msm_idx) {
             Element accumulator = offset_generator;
             const auto& msm = msms[msm_idx];
             size_t msm_row_index = msm_row_counts[msm_idx];
@@ -259,7 +263,7 @@ class ECCVMMSMMBuilder {
                         p1_trace[trace_index] = p1;
                         p2_trace[trace_index] = p2;
                         p3_trace[trace_index] = accumulator;
-                        operation_trace[trace_index] = false;
+                        operation_trace[trace_index] = 0;
                         trace_index++;
                     }
                     accumulator_trace[msm_row_index] = accumulator;
@@ -293,7 +297,7 @@ class ECCVMMSMMBuilder {
                         p2_trace[trace_index] = accumulator;
                         accumulator = accumulator.dbl();
                         p3_trace[trace_index] = accumulator;
-                        operation_trace[trace_index] = true;
+                        operation_trace[trace_index] = 1;
                         trace_index++;
                     }
                     accumulator_trace[msm_row_index] = accumulator;
@@ -323,7 +327,7 @@ class ECCVMMSMMBuilder {
                             p1_trace[trace_index] = p1;
                             p2_trace[trace_index] = add_state.point;
                             p3_trace[trace_index] = accumulator;
-                            operation_trace[trace_index] = false;
+                            operation_trace[trace_index] = 0;
                             trace_index++;
                         }
                         row.q_add = false;
@@ -338,18 +342,16 @@ class ECCVMMSMMBuilder {
                     }
                 }
             }
-        }
+        });
 
         // Normalize the points in the point trace
-        parallel_for_range(points_to_normalize.size(), [&](size_t start, size_t end) {
-            Element::batch_normalize(&points_to_normalize[start], end - start);
-        });
+        group_elements::BatchAffine<AffineElement>::normalize<Element>(points_to_normalize);
 
         // inverse_trace is used to compute the value of the `collision_inverse` column in the ECCVM.
         std::vector<FF> inverse_trace(num_point_adds_and_doubles);
         parallel_for_range(num_point_adds_and_doubles, [&](size_t start, size_t end) {
             for (size_t operation_idx = start; operation_idx < end; ++operation_idx) {
-                if (operation_trace[operation_idx]) {
+                if (operation_trace[operation_idx] != 0) {
                     inverse_trace[operation_idx] = (p1_trace[operation_idx].y + p1_trace[operation_idx].y);
                 } else {
                     inverse_trace[operation_idx] = (p2_trace[operation_idx].x - p1_trace[operation_idx].x);
@@ -361,7 +363,7 @@ class ECCVMMSMMBuilder {
         // complete the computation of the ECCVM execution trace, by adding the affine intermediate point data
         // i.e. row.accumulator_x, row.accumulator_y, row.add_state[0...3].collision_inverse,
         // row.add_state[0...3].lambda
-        for (size_t msm_idx = 0; msm_idx < msms.size(); msm_idx++) {
+        parallel_for(msms.size(), [&](size_t msm_idx) {
             const auto& msm = msms[msm_idx];
             size_t trace_index = ((msm_row_counts[msm_idx] - 1) * ADDITIONS_PER_ROW);
             size_t msm_row_index = msm_row_counts[msm_idx];
@@ -433,7 +435,7 @@ class ECCVMMSMMBuilder {
                     }
                 }
             }
-        }
+        });
 
         // populate the final row in the MSM execution trace.
         // we always require 1 extra row at the end of the trace, because the accumulator x/y coordinates for row `i`
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "./eccvm_builder_types.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/groups/batch_affine.hpp"
 
 namespace bb {
 
@@ -104,9 +106,25 @@ class ECCVMTranscriptBuilder {
         std::vector<FF> add_lambda_denominator(num_vm_entries);
         std::vector<FF> add_lambda_numerator(num_vm_entries);
         std::vector<FF> msm_count_at_transition_inverse_trace(num_vm_entries);
-        std::vector<Element> msm_accumulator_trace(num_vm_entries);
-        std::vector<Element> accumulator_trace(num_vm_entries);
-        std::vector<Element> intermediate_accumulator_trace(num_vm_entries);
+        // The three accumulator traces share one vector, so that they are normalized in a single pass
+        std::vector<Element> points_to_normalize(num_vm_entries * 3);
+        std::span<Element> msm_accumulator_trace(&points_to_normalize[0], num_vm_entries);
+        std::span<Element> accumulator_trace(&points_to_normalize[num_vm_entries], num_vm_entries);
+        std::span<Element> intermediate_accumulator_trace(&points_to_normalize[num_vm_entries * 2], num_vm_entries);
+
+        // The scalar multiplications are the bulk of the work and do not depend on the VM state, so we compute them
+        // in parallel ahead of the (sequential) state transitions
+        std::vector<Element> scaled_base_points(num_vm_entries);
+        parallel_for_heuristic(
+            num_vm_entries,
+            [&](size_t i) {
+                const auto& entry = vm_operations[i];
+                if (entry.mul) {
+                    scaled_base_points[i] = Element(entry.base_point) * entry.mul_scalar_full;
+                }
+            },
+            thread_heuristics::SM_COST);
+
         VMState state{
             .pc = total_number_of_muls,
             .count = 0,
@@ -154,9 +172,8 @@ class ECCVMTranscriptBuilder {
             bool current_ongoing_msm = entry.mul && !next_not_msm;
             updated_state.count = current_ongoing_msm ? state.count + num_muls : 0;
             if (current_msm) {
-                const auto P = typename CycleGroup::element(entry.base_point);
                 const auto R = typename CycleGroup::element(state.msm_accumulator);
-                updated_state.msm_accumulator = R + P * entry.mul_scalar_full;
+                updated_state.msm_accumulator = R + scaled_base_points[i];
             }
 
             if (msm_transition) {
@@ -215,106 +232,108 @@ class ECCVMTranscriptBuilder {
                 state.msm_accumulator = offset_generator();
             }
         }
-        Element::batch_normalize(&accumulator_trace[0], accumulator_trace.size());
-        Element::batch_normalize(&msm_accumulator_trace[0], msm_accumulator_trace.size());
-        Element::batch_normalize(&intermediate_accumulator_trace[0], intermediate_accumulator_trace.size());
+        group_elements::BatchAffine<AffineElement>::normalize<Element>(points_to_normalize);
 
-        for (size_t i = 0; i < accumulator_trace.size(); ++i) {
-            if (!accumulator_trace[i].is_point_at_infinity()) {
-                transcript_state[i + 1].accumulator_x = accumulator_trace[i].x;
-                transcript_state[i + 1].accumulator_y = accumulator_trace[i].y;
-            }
-            if (!msm_accumulator_trace[i].is_point_at_infinity()) {
-                transcript_state[i + 1].msm_output_x = msm_accumulator_trace[i].x;
-                transcript_state[i + 1].msm_output_y = msm_accumulator_trace[i].y;
-            }
-            if (!intermediate_accumulator_trace[i].is_point_at_infinity()) {
-                transcript_state[i + 1].transcript_msm_intermediate_x = intermediate_accumulator_trace[i].x;
-                transcript_state[i + 1].transcript_msm_intermediate_y = intermediate_accumulator_trace[i].y;
-            }
-        }
-        for (size_t i = 0; i < accumulator_trace.size(); ++i) {
-            auto& row = transcript_state[i + 1];
-            const bool msm_transition = row.msm_transition;
-            const bool add = row.q_add;
-            if (msm_transition) {
-                Element msm_output = intermediate_accumulator_trace[i];
-                row.transcript_msm_infinity = msm_output.is_point_at_infinity();
-                if (!row.transcript_msm_infinity) {
-                    transcript_msm_x_inverse_trace[i] = (msm_accumulator_trace[i].x - offset_generator().x);
-                } else {
-                    transcript_msm_x_inverse_trace[i] = 0;
+        // Rows are independent once the accumulators are affine: compute the values to invert, batch invert them and
+        // complete the rows chunk by chunk
+        parallel_for_range(num_vm_entries, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                if (!accumulator_trace[i].is_point_at_infinity()) {
+                    transcript_state[i + 1].accumulator_x = accumulator_trace[i].x;
+                    transcript_state[i + 1].accumulator_y = accumulator_trace[i].y;
                 }
-                auto lhsx = msm_output.is_point_at_infinity() ? 0 : msm_output.x;
-                auto lhsy = msm_output.is_point_at_infinity() ? 0 : msm_output.y;
-                auto rhsx = accumulator_trace[i].is_point_at_infinity() ? 0 : accumulator_trace[i].x;
-                auto rhsy = accumulator_trace[i].is_point_at_infinity() ? (0) : accumulator_trace[i].y;
-                inverse_trace_x[i] = lhsx - rhsx;
-                inverse_trace_y[i] = lhsy - rhsy;
-            } else if (add) {
-                auto lhsx = row.base_x;
-                auto lhsy = row.base_y;
-                auto rhsx = accumulator_trace[i].is_point_at_infinity() ? 0 : accumulator_trace[i].x;
-                auto rhsy = accumulator_trace[i].is_point_at_infinity() ? (0) : accumulator_trace[i].y;
-                inverse_trace_x[i] = lhsx - rhsx;
-                inverse_trace_y[i] = lhsy - rhsy;
-            } else {
-                inverse_trace_x[i] = 0;
-                inverse_trace_y[i] = 0;
-            }
-            // msm transition = current row is doing a lookup to validate output = msm output
-            // i.e. next row is not part of MSM and current row is part of MSM
-            //   or next row is irrelevent and current row is a straight MUL
-            const bb::eccvm::VMOperation<CycleGroup>& entry = vm_operations[i];
-            if (entry.add || msm_transition) {
-                Element lhs = entry.add ? Element(entry.base_point) : intermediate_accumulator_trace[i];
-                Element rhs = accumulator_trace[i];
-                FF lhs_y = lhs.y;
-                FF lhs_x = lhs.x;
-                FF rhs_y = rhs.y;
-                FF rhs_x = rhs.x;
-                if (rhs.is_point_at_infinity()) {
-                    rhs_y = 0;
-                    rhs_x = 0;
+                if (!msm_accumulator_trace[i].is_point_at_infinity()) {
+                    transcript_state[i + 1].msm_output_x = msm_accumulator_trace[i].x;
+                    transcript_state[i + 1].msm_output_y = msm_accumulator_trace[i].y;
+                }
+                if (!intermediate_accumulator_trace[i].is_point_at_infinity()) {
+                    transcript_state[i + 1].transcript_msm_intermediate_x = intermediate_accumulator_trace[i].x;
+                    transcript_state[i + 1].transcript_msm_intermediate_y = intermediate_accumulator_trace[i].y;
                 }
-                if (lhs.is_point_at_infinity()) {
-                    lhs_y = 0;
-                    lhs_x = 0;
+            }
+            for (size_t i = start; i < end; ++i) {
+                auto& row = transcript_state[i + 1];
+                const bool msm_transition = row.msm_transition;
+                const bool add = row.q_add;
+                if (msm_transition) {
+                    Element msm_output = intermediate_accumulator_trace[i];
+                    row.transcript_msm_infinity = msm_output.is_point_at_infinity();
+                    if (!row.transcript_msm_infinity) {
+                        transcript_msm_x_inverse_trace[i] = (msm_accumulator_trace[i].x - offset_generator().x);
+                    } else {
+                        transcript_msm_x_inverse_trace[i] = 0;
+                    }
+                    auto lhsx = msm_output.is_point_at_infinity() ? 0 : msm_output.x;
+                    auto lhsy = msm_output.is_point_at_infinity() ? 0 : msm_output.y;
+                    auto rhsx = accumulator_trace[i].is_point_at_infinity() ? 0 : accumulator_trace[i].x;
+                    auto rhsy = accumulator_trace[i].is_point_at_infinity() ? (0) : accumulator_trace[i].y;
+                    inverse_trace_x[i] = lhsx - rhsx;
+                    inverse_trace_y[i] = lhsy - rhsy;
+                } else if (add) {
+                    auto lhsx = row.base_x;
+                    auto lhsy = row.base_y;
+                    auto rhsx = accumulator_trace[i].is_point_at_infinity() ? 0 : accumulator_trace[i].x;
+                    auto rhsy = accumulator_trace[i].is_point_at_infinity() ? (0) : accumulator_trace[i].y;
+                    inverse_trace_x[i] = lhsx - rhsx;
+                    inverse_trace_y[i] = lhsy - rhsy;
+                } else {
+                    inverse_trace_x[i] = 0;
+                    inverse_trace_y[i] = 0;
                 }
-                row.transcript_add_x_equal =
-                    lhs_x == rhs_x || (lhs.is_point_at_infinity() && rhs.is_point_at_infinity()); // check infinity?
-                row.transcript_add_y_equal =
-                    lhs_y == rhs_y || (lhs.is_point_at_infinity() && rhs.is_point_at_infinity());
-                if ((lhs_x == rhs_x) && (lhs_y == rhs_y) && !lhs.is_point_at_infinity() &&
-                    !rhs.is_point_at_infinity()) {
-                    add_lambda_denominator[i] = lhs_y + lhs_y;
-                    add_lambda_numerator[i] = lhs_x * lhs_x * 3;
-                } else if ((lhs_x != rhs_x) && !lhs.is_point_at_infinity() && !rhs.is_point_at_infinity()) {
-                    add_lambda_denominator[i] = rhs_x - lhs_x;
-                    add_lambda_numerator[i] = rhs_y - lhs_y;
+                // msm transition = current row is doing a lookup to validate output = msm output
+                // i.e. next row is not part of MSM and current row is part of MSM
+                //   or next row is irrelevent and current row is a straight MUL
+                const bb::eccvm::VMOperation<CycleGroup>& entry = vm_operations[i];
+                if (entry.add || msm_transition) {
+                    Element lhs = entry.add ? Element(entry.base_point) : intermediate_accumulator_trace[i];
+                    Element rhs = accumulator_trace[i];
+                    FF lhs_y = lhs.y;
+                    FF lhs_x = lhs.x;
+                    FF rhs_y = rhs.y;
+                    FF rhs_x = rhs.x;
+                    if (rhs.is_point_at_infinity()) {
+                        rhs_y = 0;
+                        rhs_x = 0;
+                    }
+                    if (lhs.is_point_at_infinity()) {
+                        lhs_y = 0;
+                        lhs_x = 0;
+                    }
+                    row.transcript_add_x_equal =
+                        lhs_x == rhs_x || (lhs.is_point_at_infinity() && rhs.is_point_at_infinity()); // check infinity?
+                    row.transcript_add_y_equal =
+                        lhs_y == rhs_y || (lhs.is_point_at_infinity() && rhs.is_point_at_infinity());
+                    if ((lhs_x == rhs_x) && (lhs_y == rhs_y) && !lhs.is_point_at_infinity() &&
+                        !rhs.is_point_at_infinity()) {
+                        add_lambda_denominator[i] = lhs_y + lhs_y;
+                        add_lambda_numerator[i] = lhs_x * lhs_x * 3;
+                    } else if ((lhs_x != rhs_x) && !lhs.is_point_at_infinity() && !rhs.is_point_at_infinity()) {
+                        add_lambda_denominator[i] = rhs_x - lhs_x;
+                        add_lambda_numerator[i] = rhs_y - lhs_y;
+                    } else {
+                        add_lambda_numerator[i] = 0;
+                        add_lambda_denominator[i] = 0;
+                    }
                 } else {
+                    row.transcript_add_x_equal = 0;
+                    row.transcript_add_y_equal = 0;
                     add_lambda_numerator[i] = 0;
                     add_lambda_denominator[i] = 0;
                 }
-            } else {
-                row.transcript_add_x_equal = 0;
-                row.transcript_add_y_equal = 0;
-                add_lambda_numerator[i] = 0;
-                add_lambda_denominator[i] = 0;
             }
-        }
-        FF::batch_invert(&inverse_trace_x[0], num_vm_entries);
-        FF::batch_invert(&inverse_trace_y[0], num_vm_entries);
-        FF::batch_invert(&transcript_msm_x_inverse_trace[0], num_vm_entries);
-        FF::batch_invert(&add_lambda_denominator[0], num_vm_entries);
-        FF::batch_invert(&msm_count_at_transition_inverse_trace[0], num_vm_entries);
-        for (size_t i = 0; i < num_vm_entries; ++i) {
-            transcript_state[i + 1].base_x_inverse = inverse_trace_x[i];
-            transcript_state[i + 1].base_y_inverse = inverse_trace_y[i];
-            transcript_state[i + 1].transcript_msm_x_inverse = transcript_msm_x_inverse_trace[i];
-            transcript_state[i + 1].transcript_add_lambda = add_lambda_numerator[i] * add_lambda_denominator[i];
-            transcript_state[i + 1].msm_count_at_transition_inverse = msm_count_at_transition_inverse_trace[i];
-        }
+            FF::batch_invert(&inverse_trace_x[start], end - start);
+            FF::batch_invert(&inverse_trace_y[start], end - start);
+            FF::batch_invert(&transcript_msm_x_inverse_trace[start], end - start);
+            FF::batch_invert(&add_lambda_denominator[start], end - start);
+            FF::batch_invert(&msm_count_at_transition_inverse_trace[start], end - start);
+            for (size_t i = start; i < end; ++i) {
+                transcript_state[i + 1].base_x_inverse = inverse_trace_x[i];
+                transcript_state[i + 1].base_y_inverse = inverse_trace_y[i];
+                transcript_state[i + 1].transcript_msm_x_inverse = transcript_msm_x_inverse_trace[i];
+                transcript_state[i + 1].transcript_add_lambda = add_lambda_numerator[i] * add_lambda_denominator[i];
+                transcript_state[i + 1].msm_count_at_transition_inverse = msm_count_at_transition_inverse_trace[i];
+            }
+        });
         TranscriptRow& final_row = transcript_state.back();
         final_row.pc = updated_state.pc;
         final_row.accumulator_x =
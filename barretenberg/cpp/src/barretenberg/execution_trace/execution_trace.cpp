@@ -7,12 +7,15 @@
 namespace bb {
 
 template <class Flavor>
-void ExecutionTrace_<Flavor>::populate(Builder& builder, typename Flavor::ProvingKey& proving_key, bool is_structured)
+void ExecutionTrace_<Flavor>::populate(Builder& builder,
+                                      typename Flavor::ProvingKey& proving_key,
+                                      bool is_structured,
+                                      bool populate_precomputed)
 {
     ZoneScopedN("trace populate");
     // Share wire polynomials, selector polynomials between proving key and builder and copy cycles from raw circuit
     // data
-    auto trace_data = construct_trace_data(builder, proving_key, is_structured);
+    auto trace_data = construct_trace_data(builder, proving_key, is_structured, populate_precomputed);
 
     if constexpr (IsHonkFlavor<Flavor>) {
         proving_key.pub_inputs_offset = trace_data.pub_inputs_offset;
@@ -24,11 +27,11 @@ void ExecutionTrace_<Flavor>::populate(Builder& builder, typename Flavor::Provin
 
     if constexpr (IsGoblinFlavor<Flavor>) {
         ZoneScopedN("add_ecc_op_wires_to_proving_key");
-        add_ecc_op_wires_to_proving_key(builder, proving_key);
+        add_ecc_op_wires_to_proving_key(builder, proving_key, populate_precomputed);
     }
 
     // Compute the permutation argument polynomials (sigma/id) and add them to proving key
-    {
+    if (populate_precomputed) {
         ZoneScopedN("compute_permutation_argument_polynomials");
         compute_permutation_argument_polynomials<Flavor>(builder, &proving_key, trace_data.copy_cycles);
     }
@@ -53,10 +56,10 @@ void ExecutionTrace_<Flavor>::add_memory_records_to_proving_key(TraceData& trace
 
 template <class Flavor>
 typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_trace_data(
-    Builder& builder, typename Flavor::ProvingKey& proving_key, bool is_structured)
+    Builder& builder, typename Flavor::ProvingKey& proving_key, bool is_structured, bool populate_precomputed)
 {
     ZoneScopedN("construct_trace_data");
-    TraceData trace_data{ builder, proving_key };
+    TraceData trace_data{ builder, proving_key, populate_precomputed };
 
     // Complete the public inputs execution trace block from builder.public_inputs
     populate_public_inputs_block(builder);
@@ -84,25 +87,22 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
             for (uint32_t block_row_idx = 0; block_row_idx < block_size; ++block_row_idx) {
                 for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
                     uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables array
-                    uint32_t real_var_idx = builder.real_variable_index[var_idx];
                     uint32_t trace_row_idx = block_row_idx + offset;
                     // Insert the real witness values from this block into the wire polys at the correct offset
                     trace_data.wires[wire_idx][trace_row_idx] = builder.get_variable(var_idx);
                     // Add the address of the witness value to its corresponding copy cycle
-                    trace_data.copy_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, trace_row_idx });
+                    if (populate_precomputed) {
+                        uint32_t real_var_idx = builder.real_variable_index[var_idx];
+                        trace_data.copy_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, trace_row_idx });
+                    }
                 }
             }
         }
 
         // Insert the selector values for this block into the selector polynomials at the correct offset
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/398): implicit arithmetization/flavor consistency
-        for (size_t selector_idx = 0; selector_idx < NUM_USED_SELECTORS; selector_idx++) {
-            auto selector_poly = trace_data.selectors[selector_idx];
-            auto selector = block.selectors[selector_idx];
-            for (size_t row_idx = 0; row_idx < block_size; ++row_idx) {
-                size_t trace_row_idx = row_idx + offset;
-                trace_data.selectors[selector_idx][trace_row_idx] = selector[row_idx];
-            }
+        for (size_t selector_idx = 0; populate_precomputed && selector_idx < NUM_USED_SELECTORS; selector_idx++) {
+            block.selectors[selector_idx].copy_to(trace_data.selectors[selector_idx], offset);
         }
 
         // Store the offset of the block containing RAM/ROM read/write gates for use in updating memory records
@@ -144,7 +144,8 @@ template <class Flavor> void ExecutionTrace_<Flavor>::populate_public_inputs_blo
 
 template <class Flavor>
 void ExecutionTrace_<Flavor>::add_ecc_op_wires_to_proving_key(Builder& builder,
-                                                              typename Flavor::ProvingKey& proving_key)
+                                                              typename Flavor::ProvingKey& proving_key,
+                                                              bool populate_precomputed)
     requires IsGoblinFlavor<Flavor>
 {
     // Copy the ecc op data from the conventional wires into the op wires over the range of ecc op gates
@@ -155,7 +156,9 @@ void ExecutionTrace_<Flavor>::add_ecc_op_wires_to_proving_key(Builder& builder,
         for (size_t i = 0; i < builder.blocks.ecc_op.size(); ++i) {
             size_t idx = i + op_wire_offset;
             ecc_op_wire[idx] = wire[idx];
-            ecc_op_selector[idx] = 1; // construct selector as the indicator on the ecc op block
+            if (populate_precomputed) {
+                ecc_op_selector[idx] = 1; // construct selector as the indicator on the ecc op block
+            }
         }
     }
 }
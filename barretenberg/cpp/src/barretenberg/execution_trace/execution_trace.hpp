@@ -29,7 +29,7 @@ template <class Flavor> class ExecutionTrace_ {
         uint32_t ram_rom_offset = 0;    // offset of the RAM/ROM block in the execution trace
         uint32_t pub_inputs_offset = 0; // offset of the public inputs block in the execution trace
 
-        TraceData(Builder& builder, ProvingKey& proving_key)
+        TraceData(Builder& builder, ProvingKey& proving_key, bool populate_precomputed = true)
         {
             ZoneScopedN("TraceData constructor");
             if constexpr (IsHonkFlavor<Flavor>) {
@@ -54,7 +54,8 @@ template <class Flavor> class ExecutionTrace_ {
                     proving_key.polynomial_store.put(selector_tag, selectors[idx].share());
                 }
             }
-            {
+            // Copy cycles are only needed to compute the sigma/id polynomials
+            if (populate_precomputed) {
                 ZoneScopedN("copy cycle initialization");
                 copy_cycles.resize(builder.variables.size());
             }
@@ -71,8 +72,14 @@ template <class Flavor> class ExecutionTrace_ {
      *
      * @param builder
      * @param is_structured whether or not the trace is to be structured with a fixed block size
+     * @param populate_precomputed whether to construct the selector and sigma/id polynomials; set to false when the
+     * proving key already holds them (e.g. loaded from a PrecomputedPolynomialsCache), in which case only the
+     * witness-dependent data is populated
      */
-    static void populate(Builder& builder, ProvingKey&, bool is_structured = false);
+    static void populate(Builder& builder,
+                         ProvingKey&,
+                         bool is_structured = false,
+                         bool populate_precomputed = true);
 
   private:
     /**
@@ -98,11 +105,13 @@ template <class Flavor> class ExecutionTrace_ {
      * @param builder
      * @param dyadic_circuit_size
      * @param is_structured whether or not the trace is to be structured with a fixed block size
+     * @param populate_precomputed whether to construct selectors and copy cycles in addition to the wires
      * @return TraceData
      */
     static TraceData construct_trace_data(Builder& builder,
                                           typename Flavor::ProvingKey& proving_key,
-                                          bool is_structured = false);
+                                          bool is_structured = false,
+                                          bool populate_precomputed = true);
 
     /**
      * @brief Populate the public inputs block
@@ -119,8 +128,11 @@ template <class Flavor> class ExecutionTrace_ {
      *
      * @param builder
      * @param proving_key
+     * @param populate_precomputed whether to also construct the (precomputed) ecc op selector
      */
-    static void add_ecc_op_wires_to_proving_key(Builder& builder, typename Flavor::ProvingKey& proving_key)
+    static void add_ecc_op_wires_to_proving_key(Builder& builder,
+                                                typename Flavor::ProvingKey& proving_key,
+                                                bool populate_precomputed = true)
         requires IsGoblinFlavor<Flavor>;
 };
 
@@ -1,8 +1,56 @@
 #pragma once
+#include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <memory>
+#include <tuple>
 #include <typeinfo>
+#include <vector>
 
 namespace bb {
 
+/**
+ * @brief Fill the inverse polynomial of a log-derivative relation, processing chunks of rows in parallel
+ * @details Each chunk collects the rows at which an operation exists together with their denominators, through
+ * collect_chunk(start, end, rows, denominators), and inverts the denominators with a batch inversion of its own. Rows
+ * without an operation are never written, so the inverse polynomial must be zero there on entry, and a chunk in which
+ * no operation exists costs only the checks of its rows.
+ */
+template <typename FF, typename InversePolynomial, typename CollectChunk>
+void compute_logderivative_inverse_in_chunks(InversePolynomial& inverse_polynomial,
+                                             const size_t circuit_size,
+                                             const CollectChunk& collect_chunk,
+                                             const size_t row_cost)
+{
+    parallel_for_heuristic(
+        circuit_size,
+        [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+            std::vector<size_t> rows;
+            std::vector<FF> denominators;
+            collect_chunk(start, end, rows, denominators);
+            if (rows.empty()) {
+                return;
+            }
+            FF::batch_invert(denominators);
+            for (size_t j = 0; j < rows.size(); ++j) {
+                inverse_polynomial[rows[j]] = denominators[j];
+            }
+        },
+        // Every chunk pays for one inversion
+        row_cost + thread_heuristics::FF_INVERSION_COST / DEFAULT_MIN_ITERS_PER_THREAD);
+}
+
+/**
+ * @brief Relations whose read and write terms only depend on the columns returned by get_entities, among which those
+ * in [SELECTOR_ENTITIES_BEGIN, SELECTOR_ENTITIES_END) decide whether an operation exists at a row (generic lookups and
+ * permutations)
+ */
+template <typename Relation, typename Polynomials>
+concept HasLogDerivativeEntities = requires(Polynomials& polynomials) {
+    Relation::get_entities(polynomials);
+    Relation::SELECTOR_ENTITIES_BEGIN;
+    Relation::SELECTOR_ENTITIES_END;
+};
+
 /**
  * @brief Compute the inverse polynomial I(X) required for logderivative lookups
  * *
@@ -21,6 +69,11 @@ namespace bb {
  *
  * The specific algebraic relations that define read terms and write terms are defined in Flavor::LookupRelation
  *
+ * The rows are processed in parallel chunks (see compute_logderivative_inverse_in_chunks). For relations which expose
+ * the columns they use (HasLogDerivativeEntities) only these columns are read: the selector columns at every row, the
+ * remaining ones at rows where an operation exists. Other relations read whole rows with get_row.
+ *
+ * @note The rows are processed with parallel_for, so this must not be called from within a parallel_for.
  */
 template <typename Flavor, typename Relation, typename Polynomials>
 void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_parameters, const size_t circuit_size)
@@ -31,13 +84,8 @@ void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_para
     constexpr size_t WRITE_TERMS = Relation::WRITE_TERMS;
 
     auto& inverse_polynomial = Relation::template get_inverse_polynomial(polynomials);
-    for (size_t i = 0; i < circuit_size; ++i) {
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
-        auto row = polynomials.get_row(i);
-        bool has_inverse = Relation::operation_exists_at_row(row);
-        if (!has_inverse) {
-            continue;
-        }
+
+    const auto compute_denominator = [&](const auto& row) {
         FF denominator = 1;
         bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
             auto denominator_term =
@@ -49,11 +97,55 @@ void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_para
                 Relation::template compute_write_term<Accumulator, write_index>(row, relation_parameters);
             denominator *= denominator_term;
         });
-        inverse_polynomial[i] = denominator;
+        return denominator;
     };
 
-    // todo might be inverting zero in field bleh bleh
-    FF::batch_invert(inverse_polynomial);
+    if constexpr (HasLogDerivativeEntities<Relation, Polynomials>) {
+        constexpr size_t SELECTORS_BEGIN = Relation::SELECTOR_ENTITIES_BEGIN;
+        constexpr size_t SELECTORS_END = Relation::SELECTOR_ENTITIES_END;
+        const auto columns = Relation::get_entities(polynomials);
+        constexpr size_t NUM_ENTITIES = std::tuple_size_v<std::remove_cvref_t<decltype(columns)>>;
+
+        compute_logderivative_inverse_in_chunks<FF>(
+            inverse_polynomial,
+            circuit_size,
+            [&](size_t start, size_t end, std::vector<size_t>& rows, std::vector<FF>& denominators) {
+                // Only the entities of the relation are ever set in (or read from) this row
+                auto row = std::make_unique<typename Flavor::AllValues>();
+                auto values = Relation::get_entities(*row);
+                for (size_t i = start; i < end; ++i) {
+                    bb::constexpr_for<SELECTORS_BEGIN, SELECTORS_END, 1>(
+                        [&]<size_t k>() { std::get<k>(values) = std::get<k>(columns)[i]; });
+                    if (!Relation::operation_exists_at_row(*row)) {
+                        continue;
+                    }
+                    // The inverse polynomial itself (entity 0) is not an input
+                    bb::constexpr_for<1, SELECTORS_BEGIN, 1>(
+                        [&]<size_t k>() { std::get<k>(values) = std::get<k>(columns)[i]; });
+                    bb::constexpr_for<SELECTORS_END, NUM_ENTITIES, 1>(
+                        [&]<size_t k>() { std::get<k>(values) = std::get<k>(columns)[i]; });
+                    rows.emplace_back(i);
+                    denominators.emplace_back(compute_denominator(*row));
+                }
+            },
+            thread_heuristics::FF_COPY_COST * (SELECTORS_END - SELECTORS_BEGIN));
+    } else {
+        compute_logderivative_inverse_in_chunks<FF>(
+            inverse_polynomial,
+            circuit_size,
+            [&](size_t start, size_t end, std::vector<size_t>& rows, std::vector<FF>& denominators) {
+                for (size_t i = start; i < end; ++i) {
+                    // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
+                    auto row = polynomials.get_row(i);
+                    if (!Relation::operation_exists_at_row(row)) {
+                        continue;
+                    }
+                    rows.emplace_back(i);
+                    denominators.emplace_back(compute_denominator(row));
+                }
+            },
+            thread_heuristics::FF_COPY_COST * Flavor::NUM_ALL_ENTITIES);
+    }
 }
 
 /**
@@ -1,7 +1,10 @@
 #pragma once
 #include "barretenberg/common/ref_array.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/plonk_honk_shared/arithmetization/selector.hpp"
+#include <array>
 #include <cstddef>
+#include <string_view>
 
 #ifdef CHECK_CIRCUIT_STACKTRACES
 #include <backward.hpp>
@@ -40,7 +43,7 @@ enum class TraceStructure { NONE, SMALL_TEST, CLIENT_IVC_BENCH, AZTEC_IVC_BENCH,
  */
 template <typename FF, size_t NUM_WIRES, size_t NUM_SELECTORS> class ExecutionTraceBlock {
   public:
-    using SelectorType = SlabVector<FF>;
+    using SelectorType = Selector<FF>;
     using WireType = SlabVector<uint32_t>;
     using Selectors = std::array<SelectorType, NUM_SELECTORS>;
     using Wires = std::array<WireType, NUM_WIRES>;
@@ -74,6 +77,28 @@ template <typename FF, size_t NUM_WIRES, size_t NUM_SELECTORS> class ExecutionTr
 #endif
     }
 
+    /**
+     * @brief Append the gates [start, end) of another block, i.e. their wires and selectors, to this one
+     */
+    void append_gates(const ExecutionTraceBlock& other, size_t start, size_t end)
+    {
+        const auto first = static_cast<std::ptrdiff_t>(start);
+        const auto last = static_cast<std::ptrdiff_t>(end);
+        for (size_t idx = 0; idx < NUM_WIRES; ++idx) {
+            wires[idx].insert(wires[idx].end(), other.wires[idx].begin() + first, other.wires[idx].begin() + last);
+        }
+        for (size_t idx = 0; idx < NUM_SELECTORS; ++idx) {
+            for (size_t row_idx = start; row_idx < end; ++row_idx) {
+                selectors[idx].push_back(other.selectors[idx][row_idx]);
+            }
+        }
+#ifdef CHECK_CIRCUIT_STACKTRACES
+        auto& traces = stack_traces.stack_traces;
+        const auto& other_traces = other.stack_traces.stack_traces;
+        traces.insert(traces.end(), other_traces.begin() + first, other_traces.begin() + last);
+#endif
+    }
+
     uint32_t get_fixed_size() const { return fixed_size; }
     void set_fixed_size(uint32_t size_in) { fixed_size = size_in; }
 };
@@ -38,6 +38,12 @@ template <typename FF_> class MegaArith {
                              aux,    lookup,     busread,    poseidon_external, poseidon_internal };
         }
 
+        // Block names, in the same order as get()
+        static constexpr std::array<std::string_view, 10> labels = { "ecc_op",      "pub_inputs", "arithmetic",
+                                                                     "delta_range", "elliptic",   "aux",
+                                                                     "lookup",      "busread",    "poseidon_external",
+                                                                     "poseidon_internal" };
+
         bool operator==(const MegaTraceBlocks& other) const = default;
     };
 
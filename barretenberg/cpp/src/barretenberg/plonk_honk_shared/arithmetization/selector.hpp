@@ -0,0 +1,206 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief The values of a selector over the gates of an execution trace block
+ *
+ * @details Most selectors take a single value over a whole block: each gate selector is 1 in its own block and 0 in
+ * all others, and the arithmetic coefficients are 0 in most blocks other than the arithmetic one. Such a selector is
+ * stored as that constant value alone, i.e. it is never materialised while the circuit is built. The gates at which a
+ * mostly constant selector takes another value are stored as sparse exceptions. Once more than half of the gates are
+ * exceptions (e.g. for the coefficients of the arithmetic block) the selector switches to a dense vector.
+ *
+ * The values are only expanded into full length selector polynomials when the proving key is constructed, by copy_to.
+ *
+ * @tparam FF
+ */
+template <typename FF> class Selector {
+  public:
+    size_t size() const { return num_values; }
+    bool empty() const { return num_values == 0; }
+    bool is_dense() const { return dense; }
+
+    void reserve(size_t size_hint)
+    {
+        capacity_hint = size_hint;
+        if (dense) {
+            dense_values.reserve(size_hint);
+        }
+    }
+
+    void push_back(const FF& value)
+    {
+        if (dense) {
+            dense_values.emplace_back(value);
+        } else if (num_values == 0) {
+            constant_value = value;
+        } else if (value != constant_value) {
+            exception_indices.emplace_back(static_cast<uint32_t>(num_values));
+            exception_values.emplace_back(value);
+        }
+        num_values++;
+        densify_if_needed();
+    }
+
+    template <typename... Args> void emplace_back(Args&&... args) { push_back(FF(std::forward<Args>(args)...)); }
+
+    FF operator[](size_t idx) const
+    {
+        ASSERT(idx < num_values);
+        if (dense) {
+            return dense_values[idx];
+        }
+        auto it = std::lower_bound(exception_indices.begin(), exception_indices.end(), idx);
+        if (it != exception_indices.end() && *it == idx) {
+            return exception_values[static_cast<size_t>(it - exception_indices.begin())];
+        }
+        return constant_value;
+    }
+
+    /**
+     * @brief Set the value of the selector at an existing gate
+     */
+    void set(size_t idx, const FF& value)
+    {
+        ASSERT(idx < num_values);
+        if (dense) {
+            dense_values[idx] = value;
+            return;
+        }
+        auto it = std::lower_bound(exception_indices.begin(), exception_indices.end(), idx);
+        const auto pos = it - exception_indices.begin();
+        const bool is_exception = it != exception_indices.end() && *it == idx;
+        if (value == constant_value) {
+            if (is_exception) {
+                exception_indices.erase(it);
+                exception_values.erase(exception_values.begin() + pos);
+            }
+        } else if (is_exception) {
+            exception_values[static_cast<size_t>(pos)] = value;
+        } else {
+            exception_indices.insert(it, static_cast<uint32_t>(idx));
+            exception_values.insert(exception_values.begin() + pos, value);
+            densify_if_needed();
+        }
+    }
+
+    /**
+     * @brief Resize the selector, with the selector being zero at any new gate
+     */
+    void resize(size_t new_size)
+    {
+        if (dense) {
+            dense_values.resize(new_size, FF(0));
+            num_values = new_size;
+            return;
+        }
+        while (num_values < new_size) {
+            push_back(FF(0));
+            if (dense) {
+                resize(new_size);
+                return;
+            }
+        }
+        if (new_size < num_values) {
+            auto it = std::lower_bound(exception_indices.begin(), exception_indices.end(), new_size);
+            exception_values.resize(static_cast<size_t>(it - exception_indices.begin()));
+            exception_indices.erase(it, exception_indices.end());
+            num_values = new_size;
+        }
+    }
+
+    /**
+     * @brief Write the values of the selector to the rows [offset, offset + size()) of a zero-initialized polynomial
+     */
+    template <typename Polynomial> void copy_to(Polynomial& poly, size_t offset) const
+    {
+        if (dense) {
+            for (size_t idx = 0; idx < num_values; ++idx) {
+                poly[offset + idx] = dense_values[idx];
+            }
+            return;
+        }
+        if (!constant_value.is_zero()) {
+            for (size_t idx = 0; idx < num_values; ++idx) {
+                poly[offset + idx] = constant_value;
+            }
+        }
+        for (size_t i = 0; i < exception_indices.size(); ++i) {
+            poly[offset + exception_indices[i]] = exception_values[i];
+        }
+    }
+
+    // The underlying representation, e.g. for hashing the circuit structure
+    const FF& get_constant_value() const { return constant_value; }
+    const std::vector<uint32_t>& get_exception_indices() const { return exception_indices; }
+    const std::vector<FF>& get_exception_values() const { return exception_values; }
+    const SlabVector<FF>& get_dense_values() const { return dense_values; }
+
+    // Selectors are equal if they take the same values, whatever their representation
+    bool operator==(const Selector& other) const
+    {
+        if (num_values != other.num_values) {
+            return false;
+        }
+        for (size_t idx = 0; idx < num_values; ++idx) {
+            if ((*this)[idx] != other[idx]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Serialized as the vector of its values
+    template <typename B> friend void write(B& buf, const Selector& selector)
+    {
+        using serialize::write;
+        write(buf, static_cast<uint32_t>(selector.size()));
+        for (size_t idx = 0; idx < selector.size(); ++idx) {
+            write(buf, selector[idx]);
+        }
+    }
+
+  private:
+    // Below this many gates a selector is kept sparse, so that a few leading exceptions do not make it dense
+    static constexpr size_t MIN_DENSE_SIZE = 64;
+
+    size_t num_values = 0;
+    size_t capacity_hint = 0;
+    bool dense = false;
+    // Sparse representation: a constant value and the gates, in increasing order, at which the selector differs
+    FF constant_value = FF(0);
+    std::vector<uint32_t> exception_indices;
+    std::vector<FF> exception_values;
+    // Dense representation: one value per gate
+    SlabVector<FF> dense_values;
+
+    /**
+     * @brief Switch to the dense representation once more than half of the gates are exceptions, as the sparse one
+     * then saves little memory while its reads need a binary search
+     */
+    void densify_if_needed()
+    {
+        if (dense || num_values < MIN_DENSE_SIZE || 2 * exception_indices.size() <= num_values) {
+            return;
+        }
+        dense_values.reserve(std::max(capacity_hint, num_values));
+        dense_values.assign(num_values, constant_value);
+        for (size_t i = 0; i < exception_indices.size(); ++i) {
+            dense_values[exception_indices[i]] = exception_values[i];
+        }
+        exception_indices = {};
+        exception_values = {};
+        dense = true;
+    }
+};
+
+} // namespace bb
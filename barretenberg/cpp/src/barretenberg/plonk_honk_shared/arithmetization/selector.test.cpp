@@ -0,0 +1,171 @@
+#include "barretenberg/plonk_honk_shared/arithmetization/selector.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+}
+
+class SelectorTests : public ::testing::Test {
+  public:
+    using FF = fr;
+
+    // Check the values of a selector against those of a plain vector
+    static void expect_values(const Selector<FF>& selector, const std::vector<FF>& expected)
+    {
+        ASSERT_EQ(selector.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(selector[i], expected[i]);
+        }
+    }
+};
+
+/**
+ * @brief A selector taking a single value over the block stores no value per gate
+ */
+TEST_F(SelectorTests, Constant)
+{
+    Selector<FF> selector;
+    std::vector<FF> expected;
+    for (size_t i = 0; i < 1000; ++i) {
+        selector.push_back(1);
+        expected.emplace_back(1);
+    }
+
+    expect_values(selector, expected);
+    EXPECT_FALSE(selector.is_dense());
+    EXPECT_EQ(selector.get_constant_value(), FF(1));
+    EXPECT_TRUE(selector.get_exception_indices().empty());
+}
+
+/**
+ * @brief Values differing from the constant one are stored as exceptions, until they make up most of the selector
+ */
+TEST_F(SelectorTests, SparseThenDense)
+{
+    Selector<FF> selector;
+    std::vector<FF> expected;
+    for (size_t i = 0; i < 200; ++i) {
+        FF value = i % 10 == 5 ? FF::random_element(&engine) : FF(0);
+        selector.push_back(value);
+        expected.emplace_back(value);
+    }
+    expect_values(selector, expected);
+    EXPECT_FALSE(selector.is_dense());
+    EXPECT_EQ(selector.get_exception_indices().size(), 20);
+
+    for (size_t i = 0; i < 200; ++i) {
+        FF value = FF::random_element(&engine);
+        selector.push_back(value);
+        expected.emplace_back(value);
+    }
+    expect_values(selector, expected);
+    EXPECT_TRUE(selector.is_dense());
+}
+
+/**
+ * @brief Setting the value at an existing gate adds, updates or removes an exception
+ */
+TEST_F(SelectorTests, Set)
+{
+    Selector<FF> selector;
+    std::vector<FF> expected(100, FF(0));
+    for (size_t i = 0; i < expected.size(); ++i) {
+        selector.push_back(0);
+    }
+
+    selector.set(50, 3);
+    selector.set(10, 2);
+    selector.set(90, 4);
+    expected[50] = 3;
+    expected[10] = 2;
+    expected[90] = 4;
+    expect_values(selector, expected);
+    EXPECT_EQ(selector.get_exception_indices(), std::vector<uint32_t>({ 10, 50, 90 }));
+
+    selector.set(50, 5);
+    selector.set(10, 0);
+    expected[50] = 5;
+    expected[10] = 0;
+    expect_values(selector, expected);
+    EXPECT_EQ(selector.get_exception_indices(), std::vector<uint32_t>({ 50, 90 }));
+}
+
+/**
+ * @brief Resizing pads the selector with zeros or drops the trailing gates, in both representations
+ */
+TEST_F(SelectorTests, Resize)
+{
+    Selector<FF> sparse;
+    Selector<FF> dense;
+    std::vector<FF> expected;
+    for (size_t i = 0; i < 100; ++i) {
+        FF value = FF::random_element(&engine);
+        sparse.push_back(i == 70 ? value : FF(1));
+        dense.push_back(value);
+        expected.emplace_back(value);
+    }
+    EXPECT_FALSE(sparse.is_dense());
+    EXPECT_TRUE(dense.is_dense());
+
+    sparse.resize(50);
+    expect_values(sparse, std::vector<FF>(50, FF(1)));
+    sparse.resize(150);
+    std::vector<FF> padded(150, FF(0));
+    std::fill(padded.begin(), padded.begin() + 50, FF(1));
+    expect_values(sparse, padded);
+
+    dense.resize(50);
+    expected.resize(50);
+    expect_values(dense, expected);
+    dense.resize(150);
+    expected.resize(150, FF(0));
+    expect_values(dense, expected);
+}
+
+/**
+ * @brief Selectors are expanded into their rows of a polynomial, and compared by value whatever their representation
+ */
+TEST_F(SelectorTests, CopyToAndEquality)
+{
+    Selector<FF> sparse;
+    Selector<FF> dense;
+    std::vector<FF> expected;
+    for (size_t i = 0; i < 100; ++i) {
+        FF value = FF::random_element(&engine);
+        sparse.push_back(1);
+        dense.push_back(value);
+        expected.emplace_back(value);
+    }
+    for (size_t i = 0; i < 100; ++i) {
+        sparse.set(i, expected[i]);
+    }
+    EXPECT_EQ(sparse, dense);
+
+    const size_t offset = 7;
+    Polynomial<FF> poly(256);
+    dense.copy_to(poly, offset);
+    for (size_t i = 0; i < poly.size(); ++i) {
+        FF value = i >= offset && i < offset + expected.size() ? expected[i - offset] : FF(0);
+        EXPECT_EQ(poly[i], value);
+    }
+
+    Selector<FF> constant;
+    constant.push_back(1);
+    constant.push_back(1);
+    Polynomial<FF> constant_poly(4);
+    constant.copy_to(constant_poly, 1);
+    EXPECT_EQ(constant_poly[0], FF(0));
+    EXPECT_EQ(constant_poly[1], FF(1));
+    EXPECT_EQ(constant_poly[2], FF(1));
+    EXPECT_EQ(constant_poly[3], FF(0));
+
+    dense.set(5, dense[5] + 1);
+    EXPECT_NE(sparse, dense);
+}
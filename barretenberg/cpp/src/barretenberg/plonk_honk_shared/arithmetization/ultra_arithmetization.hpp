@@ -32,6 +32,11 @@ template <typename FF_> class UltraArith {
 
         auto get_for_ultra_keccak() { return RefArray{ pub_inputs, arithmetic, delta_range, elliptic, aux, lookup }; }
 
+        // Block names, in the same order as get()
+        static constexpr std::array<std::string_view, 8> labels = { "pub_inputs",        "arithmetic", "delta_range",
+                                                                    "elliptic",          "aux",        "lookup",
+                                                                    "poseidon_external", "poseidon_internal" };
+
         bool operator==(const UltraTraceBlocks& other) const = default;
     };
 
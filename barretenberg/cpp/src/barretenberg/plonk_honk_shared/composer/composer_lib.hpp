@@ -1,10 +1,14 @@
 #pragma once
 #include "barretenberg/common/ref_array.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/polynomials/polynomial_store.hpp"
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/types.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <vector>
 
 namespace bb {
 
@@ -25,17 +29,26 @@ void construct_lookup_table_polynomials(const RefArray<typename Flavor::Polynomi
     ASSERT(dyadic_circuit_size > circuit.get_tables_size() + additional_offset);
     size_t offset = dyadic_circuit_size - circuit.get_tables_size() - additional_offset;
 
+    // The tables occupy disjoint ranges of rows of the table polynomials, so they are filled in parallel
+    std::vector<size_t> table_offsets;
+    table_offsets.reserve(circuit.lookup_tables.size());
     for (const auto& table : circuit.lookup_tables) {
+        table_offsets.emplace_back(offset);
+        offset += table.size();
+    }
+
+    parallel_for(circuit.lookup_tables.size(), [&](size_t table_idx) {
+        const auto& table = circuit.lookup_tables[table_idx];
         const fr table_index(table.table_index);
+        const size_t table_offset = table_offsets[table_idx];
 
         for (size_t i = 0; i < table.size(); ++i) {
-            table_polynomials[0][offset] = table.column_1[i];
-            table_polynomials[1][offset] = table.column_2[i];
-            table_polynomials[2][offset] = table.column_3[i];
-            table_polynomials[3][offset] = table_index;
-            ++offset;
+            table_polynomials[0][table_offset + i] = table.column_1[i];
+            table_polynomials[1][table_offset + i] = table.column_2[i];
+            table_polynomials[2][table_offset + i] = table.column_3[i];
+            table_polynomials[3][table_offset + i] = table_index;
         }
-    }
+    });
 }
 
 /**
@@ -53,26 +66,52 @@ void construct_lookup_read_counts(typename Flavor::Polynomial& read_counts,
 {
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/1033): construct tables and counts at top of trace
     size_t offset = dyadic_circuit_size - circuit.get_tables_size();
+    auto& tables = circuit.lookup_tables;
 
-    size_t table_offset = offset; // offset of the present table in the table polynomials
-    // loop over all tables used in the circuit; each table contains data about the lookups made on it
-    for (auto& table : circuit.lookup_tables) {
-        table.initialize_index_map();
+    // The map from the entries of each table to their index is independent of the other tables
+    parallel_for(tables.size(), [&](size_t table_idx) { tables[table_idx].initialize_index_map(); });
 
-        for (auto& gate_data : table.lookup_gates) {
-            // convert lookup gate data to an array of three field elements, one for each of the 3 columns
-            auto table_entry = gate_data.to_table_components(table.use_twin_keys);
+    // Offsets of the tables in the table polynomials, and of their lookup gates in the concatenation of all of them
+    std::vector<size_t> table_offsets(tables.size() + 1, 0);
+    std::vector<size_t> gate_offsets(tables.size() + 1, 0);
+    for (size_t table_idx = 0; table_idx < tables.size(); ++table_idx) {
+        table_offsets[table_idx + 1] = table_offsets[table_idx] + tables[table_idx].size();
+        gate_offsets[table_idx + 1] = gate_offsets[table_idx] + tables[table_idx].lookup_gates.size();
+    }
 
-            // find the index of the entry in the table
-            auto index_in_table = table.index_map[table_entry];
+    // Count the reads of each table entry over all lookup gates in parallel. A few entries (e.g. the zero entry of a
+    // table) are read by most of the gates of their table, so the gates are split evenly rather than by table.
+    std::vector<std::atomic<uint32_t>> counts(circuit.get_tables_size());
+    parallel_for_heuristic(
+        gate_offsets.back(),
+        [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+            size_t table_idx = static_cast<size_t>(
+                std::upper_bound(gate_offsets.begin(), gate_offsets.end(), start) - gate_offsets.begin() - 1);
+            for (size_t gate_idx = start; gate_idx < end; ++gate_idx) {
+                while (gate_idx >= gate_offsets[table_idx + 1]) {
+                    ++table_idx;
+                }
+                const auto& table = tables[table_idx];
+                // find the index of the entry read by the gate in the table
+                size_t index_in_table = table.get_index(table.lookup_gates[gate_idx - gate_offsets[table_idx]]);
+                counts[table_offsets[table_idx] + index_in_table].fetch_add(1, std::memory_order_relaxed);
+            }
+        },
+        /* overestimate */ thread_heuristics::FF_MULTIPLICATION_COST * 2);
 
-            // increment the read count at the corresponding index in the full polynomial
-            size_t index_in_poly = table_offset + index_in_table;
-            read_counts[index_in_poly]++;
-            read_tags[index_in_poly] = 1; // tag is 1 if entry has been read 1 or more times
-        }
-        table_offset += table.size(); // set the offset of the next table within the polynomials
-    }
+    // Write the counts to the polynomials; the tag is 1 if the entry has been read 1 or more times
+    parallel_for_heuristic(
+        counts.size(),
+        [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+            for (size_t i = start; i < end; ++i) {
+                const uint32_t count = counts[i].load(std::memory_order_relaxed);
+                if (count != 0) {
+                    read_counts[offset + i] += count;
+                    read_tags[offset + i] = 1;
+                }
+            }
+        },
+        thread_heuristics::FF_COPY_COST * 2);
 }
 
 } // namespace bb
@@ -1,5 +1,9 @@
 #include "barretenberg/plonk_honk_shared/composer/composer_lib.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+#include "barretenberg/numeric/bitop/sparse_form.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/srs/factories/crs_factory.hpp"
+#include "barretenberg/stdlib_circuit_builders/plookup_tables/aes128.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 
@@ -75,4 +79,62 @@ TEST_F(ComposerLibTests, LookupReadCounts)
         }
         idx++;
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief The read counts match those found through the entry-index map of each table, both for tables indexed by their
+ * keys (uint32 XOR) and for tables whose keys are in sparse form and which are not (AES sbox)
+ *
+ */
+TEST_F(ComposerLibTests, LookupReadCountsMatchIndexMap)
+{
+    using Builder = UltraCircuitBuilder;
+    using Polynomial = typename Flavor::Polynomial;
+    auto UINT32_XOR = plookup::MultiTableId::UINT32_XOR;
+    auto AES_SBOX = plookup::MultiTableId::AES_SBOX;
+
+    Builder builder;
+    auto& engine = numeric::get_debug_randomness();
+    for (size_t i = 0; i < 16; ++i) {
+        FF left{ engine.get_random_uint32() };
+        FF right{ engine.get_random_uint32() };
+        auto left_idx = builder.add_variable(left);
+        auto right_idx = builder.add_variable(right);
+
+        auto xor_accumulators = plookup::get_lookup_accumulators(UINT32_XOR, left, right, /*is_2_to_1_lookup*/ true);
+        builder.create_gates_from_plookup_accumulators(UINT32_XOR, xor_accumulators, left_idx, right_idx);
+
+        // the AES sbox is looked up by the sparse form of a byte
+        FF sparse_byte{ numeric::map_into_sparse_form<plookup::aes128_tables::AES_BASE>(engine.get_random_uint8()) };
+        auto sparse_byte_idx = builder.add_variable(sparse_byte);
+        auto sbox_accumulators = plookup::get_lookup_accumulators(AES_SBOX, sparse_byte);
+        builder.create_gates_from_plookup_accumulators(AES_SBOX, sbox_accumulators, sparse_byte_idx);
+    }
+
+    size_t circuit_size = 1UL << (numeric::get_msb(builder.get_tables_size()) + 1);
+    Polynomial read_counts{ circuit_size };
+    Polynomial read_tags{ circuit_size };
+    construct_lookup_read_counts<Flavor>(read_counts, read_tags, builder, circuit_size);
+
+    std::vector<FF> expected_counts(circuit_size, 0);
+    size_t offset = circuit_size - builder.get_tables_size();
+    bool has_key_index = false;
+    bool has_no_key_index = false;
+    for (auto& table : builder.lookup_tables) {
+        plookup::LookupHashTable index_map;
+        index_map.initialize(table.column_1, table.column_2, table.column_3);
+        for (auto& gate_data : table.lookup_gates) {
+            expected_counts[offset + index_map[gate_data.to_table_components(table.use_twin_keys)]] += 1;
+        }
+        offset += table.size();
+        has_key_index |= table.key_index.is_initialized();
+        has_no_key_index |= !table.key_index.is_initialized();
+    }
+    EXPECT_TRUE(has_key_index);
+    EXPECT_TRUE(has_no_key_index);
+
+    for (size_t i = 0; i < circuit_size; ++i) {
+        EXPECT_EQ(read_counts[i], expected_counts[i]);
+        EXPECT_EQ(read_tags[i], expected_counts[i].is_zero() ? 0 : 1);
+    }
+}
@@ -105,6 +105,13 @@ template <typename Fr> Polynomial<Fr>::Polynomial(std::span<const Fr> coefficien
     memcpy(static_cast<void*>(data()), static_cast<const void*>(coefficients.data()), sizeof(Fr) * coefficients.size());
 }
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+template <typename Fr>
+Polynomial<Fr>::Polynomial(std::shared_ptr<Fr[]> backing_memory, size_t size, size_t virtual_size)
+{
+    coefficients_ = SharedShiftedVirtualZeroesArray<Fr>{ size, virtual_size, 0, std::move(backing_memory) };
+}
+
 // Assignments
 
 // full copy "expensive" assignment
@@ -27,6 +27,9 @@ template <typename Fr> class Polynomial {
   public:
     using FF = Fr;
     enum class DontZeroMemory { FLAG };
+    // When a polynomial is instantiated from a size alone, the memory allocated corresponds to
+    // input size + MAXIMUM_COEFFICIENT_SHIFT to support 'shifted' coefficients efficiently.
+    static constexpr size_t MAXIMUM_COEFFICIENT_SHIFT = 1;
 
     Polynomial(size_t size, size_t virtual_size);
     // Intended just for plonk, where size == virtual_size always
@@ -46,6 +49,14 @@ template <typename Fr> class Polynomial {
         : Polynomial(coefficients, coefficients.size())
     {}
 
+    /**
+     * @brief Construct a polynomial on top of existing backing memory (e.g. a memory-mapped file) without copying.
+     * @details The memory must hold size + MAXIMUM_COEFFICIENT_SHIFT elements with the trailing padding zeroed, so that
+     * the resulting polynomial can be shifted like one we allocated ourselves.
+     */
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    Polynomial(std::shared_ptr<Fr[]> backing_memory, size_t size, size_t virtual_size);
+
     // Allow polynomials to be entirely reset/dormant
     Polynomial() = default;
 
@@ -225,9 +236,6 @@ template <typename Fr> class Polynomial {
     bool in_place_operation_viable(size_t domain_size = 0) { return (size() >= domain_size); }
 
     void zero_memory_beyond(size_t start_position);
-    // When a polynomial is instantiated from a size alone, the memory allocated corresponds to
-    // input size + MAXIMUM_COEFFICIENT_SHIFT to support 'shifted' coefficients efficiently.
-    const static size_t MAXIMUM_COEFFICIENT_SHIFT = 1;
 
     // The underlying memory, with a bespoke (but minimal) shared array struct that fits our needs.
     // Namely, it supports polynomial shifts and 'virtual' zeroes past a size up until a 'virtual' size.
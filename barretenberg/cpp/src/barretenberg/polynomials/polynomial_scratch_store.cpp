@@ -0,0 +1,294 @@
+#include "polynomial_scratch_store.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <chrono>
+#include <cstring>
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace bb {
+
+namespace {
+#ifndef __wasm__
+size_t align_to_page(size_t bytes)
+{
+    static const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return (bytes + page_size - 1) / page_size * page_size;
+}
+#endif
+
+/**
+ * @brief Accumulates the wall time of its lifetime into a counter
+ */
+struct ScopedPagingTimer {
+    double& seconds;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    ~ScopedPagingTimer()
+    {
+        seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+};
+} // namespace
+
+template <typename Fr> PolynomialScratchStore<Fr>::PolynomialScratchStore(Options options)
+    : state(std::make_shared<State>())
+{
+    state->max_resident_bytes = options.max_resident_bytes;
+#ifndef __wasm__
+    std::string path_template = options.directory + "/bb_polynomials_XXXXXX";
+    state->fd = mkstemp(path_template.data());
+    if (state->fd < 0) {
+        throw_or_abort("PolynomialScratchStore: could not create a scratch file in " + options.directory);
+    }
+    // The file only lives as long as its descriptor: nothing is left behind if the prover dies
+    unlink(path_template.c_str());
+#endif
+}
+
+template <typename Fr> PolynomialScratchStore<Fr>::~PolynomialScratchStore() = default;
+
+template <typename Fr> PolynomialScratchStore<Fr>::State::~State()
+{
+#ifndef __wasm__
+    if (fd >= 0) {
+        close(fd);
+    }
+#endif
+}
+
+template <typename Fr>
+std::map<uintptr_t, typename PolynomialScratchStore<Fr>::Region>::iterator PolynomialScratchStore<Fr>::State::
+    find_region(const void* address)
+{
+    const auto key = reinterpret_cast<uintptr_t>(address);
+    auto it = regions.upper_bound(key);
+    if (it == regions.begin()) {
+        return regions.end();
+    }
+    --it;
+    return key < it->first + it->second.length ? it : regions.end();
+}
+
+template <typename Fr> void PolynomialScratchStore<Fr>::State::mark_resident(Region& region)
+{
+    if (region.released) {
+        eviction_queue.erase(region.release_position);
+        region.released = false;
+    }
+    if (!region.resident) {
+        region.resident = true;
+        resident_bytes += region.length;
+        statistics.peak_resident_bytes = std::max(statistics.peak_resident_bytes, resident_bytes);
+    }
+}
+
+template <typename Fr>
+void PolynomialScratchStore<Fr>::State::evict([[maybe_unused]] uintptr_t address, [[maybe_unused]] Region& region)
+{
+#ifndef __wasm__
+    auto* ptr = reinterpret_cast<void*>(address);
+    // Write dirty pages back so that dropping them loses nothing, then drop them from the process and the page cache
+    msync(ptr, region.length, MS_SYNC);
+    madvise(ptr, region.length, MADV_DONTNEED);
+#ifdef POSIX_FADV_DONTNEED
+    posix_fadvise(fd, static_cast<off_t>(region.file_offset), static_cast<off_t>(region.length), POSIX_FADV_DONTNEED);
+#endif
+    region.resident = false;
+    resident_bytes -= region.length;
+    statistics.num_evictions++;
+    statistics.bytes_evicted += region.length;
+#endif
+}
+
+template <typename Fr> void PolynomialScratchStore<Fr>::State::enforce_budget()
+{
+    while (resident_bytes > max_resident_bytes && !eviction_queue.empty()) {
+        const uintptr_t address = eviction_queue.front();
+        eviction_queue.pop_front();
+        auto& region = regions.at(address);
+        region.released = false;
+        evict(address, region);
+    }
+}
+
+template <typename Fr> void PolynomialScratchStore<Fr>::State::free_region(uintptr_t address)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = regions.find(address);
+    if (it == regions.end()) {
+        return;
+    }
+    auto& region = it->second;
+    if (region.released) {
+        eviction_queue.erase(region.release_position);
+    }
+    if (region.resident) {
+        resident_bytes -= region.length;
+    }
+#ifndef __wasm__
+    munmap(reinterpret_cast<void*>(address), region.length);
+#endif
+    free_regions.emplace(region.length, region.file_offset);
+    regions.erase(it);
+}
+
+template <typename Fr> Polynomial<Fr> PolynomialScratchStore<Fr>::adopt(const Polynomial<Fr>& polynomial)
+{
+#ifdef __wasm__
+    return polynomial.share();
+#else
+    std::lock_guard<std::mutex> lock(state->mutex);
+    ScopedPagingTimer timer{ state->statistics.paging_seconds };
+
+    const size_t size = polynomial.size();
+    const size_t length = align_to_page((size + Polynomial<Fr>::MAXIMUM_COEFFICIENT_SHIFT) * sizeof(Fr));
+
+    // Reuse a freed region of the same length if there is one, otherwise grow the scratch file
+    size_t file_offset = state->file_size;
+    if (auto it = state->free_regions.find(length); it != state->free_regions.end()) {
+        file_offset = it->second;
+        state->free_regions.erase(it);
+    } else {
+        if (ftruncate(state->fd, static_cast<off_t>(file_offset + length)) != 0) {
+            throw_or_abort("PolynomialScratchStore: could not grow the scratch file");
+        }
+        state->file_size += length;
+    }
+    void* addr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, state->fd, static_cast<off_t>(file_offset));
+    if (addr == MAP_FAILED) {
+        state->free_regions.emplace(length, file_offset);
+        throw_or_abort("PolynomialScratchStore: could not map the scratch file");
+    }
+    auto* coefficients = static_cast<Fr*>(addr);
+    if (size > 0) {
+        std::memcpy(static_cast<void*>(coefficients), polynomial.data(), size * sizeof(Fr));
+    }
+    // A reused region may hold stale data in the shift padding
+    std::memset(static_cast<void*>(coefficients + size), 0, Polynomial<Fr>::MAXIMUM_COEFFICIENT_SHIFT * sizeof(Fr));
+
+    const auto address = reinterpret_cast<uintptr_t>(addr);
+    auto& region = state->regions[address];
+    region.file_offset = file_offset;
+    region.length = length;
+    state->resident_bytes += length;
+    state->statistics.peak_resident_bytes = std::max(state->statistics.peak_resident_bytes, state->resident_bytes);
+    state->statistics.num_adopted++;
+    state->statistics.bytes_adopted += length;
+
+    // The mapping is released once the last handle on the polynomial (or any of its shifts) goes away
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    std::shared_ptr<Fr[]> memory(coefficients, [weak_state = std::weak_ptr<State>(state), address, length](Fr*) {
+        if (auto owner = weak_state.lock()) {
+            owner->free_region(address);
+        } else {
+            munmap(reinterpret_cast<void*>(address), length);
+        }
+    });
+    return Polynomial<Fr>(std::move(memory), size, polynomial.virtual_size());
+#endif
+}
+
+template <typename Fr> bool PolynomialScratchStore<Fr>::contains(const Polynomial<Fr>& polynomial) const
+{
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return !polynomial.is_empty() && state->find_region(polynomial.data()) != state->regions.end();
+}
+
+template <typename Fr> void PolynomialScratchStore<Fr>::apply_hint(const Polynomial<Fr>& polynomial, Hint hint)
+{
+#ifndef __wasm__
+    if (polynomial.is_empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(state->mutex);
+    auto it = state->find_region(polynomial.data());
+    if (it == state->regions.end()) {
+        return; // not ours, the polynomial is resident anyway
+    }
+    ScopedPagingTimer timer{ state->statistics.paging_seconds };
+    const uintptr_t address = it->first;
+    auto& region = it->second;
+    auto* ptr = reinterpret_cast<void*>(address);
+    switch (hint) {
+    case Hint::PREFETCH:
+    case Hint::STREAM:
+        if (!region.resident) {
+            state->statistics.num_prefetches++;
+            state->statistics.bytes_prefetched += region.length;
+        }
+        madvise(ptr, region.length, hint == Hint::STREAM ? MADV_SEQUENTIAL : MADV_NORMAL);
+        if (hint == Hint::PREFETCH) {
+            madvise(ptr, region.length, MADV_WILLNEED);
+        }
+        state->mark_resident(region);
+        break;
+    case Hint::RELEASE:
+        if (region.resident && !region.released) {
+            madvise(ptr, region.length, MADV_NORMAL);
+            region.release_position = state->eviction_queue.insert(state->eviction_queue.end(), address);
+            region.released = true;
+        }
+        break;
+    }
+    state->enforce_budget();
+#else
+    static_cast<void>(polynomial);
+    static_cast<void>(hint);
+#endif
+}
+
+template <typename Fr> size_t PolynomialScratchStore<Fr>::get_resident_bytes() const
+{
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->resident_bytes;
+}
+
+template <typename Fr> typename PolynomialScratchStore<Fr>::Statistics PolynomialScratchStore<Fr>::get_statistics() const
+{
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->statistics;
+}
+
+template <typename Fr> void PolynomialScratchStore<Fr>::print_statistics() const
+{
+    const auto stats = get_statistics();
+    constexpr double MiB = 1024.0 * 1024.0;
+    size_t peak_rss_bytes = 0;
+#ifndef __wasm__
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        // ru_maxrss is reported in KiB on Linux
+        peak_rss_bytes = static_cast<size_t>(usage.ru_maxrss) * 1024;
+    }
+#endif
+    info("polynomial scratch store: adopted ",
+         stats.num_adopted,
+         " polynomials (",
+         static_cast<double>(stats.bytes_adopted) / MiB,
+         " MiB), evicted ",
+         static_cast<double>(stats.bytes_evicted) / MiB,
+         " MiB in ",
+         stats.num_evictions,
+         " evictions, prefetched ",
+         static_cast<double>(stats.bytes_prefetched) / MiB,
+         " MiB in ",
+         stats.num_prefetches,
+         " prefetches, peak resident ",
+         static_cast<double>(stats.peak_resident_bytes) / MiB,
+         " MiB, paging time ",
+         stats.paging_seconds,
+         "s, process peak RSS ",
+         static_cast<double>(peak_rss_bytes) / MiB,
+         " MiB");
+}
+
+template class PolynomialScratchStore<bb::fr>;
+template class PolynomialScratchStore<grumpkin::fr>;
+
+} // namespace bb
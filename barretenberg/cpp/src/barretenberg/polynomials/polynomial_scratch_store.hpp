@@ -0,0 +1,150 @@
+#pragma once
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace bb {
+
+/**
+ * @brief Out-of-core backing store for prover polynomials.
+ * @details Polynomials adopted by the store are moved into their own region of an (unlinked) scratch file which is
+ * memory-mapped shared, so they remain ordinary Polynomials: every access is valid, a non-resident page is simply
+ * faulted back in from the file. On top of that the prover gives residency hints around each protocol stage:
+ *  - prefetch: the polynomials are about to be used (read ahead from the scratch file),
+ *  - stream: the polynomials are about to be read in a single sequential pass (aggressive read-ahead, pages behind
+ *    the pass may be dropped by the kernel),
+ *  - release: the polynomials are not needed until a later stage; they become candidates for eviction.
+ *
+ * The trade-off between peak memory and proving time is set by max_resident_bytes: whenever the polynomials the store
+ * considers resident exceed this budget, released polynomials are evicted (written back to the scratch file and
+ * dropped from memory) in least-recently-released order. A budget of zero evicts every polynomial as soon as it is
+ * released, the default (unbounded) budget never evicts and only costs the initial copy into the store.
+ *
+ * @note Memory mapping is not available in WASM; there adopt is a shallow copy and hints are no-ops.
+ */
+template <typename Fr> class PolynomialScratchStore {
+  public:
+    struct Options {
+        // Directory in which the (immediately unlinked) scratch file is created
+        std::string directory = "/tmp";
+        // Budget for the polynomials held in memory, beyond which released polynomials are evicted
+        size_t max_resident_bytes = std::numeric_limits<size_t>::max();
+    };
+
+    struct Statistics {
+        size_t num_adopted = 0;
+        size_t bytes_adopted = 0;
+        size_t num_evictions = 0;
+        size_t bytes_evicted = 0;
+        size_t num_prefetches = 0;
+        size_t bytes_prefetched = 0;
+        size_t peak_resident_bytes = 0;
+        double paging_seconds = 0; // time spent copying into the store and acting on residency hints
+    };
+
+    explicit PolynomialScratchStore(Options options = {});
+    PolynomialScratchStore(const PolynomialScratchStore&) = delete;
+    PolynomialScratchStore(PolynomialScratchStore&&) = delete;
+    PolynomialScratchStore& operator=(const PolynomialScratchStore&) = delete;
+    PolynomialScratchStore& operator=(PolynomialScratchStore&&) = delete;
+    ~PolynomialScratchStore();
+
+    /**
+     * @brief Copy a polynomial into the scratch file and return a polynomial backed by it.
+     * @details The returned polynomial has the same size, start index and virtual size. It does not share memory with
+     * the input, so the caller should replace every handle it holds (including shifts) for the memory to be freed.
+     */
+    Polynomial<Fr> adopt(const Polynomial<Fr>& polynomial);
+
+    /**
+     * @brief Adopt every unshifted polynomial of a prover polynomials container (skipping those already in the store)
+     * and recompute the shifts on top of the adopted memory.
+     */
+    template <typename ProverPolynomials> void adopt_all(ProverPolynomials& polynomials)
+    {
+        for (auto& polynomial : polynomials.get_unshifted()) {
+            if (!contains(polynomial)) {
+                polynomial = adopt(polynomial);
+            }
+        }
+        polynomials.set_shifted();
+    }
+
+    bool contains(const Polynomial<Fr>& polynomial) const;
+
+    void prefetch(const Polynomial<Fr>& polynomial) { apply_hint(polynomial, Hint::PREFETCH); }
+    void stream(const Polynomial<Fr>& polynomial) { apply_hint(polynomial, Hint::STREAM); }
+    void release(const Polynomial<Fr>& polynomial) { apply_hint(polynomial, Hint::RELEASE); }
+
+    // Hints for a whole range of polynomials, e.g. polynomials.get_wires()
+    template <typename Polynomials> void prefetch_all(Polynomials&& polynomials)
+    {
+        for (const auto& polynomial : polynomials) {
+            prefetch(polynomial);
+        }
+    }
+    template <typename Polynomials> void stream_all(Polynomials&& polynomials)
+    {
+        for (const auto& polynomial : polynomials) {
+            stream(polynomial);
+        }
+    }
+    template <typename Polynomials> void release_all(Polynomials&& polynomials)
+    {
+        for (const auto& polynomial : polynomials) {
+            release(polynomial);
+        }
+    }
+
+    size_t get_resident_bytes() const;
+    Statistics get_statistics() const;
+
+    /**
+     * @brief Log the paging statistics together with the peak RSS of the process
+     */
+    void print_statistics() const;
+
+  private:
+    enum class Hint { PREFETCH, STREAM, RELEASE };
+
+    struct Region {
+        size_t file_offset = 0;
+        size_t length = 0;
+        bool resident = true;
+        // Position in the eviction queue when the region has been released while resident
+        std::list<uintptr_t>::iterator release_position;
+        bool released = false;
+    };
+
+    // Adopted polynomials may outlive the store: their deleters only hold a weak reference to its state and unmap
+    // their memory themselves once the store is gone
+    struct State {
+        mutable std::mutex mutex;
+        int fd = -1;
+        size_t file_size = 0;
+        size_t max_resident_bytes = 0;
+        size_t resident_bytes = 0;
+        std::map<uintptr_t, Region> regions;                 // keyed by mapping address
+        std::multimap<size_t, size_t> free_regions;          // length -> file offset
+        std::list<uintptr_t> eviction_queue;                 // released resident regions, oldest first
+        Statistics statistics;
+
+        ~State();
+        std::map<uintptr_t, Region>::iterator find_region(const void* address);
+        void mark_resident(Region& region);
+        void evict(uintptr_t address, Region& region);
+        void enforce_budget();
+        void free_region(uintptr_t address);
+    };
+
+    void apply_hint(const Polynomial<Fr>& polynomial, Hint hint);
+
+    std::shared_ptr<State> state;
+};
+
+} // namespace bb
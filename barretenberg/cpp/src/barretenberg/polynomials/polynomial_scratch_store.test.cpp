@@ -0,0 +1,133 @@
+#include "polynomial_scratch_store.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+using Fr = bb::fr;
+using ScratchStore = PolynomialScratchStore<Fr>;
+
+// An adopted polynomial has the same coefficients, sizes and shift as the original
+TEST(PolynomialScratchStore, AdoptPreservesPolynomial)
+{
+    ScratchStore store;
+    const size_t size = 1 << 12;
+    auto poly = Polynomial<Fr>::random(size, 2 * size);
+    poly[0] = 0; // shiftable
+
+    auto adopted = store.adopt(poly);
+    EXPECT_TRUE(store.contains(adopted));
+    EXPECT_FALSE(store.contains(poly));
+    EXPECT_EQ(adopted.size(), poly.size());
+    EXPECT_EQ(adopted.virtual_size(), poly.virtual_size());
+    EXPECT_EQ(adopted, poly);
+    EXPECT_EQ(adopted.shifted(), poly.shifted());
+}
+
+// Evicted polynomials are transparently paged back in with their latest values
+TEST(PolynomialScratchStore, EvictionPreservesValues)
+{
+    ScratchStore store(ScratchStore::Options{ .max_resident_bytes = 0 });
+    const size_t size = 1 << 12;
+    auto poly = Polynomial<Fr>::random(size);
+    auto adopted = store.adopt(poly);
+
+    // Modify the adopted polynomial before it is paged out
+    adopted[7] = 7;
+    poly[7] = 7;
+    store.release(adopted);
+    EXPECT_EQ(store.get_resident_bytes(), 0);
+    EXPECT_EQ(store.get_statistics().num_evictions, 1);
+    EXPECT_EQ(adopted, poly);
+
+    store.prefetch(adopted);
+    EXPECT_GT(store.get_resident_bytes(), 0);
+    EXPECT_EQ(adopted, poly);
+}
+
+// Only released polynomials are evicted, oldest release first, and only as far as needed to meet the budget
+TEST(PolynomialScratchStore, BudgetEvictsLeastRecentlyReleased)
+{
+    const size_t size = 1 << 12;
+    std::vector<Polynomial<Fr>> polys;
+    for (size_t i = 0; i < 3; ++i) {
+        polys.emplace_back(Polynomial<Fr>::random(size));
+    }
+
+    // Measure the footprint of one polynomial in the store
+    ScratchStore store;
+    std::vector<Polynomial<Fr>> adopted;
+    for (auto& poly : polys) {
+        adopted.emplace_back(store.adopt(poly));
+    }
+    const size_t bytes_per_polynomial = store.get_resident_bytes() / 3;
+
+    ScratchStore budgeted(ScratchStore::Options{ .max_resident_bytes = 2 * bytes_per_polynomial });
+    std::vector<Polynomial<Fr>> budgeted_polys;
+    for (auto& poly : polys) {
+        budgeted_polys.emplace_back(budgeted.adopt(poly));
+    }
+    // Nothing released yet: the budget cannot be met
+    EXPECT_EQ(budgeted.get_resident_bytes(), 3 * bytes_per_polynomial);
+
+    budgeted.release(budgeted_polys[1]);
+    budgeted.release(budgeted_polys[0]);
+    // Evicting the first released polynomial suffices
+    EXPECT_EQ(budgeted.get_resident_bytes(), 2 * bytes_per_polynomial);
+    EXPECT_EQ(budgeted.get_statistics().num_evictions, 1);
+
+    // Paging the evicted polynomial back in pushes out the remaining released one
+    budgeted.prefetch(budgeted_polys[1]);
+    EXPECT_EQ(budgeted.get_statistics().num_evictions, 2);
+    EXPECT_EQ(budgeted.get_statistics().num_prefetches, 1);
+    EXPECT_EQ(budgeted.get_resident_bytes(), 2 * bytes_per_polynomial);
+
+    // Polynomials in use are never evicted, even when over budget
+    budgeted.prefetch(budgeted_polys[0]);
+    EXPECT_EQ(budgeted.get_statistics().num_evictions, 2);
+    EXPECT_EQ(budgeted.get_statistics().num_prefetches, 2);
+    EXPECT_EQ(budgeted.get_resident_bytes(), 3 * bytes_per_polynomial);
+
+    for (size_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(budgeted_polys[i], polys[i]);
+    }
+}
+
+// Regions are returned to the store when the last handle (including shifts) is dropped, and reused
+TEST(PolynomialScratchStore, RegionsAreRecycled)
+{
+    ScratchStore store;
+    const size_t size = 1 << 10;
+    auto poly = Polynomial<Fr>::random(size);
+    poly[0] = 0;
+    {
+        auto adopted = store.adopt(poly);
+        auto shifted = adopted.shifted();
+        const size_t resident = store.get_resident_bytes();
+        adopted = Polynomial<Fr>{};
+        // The shift keeps the region alive
+        EXPECT_EQ(store.get_resident_bytes(), resident);
+    }
+    EXPECT_EQ(store.get_resident_bytes(), 0);
+
+    // A new polynomial reusing the freed region sees its own coefficients and a zero shift padding
+    auto other = Polynomial<Fr>::random(size);
+    other[0] = 0;
+    auto adopted = store.adopt(other);
+    EXPECT_EQ(adopted, other);
+    EXPECT_EQ(adopted.shifted(), other.shifted());
+}
+
+// Adopted polynomials remain valid after the store itself is destroyed
+TEST(PolynomialScratchStore, PolynomialsOutliveStore)
+{
+    const size_t size = 1 << 10;
+    auto poly = Polynomial<Fr>::random(size);
+    Polynomial<Fr> adopted;
+    {
+        ScratchStore store;
+        adopted = store.adopt(poly);
+    }
+    EXPECT_EQ(adopted, poly);
+}
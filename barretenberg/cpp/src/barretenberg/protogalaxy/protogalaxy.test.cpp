@@ -433,6 +433,29 @@ template <typename Flavor> class ProtoGalaxyTests : public testing::Test {
         decide_and_verify(prover_accumulator_2, verifier_accumulator_2, true);
     }
 
+    /**
+     * @brief Check that the rows a fold flags as active in the next accumulator cover every row on which the full Honk
+     * relation of that accumulator does not vanish, so that the perturbator can be restricted to them.
+     *
+     */
+    static void test_accumulator_active_rows()
+    {
+        TupleOfInstances instances = construct_instances(2, TraceStructure::SMALL_TEST);
+        auto [prover_accumulator, verifier_accumulator] = fold_and_verify(get<0>(instances), get<1>(instances));
+
+        const auto& active_rows = prover_accumulator->active_rows;
+        ASSERT_EQ(active_rows.size(), prover_accumulator->proving_key.circuit_size);
+        // The structured trace is mostly padding
+        EXPECT_TRUE(std::find(active_rows.begin(), active_rows.end(), 0) != active_rows.end());
+
+        const auto& polynomials = prover_accumulator->proving_key.polynomials;
+        auto full_honk_evals = Fun::compute_full_honk_evaluations(
+            polynomials, prover_accumulator->alphas, prover_accumulator->relation_parameters);
+        auto active_full_honk_evals = Fun::compute_full_honk_evaluations(
+            polynomials, prover_accumulator->alphas, prover_accumulator->relation_parameters, active_rows);
+        EXPECT_EQ(full_honk_evals, active_full_honk_evals);
+    }
+
     /**
      * @brief Testing two valid rounds of folding followed by the decider for a structured trace.
      *
@@ -609,6 +632,11 @@ TYPED_TEST(ProtoGalaxyTests, FullProtogalaxyStructuredTrace)
 {
     TestFixture::test_full_protogalaxy_structured_trace();
 }
+TYPED_TEST(ProtoGalaxyTests, AccumulatorActiveRows)
+{
+    TestFixture::test_accumulator_active_rows();
+}
+
 TYPED_TEST(ProtoGalaxyTests, FullProtogalaxyStructuredTraceInhomogeneous)
 {
     TestFixture::test_full_protogalaxy_structured_trace_inhomogeneous_circuits();
@@ -33,6 +33,7 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
         OptimisedRelationParameters optimised_relation_parameters;
         OptimisedTupleOfTuplesOfUnivariates optimised_univariate_accumulators;
         TupleOfTuplesOfUnivariates univariate_accumulators;
+        std::vector<uint8_t> active_rows; // rows on which a relation is active in some instance, see compute_combiner
         FoldingResult<typename ProverInstances_::Flavor> result;
     };
 
@@ -65,6 +65,7 @@ std::shared_ptr<typename ProverInstances::Instance> ProtoGalaxyProver_<ProverIns
 
     next_accumulator->target_sum = next_target_sum;
     next_accumulator->gate_challenges = state.gate_challenges;
+    next_accumulator->active_rows = std::move(state.active_rows);
 
     // Initialize accumulator proving key polynomials
     auto accumulator_polys = next_accumulator->proving_key.polynomials.get_all();
@@ -142,7 +143,8 @@ template <class ProverInstances> void ProtoGalaxyProver_<ProverInstances>::combi
                                           pow_polynomial,
                                           state.optimised_relation_parameters,
                                           state.alphas,
-                                          state.optimised_univariate_accumulators);
+                                          state.optimised_univariate_accumulators,
+                                          &state.active_rows);
 
     state.compressed_perturbator = state.perturbator.evaluate(perturbator_challenge);
     state.combiner_quotient = Fun::compute_combiner_quotient(state.compressed_perturbator, combiner);
@@ -37,6 +37,8 @@ template <class ProverInstances_> class ProtogalaxyProverInternal {
         Univariate<FF,
                    (Flavor::MAX_TOTAL_RELATION_LENGTH - 1 + ProverInstances::NUM - 1) * (ProverInstances::NUM - 1) + 1>;
     using ExtendedUnivariates = typename Flavor::template ProverUnivariates<ExtendedUnivariate::LENGTH>;
+    // The values of all prover polynomials at a given row, one per instance, before extension
+    using RowUnivariates = typename Flavor::template ProverUnivariates<ProverInstances::NUM>;
     using OptimisedExtendedUnivariates =
         typename Flavor::template OptimisedProverUnivariates<ExtendedUnivariate::LENGTH,
                                                              /* SKIP_COUNT= */ ProverInstances::NUM - 1>;
@@ -60,19 +62,28 @@ template <class ProverInstances_> class ProtogalaxyProverInternal {
      * row. At the end of the function, the linearly dependent contribution is accumulated at index 0 representing the
      * sum f_0(ω) + α_j*g(ω) where f_0 represents the full honk evaluation at row 0, g(ω) is the linearly dependent
      * subrelation and α_j is its corresponding batching challenge.
+     *
+     * @param active_rows If non-empty, flags (with a nonzero byte) the rows on which a relation may be active; all
+     * relations are skippable on the other rows, so their evaluation is zero and is not computed.
      */
     static std::vector<FF> compute_full_honk_evaluations(const ProverPolynomials& instance_polynomials,
                                                          const RelationSeparator& alpha,
-                                                         const RelationParameters<FF>& relation_parameters)
+                                                         const RelationParameters<FF>& relation_parameters,
+                                                         const std::vector<uint8_t>& active_rows = {})
 
     {
         BB_OP_COUNT_TIME_NAME("ProtoGalaxyProver_::compute_full_honk_evaluations");
         auto instance_size = instance_polynomials.get_polynomial_size();
+        ASSERT(active_rows.empty() || active_rows.size() == instance_size);
         std::vector<FF> full_honk_evaluations(instance_size);
         std::vector<FF> linearly_dependent_contribution_accumulators = parallel_for_heuristic(
             instance_size,
             /*accumulator default*/ FF(0),
             [&](size_t row, FF& linearly_dependent_contribution_accumulator) {
+                if (!active_rows.empty() && active_rows[row] == 0) {
+                    full_honk_evaluations[row] = FF(0);
+                    return;
+                }
                 auto row_evaluations = instance_polynomials.get_row(row);
                 RelationEvaluations relation_evaluations;
                 RelationUtils::zero_elements(relation_evaluations);
@@ -95,37 +106,6 @@ template <class ProverInstances_> class ProtogalaxyProverInternal {
         return full_honk_evaluations;
     }
 
-    /**
-     * @brief  Recursively compute the parent nodes of each level in the tree, starting from the leaves. Note that at
-     * each level, the resulting parent nodes will be polynomials of degree (level+1) because we multiply by an
-     * additional factor of X.
-     */
-    static std::vector<FF> construct_coefficients_tree(const std::vector<FF>& betas,
-                                                       const std::vector<FF>& deltas,
-                                                       const std::vector<std::vector<FF>>& prev_level_coeffs,
-                                                       size_t level = 1)
-    {
-        if (level == betas.size()) {
-            return prev_level_coeffs[0];
-        }
-
-        auto degree = level + 1;
-        auto prev_level_width = prev_level_coeffs.size();
-        std::vector<std::vector<FF>> level_coeffs(prev_level_width / 2, std::vector<FF>(degree + 1, 0));
-        parallel_for_heuristic(
-            prev_level_width / 2,
-            [&](size_t parent) {
-                size_t node = parent * 2;
-                std::copy(prev_level_coeffs[node].begin(), prev_level_coeffs[node].end(), level_coeffs[parent].begin());
-                for (size_t d = 0; d < degree; d++) {
-                    level_coeffs[parent][d] += prev_level_coeffs[node + 1][d] * betas[level];
-                    level_coeffs[parent][d + 1] += prev_level_coeffs[node + 1][d] * deltas[level];
-                }
-            },
-            /* overestimate */ thread_heuristics::FF_MULTIPLICATION_COST * degree * 3);
-        return construct_coefficients_tree(betas, deltas, level_coeffs, level + 1);
-    }
-
     /**
      * @brief We construct the coefficients of the perturbator polynomial in O(n) time following the technique in
      * Claim 4.4. Consider a binary tree whose leaves are the evaluations of the full Honk relation at each row in the
@@ -133,63 +113,140 @@ template <class ProverInstances_> class ProtogalaxyProverInternal {
      * the tree, label the branch connecting the left node n_l to its parent by 1 and for the right node n_r by β_i +
      * δ_i X. The value of the parent node n will be constructed as n = n_l + n_r * (β_i + δ_i X). Recurse over each
      * layer until the root is reached which will correspond to the perturbator polynomial F(X).
-     * TODO(https://github.com/AztecProtocol/barretenberg/issues/745): make computation of perturbator more memory
-     * efficient, operate in-place and use std::resize; add multithreading
+     *
+     * @details The nodes at level i are polynomials of degree i + 1 (the leaves being level -1), whose coefficients are
+     * stored contiguously. A level never takes more space than the leaves, so all levels live in a single buffer of
+     * twice that size whose halves alternate as the source and the destination of the next level.
      */
     static std::vector<FF> construct_perturbator_coefficients(const std::vector<FF>& betas,
                                                               const std::vector<FF>& deltas,
                                                               const std::vector<FF>& full_honk_evaluations)
     {
-        auto width = full_honk_evaluations.size();
-        std::vector<std::vector<FF>> first_level_coeffs(width / 2, std::vector<FF>(2, 0));
+        const size_t width = full_honk_evaluations.size();
+        const size_t num_levels = betas.size();
+        ASSERT(width == (1UL << num_levels));
+
+        std::vector<FF> coeffs_buffer(2 * width);
+        FF* level_coeffs = &coeffs_buffer[0];
+        FF* next_level_coeffs = &coeffs_buffer[width];
+
         parallel_for_heuristic(
             width / 2,
             [&](size_t parent) {
                 size_t node = parent * 2;
-                first_level_coeffs[parent][0] =
-                    full_honk_evaluations[node] + full_honk_evaluations[node + 1] * betas[0];
-                first_level_coeffs[parent][1] = full_honk_evaluations[node + 1] * deltas[0];
+                level_coeffs[node] = full_honk_evaluations[node] + full_honk_evaluations[node + 1] * betas[0];
+                level_coeffs[node + 1] = full_honk_evaluations[node + 1] * deltas[0];
             },
             /* overestimate */ thread_heuristics::FF_MULTIPLICATION_COST * 3);
-        return construct_coefficients_tree(betas, deltas, first_level_coeffs);
+
+        for (size_t level = 1; level < num_levels; level++) {
+            // Children have degree `level`, parents have degree `level + 1`
+            const size_t num_child_coeffs = level + 1;
+            const size_t num_parent_coeffs = level + 2;
+            parallel_for_heuristic(
+                width >> (level + 1),
+                [&](size_t parent) {
+                    const FF* left = &level_coeffs[2 * parent * num_child_coeffs];
+                    const FF* right = left + num_child_coeffs;
+                    FF* result = &next_level_coeffs[parent * num_parent_coeffs];
+                    std::copy(left, left + num_child_coeffs, result);
+                    result[num_child_coeffs] = FF(0);
+                    for (size_t d = 0; d < num_child_coeffs; d++) {
+                        result[d] += right[d] * betas[level];
+                        result[d + 1] += right[d] * deltas[level];
+                    }
+                },
+                /* overestimate */ thread_heuristics::FF_MULTIPLICATION_COST * num_parent_coeffs * 3);
+            std::swap(level_coeffs, next_level_coeffs);
+        }
+        return std::vector<FF>(level_coeffs, level_coeffs + num_levels + 1);
     }
 
     /**
      * @brief Construct the power perturbator polynomial F(X) in coefficient form from the accumulator, representing the
      * relaxed instance.
-     *
-     *
+     * @details The relations are only evaluated on the rows the accumulator flags as active, if it does (see
+     * compute_combiner).
      */
     static LegacyPolynomial<FF> compute_perturbator(std::shared_ptr<Instance> accumulator,
                                                     const std::vector<FF>& deltas)
     {
         BB_OP_COUNT_TIME();
-        auto full_honk_evaluations = compute_full_honk_evaluations(
-            accumulator->proving_key.polynomials, accumulator->alphas, accumulator->relation_parameters);
+        auto full_honk_evaluations = compute_full_honk_evaluations(accumulator->proving_key.polynomials,
+                                                                   accumulator->alphas,
+                                                                   accumulator->relation_parameters,
+                                                                   accumulator->active_rows);
         const auto betas = accumulator->gate_challenges;
         assert(betas.size() == deltas.size());
         auto coeffs = construct_perturbator_coefficients(betas, deltas, full_honk_evaluations);
         return LegacyPolynomial<FF>(coeffs);
     }
 
+    /**
+     * @brief For a fixed row index, collect the value of each prover polynomial in each instance into a univariate.
+     */
+    static void get_row_univariates(RowUnivariates& row_univariates,
+                                    const ProverInstances& instances,
+                                    const size_t row_idx)
+    {
+        size_t instance_idx = 0;
+        for (auto& instance : instances) {
+            for (auto [row_univariate, poly] :
+                 zip_view(row_univariates.get_all(), instance->proving_key.polynomials.get_all())) {
+                row_univariate.evaluations[instance_idx] = poly[row_idx];
+            }
+            instance_idx++;
+        }
+    }
+
+    /**
+     * @brief Whether every relation can be skipped at a row, in which case the row contributes nothing to the
+     * combiner and need not be extended at all.
+     * @details Skipping is decided on the values of the instances themselves: a univariate vanishes on the extended
+     * domain if and only if it vanishes at every instance.
+     */
+    template <size_t relation_idx = 0> static bool row_can_be_skipped(const RowUnivariates& row_univariates)
+    {
+        using Relation = std::tuple_element_t<relation_idx, Relations>;
+        if constexpr (!isSkippable<Relation, RowUnivariates>) {
+            return false;
+        } else {
+            if (!Relation::skip(row_univariates)) {
+                return false;
+            }
+            if constexpr (relation_idx + 1 < Flavor::NUM_RELATIONS) {
+                return row_can_be_skipped<relation_idx + 1>(row_univariates);
+            } else {
+                return true;
+            }
+        }
+    }
+
     /**
      * @brief Prepare a univariate polynomial for relation execution in one step of the main loop in folded instance
      * construction.
-     * @details For a fixed prover polynomial index, extract that polynomial from each instance in Instances. From
-     *each polynomial, extract the value at row_idx. Use these values to create a univariate polynomial, and then
-     *extend (i.e., compute additional evaluations at adjacent domain values) as needed.
+     * @details Extend each univariate of a row (see get_row_univariates) to the full extended domain. Values that
+     * agree across all instances, e.g. the selectors of instances sharing a trace structure or zero padding, extend
+     * to a constant, which is much cheaper than the general (degree NUM - 1) extension.
      * @todo TODO(https://github.com/AztecProtocol/barretenberg/issues/751) Optimize memory
      */
-
     template <size_t skip_count = 0>
     static void extend_univariates(
         std::conditional_t<skip_count != 0, OptimisedExtendedUnivariates, ExtendedUnivariates>& extended_univariates,
-        const ProverInstances& instances,
-        const size_t row_idx)
+        const RowUnivariates& row_univariates)
     {
-        auto base_univariates = instances.template row_to_univariates<skip_count>(row_idx);
-        for (auto [extended_univariate, base_univariate] : zip_view(extended_univariates.get_all(), base_univariates)) {
-            extended_univariate = base_univariate.template extend_to<ExtendedUnivariate::LENGTH, skip_count>();
+        for (auto [extended_univariate, base_univariate] :
+             zip_view(extended_univariates.get_all(), row_univariates.get_all())) {
+            const FF& first_value = base_univariate.evaluations[0];
+            bool is_constant = true;
+            for (size_t instance_idx = 1; instance_idx < ProverInstances::NUM; instance_idx++) {
+                is_constant = is_constant && base_univariate.evaluations[instance_idx] == first_value;
+            }
+            if (is_constant) {
+                std::fill(extended_univariate.evaluations.begin(), extended_univariate.evaluations.end(), first_value);
+            } else {
+                extended_univariate = base_univariate.template extend_to<ExtendedUnivariate::LENGTH, skip_count>();
+            }
         }
     }
 
@@ -253,6 +310,10 @@ template <class ProverInstances_> class ProtogalaxyProverInternal {
      * @tparam skip_zero_computations whether to use the the optimization that skips computing zero.
      * @param instances
      * @param pow_betas
+     * @param active_rows If provided, set to flag (with a nonzero byte) the rows on which some relation is active in
+     * some instance. The skip predicates of all relations only require linear combinations of the polynomials to
+     * vanish, so any relation skippable on a row in every instance is skippable there in the folded instance too. The
+     * flags thus remain valid for the next accumulator, whose perturbator then only needs the flagged rows.
      * @return ExtendedUnivariateWithRandomization
      */
     template <typename Parameters, typename TupleOfTuples>
@@ -260,7 +321,8 @@ template <class ProverInstances_> class ProtogalaxyProverInternal {
                                                                 const PowPolynomial<FF>& pow_betas,
                                                                 const Parameters& relation_parameters,
                                                                 const CombinedRelationSeparator& alphas,
-                                                                TupleOfTuples& univariate_accumulators)
+                                                                TupleOfTuples& univariate_accumulators,
+                                                                std::vector<uint8_t>* active_rows = nullptr)
     {
         BB_OP_COUNT_TIME();
 
@@ -280,6 +342,10 @@ template <class ProverInstances_> class ProtogalaxyProverInternal {
         num_threads = num_threads > 0 ? num_threads : 1;                     // ensure num threads is >= 1
         size_t iterations_per_thread = common_instance_size / num_threads;   // actual iterations per thread
 
+        if (active_rows != nullptr) {
+            active_rows->resize(common_instance_size);
+        }
+
         // Univariates are optimised for usual PG, but we need the unoptimised version for tests (it's a version that
         // doesn't skip computation), so we need to define types depending on the template instantiation
         using ThreadAccumulators = TupleOfTuples;
@@ -293,7 +359,8 @@ template <class ProverInstances_> class ProtogalaxyProverInternal {
             RelationUtils::zero_univariates(accum);
         }
 
-        // Construct extended univariates containers; one per thread
+        // Construct row and extended univariates containers; one per thread
+        std::vector<RowUnivariates> row_univariates(num_threads);
         std::vector<ExtendedUnivatiatesType> extended_univariates;
         extended_univariates.resize(num_threads);
 
@@ -303,11 +370,21 @@ template <class ProverInstances_> class ProtogalaxyProverInternal {
             size_t end = (thread_idx + 1) * iterations_per_thread;
 
             for (size_t idx = start; idx < end; idx++) {
+                // Rows on which no relation is active in any instance (e.g. padding in structured traces) contribute
+                // nothing, so we skip them before paying for the extension
+                get_row_univariates(row_univariates[thread_idx], instances, idx);
+                const bool skip_row = row_can_be_skipped(row_univariates[thread_idx]);
+                if (active_rows != nullptr) {
+                    (*active_rows)[idx] = skip_row ? 0 : 1;
+                }
+                if (skip_row) {
+                    continue;
+                }
                 // Instantiate univariates, possibly with skipping toto ignore computation in those indices (they are
                 // still available for skipping relations, but all derived univariate will ignore those evaluations)
                 // No need to initialise extended_univariates to 0, as it's assigned to.
                 constexpr size_t skip_count = skip_zero_computations ? ProverInstances::NUM - 1 : 0;
-                extend_univariates<skip_count>(extended_univariates[thread_idx], instances, idx);
+                extend_univariates<skip_count>(extended_univariates[thread_idx], row_univariates[thread_idx]);
 
                 FF pow_challenge = pow_betas[idx];
 
@@ -3,6 +3,7 @@
 #include <tuple>
 
 #include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/honk/proof_system/logderivative_library.hpp"
 #include "barretenberg/polynomials/univariate.hpp"
 #include "barretenberg/relations/relation_types.hpp"
 
@@ -231,33 +232,39 @@ template <typename FF_> class DatabusLookupRelationImpl {
                                               const size_t circuit_size)
     {
         auto& inverse_polynomial = BusData<bus_idx, Polynomials>::inverses(polynomials);
-        bool is_read = false;
-        bool nonzero_read_count = false;
-        for (size_t i = 0; i < circuit_size; ++i) {
-            // Determine if the present row contains a databus operation
-            auto& q_busread = polynomials.q_busread[i];
-            if constexpr (bus_idx == 0) { // calldata
-                is_read = q_busread == 1 && polynomials.q_l[i] == 1;
-                nonzero_read_count = polynomials.calldata_read_counts[i] > 0;
-            }
-            if constexpr (bus_idx == 1) { // secondary_calldata
-                is_read = q_busread == 1 && polynomials.q_r[i] == 1;
-                nonzero_read_count = polynomials.secondary_calldata_read_counts[i] > 0;
-            }
-            if constexpr (bus_idx == 2) { // return data
-                is_read = q_busread == 1 && polynomials.q_o[i] == 1;
-                nonzero_read_count = polynomials.return_data_read_counts[i] > 0;
-            }
-            // We only compute the inverse if this row contains a read gate or data that has been read
-            if (is_read || nonzero_read_count) {
-                // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
-                auto row = polynomials.get_row(i); // Note: this is a copy. use sparingly!
-                inverse_polynomial[i] = compute_read_term<FF>(row, relation_parameters) *
-                                        compute_write_term<FF, bus_idx>(row, relation_parameters);
-            }
-        }
-        // Compute inverse polynomial I in place by inverting the product at each row
-        FF::batch_invert(inverse_polynomial);
+        // Compute the product of the terms at each row and invert the products chunk by chunk
+        compute_logderivative_inverse_in_chunks<FF>(
+            inverse_polynomial,
+            circuit_size,
+            [&](size_t start, size_t end, std::vector<size_t>& rows, std::vector<FF>& denominators) {
+                bool is_read = false;
+                bool nonzero_read_count = false;
+                for (size_t i = start; i < end; ++i) {
+                    // Determine if the present row contains a databus operation
+                    auto& q_busread = polynomials.q_busread[i];
+                    if constexpr (bus_idx == 0) { // calldata
+                        is_read = q_busread == 1 && polynomials.q_l[i] == 1;
+                        nonzero_read_count = polynomials.calldata_read_counts[i] > 0;
+                    }
+                    if constexpr (bus_idx == 1) { // secondary_calldata
+                        is_read = q_busread == 1 && polynomials.q_r[i] == 1;
+                        nonzero_read_count = polynomials.secondary_calldata_read_counts[i] > 0;
+                    }
+                    if constexpr (bus_idx == 2) { // return data
+                        is_read = q_busread == 1 && polynomials.q_o[i] == 1;
+                        nonzero_read_count = polynomials.return_data_read_counts[i] > 0;
+                    }
+                    // We only compute the inverse if this row contains a read gate or data that has been read
+                    if (is_read || nonzero_read_count) {
+                        // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
+                        auto row = polynomials.get_row(i); // Note: this is a copy. use sparingly!
+                        rows.emplace_back(i);
+                        denominators.emplace_back(compute_read_term<FF>(row, relation_parameters) *
+                                                  compute_write_term<FF, bus_idx>(row, relation_parameters));
+                    }
+                }
+            },
+            thread_heuristics::FF_COPY_COST * 3);
     };
 
     /**
@@ -15,6 +15,7 @@
  * (The value is applied to the write predicate, so it is confusing).
  */
 #pragma once
+#include <algorithm>
 #include <array>
 #include <tuple>
 
@@ -217,6 +218,22 @@ template <typename Settings, typename FF_> class GenericLookupRelationImpl {
         return Settings::inverse_polynomial_is_computed_at_row(row);
     }
 
+    /**
+     * @brief Get all the entities used by this relation (see HasLogDerivativeEntities)
+     * @details Arbitrary read or write terms are defined by the settings, which may use other entities, so in that case
+     * the entities are not exposed
+     */
+    template <typename AllEntities>
+    static auto get_entities(AllEntities& in)
+        requires(!std::ranges::any_of(Settings::READ_TERM_TYPES, [](size_t type) { return type == READ_ARBITRARY; }) &&
+                 !std::ranges::any_of(Settings::WRITE_TERM_TYPES, [](size_t type) { return type == WRITE_ARBITRARY; }))
+    {
+        return Settings::get_nonconst_entities(in);
+    }
+    // The read and write term predicates decide whether the inverse is computed at a row
+    static constexpr size_t SELECTOR_ENTITIES_BEGIN = LOOKUP_READ_TERM_PREDICATE_START_POLYNOMIAL_INDEX;
+    static constexpr size_t SELECTOR_ENTITIES_END = LOOKUP_READ_PREDICATE_START_POLYNOMIAL_INDEX;
+
     /**
      * @brief Get the inverse permutation polynomial (needed to compute its value)
      *
@@ -67,6 +67,17 @@ template <typename Settings, typename FF_> class GenericPermutationRelationImpl
         return Settings::inverse_polynomial_is_computed_at_row(row);
     }
 
+    /**
+     * @brief Get all the entities used by this relation (see HasLogDerivativeEntities)
+     */
+    template <typename AllEntities> static auto get_entities(AllEntities& in)
+    {
+        return Settings::get_nonconst_entities(in);
+    }
+    // The permutation enabling polynomials decide whether the inverse is computed at a row
+    static constexpr size_t SELECTOR_ENTITIES_BEGIN = ENABLE_INVERSE_CORRECTNESS_CHECK_POLYNOMIAL_INDEX;
+    static constexpr size_t SELECTOR_ENTITIES_END = PERMUTATION_SETS_START_POLYNOMIAL_INDEX;
+
     /**
      * @brief Get the inverse permutation polynomial (needed to compute its value)
      *
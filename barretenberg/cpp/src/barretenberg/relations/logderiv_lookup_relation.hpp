@@ -157,17 +157,23 @@ template <typename FF_> class LogDerivLookupRelationImpl {
     {
         auto& inverse_polynomial = get_inverse_polynomial(polynomials);
 
-        for (size_t i = 0; i < circuit_size; ++i) {
-            // We only compute the inverse if this row contains a lookup gate or data that has been looked up
-            if (polynomials.q_lookup[i] == 1 || polynomials.lookup_read_tags[i] == 1) {
-                // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
-                auto row = polynomials.get_row(i); // Note: this is a copy. use sparingly!
-                inverse_polynomial[i] = compute_read_term<FF, 0>(row, relation_parameters) *
-                                        compute_write_term<FF, 0>(row, relation_parameters);
-            }
-        }
-        // Compute inverse polynomial I in place by inverting the product at each row
-        FF::batch_invert(inverse_polynomial);
+        // Compute the product of the terms at each row and invert the products chunk by chunk
+        compute_logderivative_inverse_in_chunks<FF>(
+            inverse_polynomial,
+            circuit_size,
+            [&](size_t start, size_t end, std::vector<size_t>& rows, std::vector<FF>& denominators) {
+                for (size_t i = start; i < end; ++i) {
+                    // We only compute the inverse if this row contains a lookup gate or data that has been looked up
+                    if (polynomials.q_lookup[i] == 1 || polynomials.lookup_read_tags[i] == 1) {
+                        // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
+                        auto row = polynomials.get_row(i); // Note: this is a copy. use sparingly!
+                        rows.emplace_back(i);
+                        denominators.emplace_back(compute_read_term<FF, 0>(row, relation_parameters) *
+                                                  compute_write_term<FF, 0>(row, relation_parameters));
+                    }
+                }
+            },
+            thread_heuristics::FF_COPY_COST * 2);
     };
 
     /**
@@ -37,7 +37,7 @@ template <typename FF_> class CircuitBuilderBase {
     std::map<uint32_t, uint32_t> tau;
 
     // Public input indices which contain recursive proof information
-    AggregationObjectPubInputIndices recursive_proof_public_input_indices;
+    AggregationObjectPubInputIndices recursive_proof_public_input_indices = {};
     bool contains_recursive_proof = false;
 
     // We only know from the circuit description whether a circuit should use a prover which produces
@@ -131,6 +131,15 @@ template <typename FF_> class CircuitBuilderBase {
      */
     virtual uint32_t add_variable(const FF& in);
 
+    /**
+     * Add several zero-valued variables at once, whose values are then assigned through `variables`. Distinct
+     * variables can be assigned concurrently.
+     *
+     * @param num_variables The number of variables to add
+     * @return The index of the first new variable, the others follow consecutively
+     */
+    uint32_t add_variables(size_t num_variables);
+
     /**
      * Assign a name to a variable(equivalence class). Should be one name per equivalence class.
      *
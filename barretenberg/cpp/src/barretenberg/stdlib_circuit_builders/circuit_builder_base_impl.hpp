@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/serialize/cbind.hpp"
 #include "circuit_builder_base.hpp"
+#include <numeric>
 
 namespace bb {
 template <typename FF_> CircuitBuilderBase<FF_>::CircuitBuilderBase(size_t size_hint)
@@ -86,6 +87,19 @@ template <typename FF_> uint32_t CircuitBuilderBase<FF_>::add_variable(const FF&
     return index;
 }
 
+template <typename FF_> uint32_t CircuitBuilderBase<FF_>::add_variables(const size_t num_variables)
+{
+    const auto first_index = static_cast<uint32_t>(variables.size());
+    const size_t new_size = variables.size() + num_variables;
+    variables.resize(new_size, FF::zero());
+    real_variable_index.resize(new_size);
+    std::iota(real_variable_index.begin() + first_index, real_variable_index.end(), first_index);
+    next_var_index.resize(new_size, REAL_VARIABLE);
+    prev_var_index.resize(new_size, FIRST_VARIABLE_IN_CLASS);
+    real_variable_tags.resize(new_size, DUMMY_TAG);
+    return first_index;
+}
+
 template <typename FF_> void CircuitBuilderBase<FF_>::set_variable_name(uint32_t index, const std::string& name)
 {
     ASSERT(variables.size() > index);
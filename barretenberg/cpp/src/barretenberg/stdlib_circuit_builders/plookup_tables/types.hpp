@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <limits>
 #include <vector>
 
 #include "./fixed_base/fixed_base_params.hpp"
@@ -328,6 +330,95 @@ struct LookupHashTable {
     bool operator==(const LookupHashTable& other) const = default;
 };
 
+/**
+ * @brief A dense map from the key of a lookup to the index in a BasicTable of the entry it reads
+ * @details Most tables are built by enumerating all the keys in a small range, e.g. all pairs of 6-bit operands for
+ * the uint32 XOR table. The index of an entry can then be read from a vector indexed by the key, at position
+ * key_1 * key_2_range + key_2, which avoids hashing three field elements per lookup as LookupHashTable does. Tables
+ * whose keys are spread over a much larger range than the table (e.g. keys in sparse form) or are not unique have no
+ * such index. Only the key of a lookup is used to find its entry; the values are not checked against the table.
+ */
+struct LookupKeyIndex {
+    // Largest ratio between the size of the range of the keys and the size of the table for which the index is built
+    static constexpr size_t MAX_KEY_RANGE_RATIO = 4;
+    static constexpr uint32_t NO_ENTRY = std::numeric_limits<uint32_t>::max();
+
+    std::vector<uint32_t> indices; // the index of the entry for each key, or NO_ENTRY
+    uint64_t key_1_range = 0;
+    uint64_t key_2_range = 0;
+    bool use_twin_keys = false;
+
+    bool is_initialized() const { return !indices.empty(); }
+
+    /**
+     * @brief Initialize the index with the key columns of a table
+     *
+     * @return Whether the keys of the table admit a dense index
+     */
+    bool initialize(const std::vector<bb::fr>& column_1, const std::vector<bb::fr>& column_2, bool twin_keys)
+    {
+        indices.clear();
+        use_twin_keys = twin_keys;
+        const size_t table_size = column_1.size();
+        const uint64_t max_range = MAX_KEY_RANGE_RATIO * table_size;
+        if (table_size == 0 || table_size >= NO_ENTRY) {
+            return false;
+        }
+
+        std::vector<uint64_t> keys_1(table_size);
+        std::vector<uint64_t> keys_2(table_size, 0);
+        key_1_range = 1;
+        key_2_range = 1;
+        for (size_t i = 0; i < table_size; ++i) {
+            const uint256_t key_1(column_1[i]);
+            if (key_1 >= max_range) {
+                return false;
+            }
+            keys_1[i] = key_1.data[0];
+            key_1_range = std::max(key_1_range, keys_1[i] + 1);
+            if (use_twin_keys) {
+                const uint256_t key_2(column_2[i]);
+                if (key_2 >= max_range) {
+                    return false;
+                }
+                keys_2[i] = key_2.data[0];
+                key_2_range = std::max(key_2_range, keys_2[i] + 1);
+            }
+        }
+        if (key_1_range > max_range / key_2_range) {
+            return false;
+        }
+
+        indices.assign(key_1_range * key_2_range, NO_ENTRY);
+        for (size_t i = 0; i < table_size; ++i) {
+            auto& index = indices[keys_1[i] * key_2_range + keys_2[i]];
+            if (index != NO_ENTRY) {
+                indices.clear();
+                return false;
+            }
+            index = static_cast<uint32_t>(i);
+        }
+        return true;
+    }
+
+    // Given the key of a lookup, return the index of the entry it reads in the table
+    size_t operator[](const std::array<uint256_t, 2>& key) const
+    {
+        const uint256_t key_2 = use_twin_keys ? key[1] : uint256_t(0);
+        if (key[0] < key_1_range && key_2 < key_2_range) {
+            const uint32_t index = indices[key[0].data[0] * key_2_range + key_2.data[0]];
+            if (index != NO_ENTRY) {
+                return index;
+            }
+        }
+        info("LookupKeyIndex: Key not found!");
+        ASSERT(false);
+        return 0;
+    }
+
+    bool operator==(const LookupKeyIndex& other) const = default;
+};
+
 /**
  * @brief A basic table from which we can perform lookups (for example, an xor table)
  * @details Also stores the lookup gate data for all lookups performed on this table
@@ -376,8 +467,24 @@ struct BasicTable {
 
     // Map from a table entry to its index in the table; used for constructing read counts
     LookupHashTable index_map;
+    // Dense map from the key of a lookup to its index in the table; used instead of index_map where the keys allow it
+    LookupKeyIndex key_index;
+
+    void initialize_index_map()
+    {
+        if (!key_index.initialize(column_1, column_2, use_twin_keys)) {
+            index_map.initialize(column_1, column_2, column_3);
+        }
+    }
 
-    void initialize_index_map() { index_map.initialize(column_1, column_2, column_3); }
+    // Given the data of a lookup gate, return the index in the table of the entry it reads
+    size_t get_index(const LookupEntry& lookup) const
+    {
+        if (key_index.is_initialized()) {
+            return key_index[lookup.key];
+        }
+        return index_map[lookup.to_table_components(use_twin_keys)];
+    }
 
     std::array<bb::fr, 2> (*get_values_from_key)(const std::array<uint64_t, 2>);
 
@@ -0,0 +1,230 @@
+#include "precomputed_polynomials_cache.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_keccak.hpp"
+#include <span>
+#include <sstream>
+#include <typeinfo>
+#ifndef __wasm__
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace bb {
+
+namespace {
+constexpr size_t align_up(size_t offset, size_t alignment)
+{
+    return (offset + alignment - 1) / alignment * alignment;
+}
+} // namespace
+
+template <class Flavor>
+std::string PrecomputedPolynomialsCache<Flavor>::compute_circuit_key(Circuit& circuit,
+                                                                     size_t dyadic_circuit_size,
+                                                                     TraceStructure trace_structure)
+{
+    ZoneScopedN("PrecomputedPolynomialsCache::compute_circuit_key");
+
+    // Gather a view of every column the precomputed polynomials depend on
+    std::vector<std::span<const uint8_t>> columns;
+    auto add_column = [&columns](const auto& column) {
+        columns.emplace_back(reinterpret_cast<const uint8_t*>(column.data()), column.size() * sizeof(column[0]));
+    };
+    for (auto& block : circuit.blocks.get()) {
+        for (auto& wire : block.wires) {
+            add_column(wire);
+        }
+        for (auto& selector : block.selectors) {
+            // A selector is hashed through its compact representation, which determines its values
+            add_column(std::span(&selector.get_constant_value(), 1));
+            add_column(selector.get_exception_indices());
+            add_column(selector.get_exception_values());
+            add_column(selector.get_dense_values());
+        }
+    }
+    add_column(circuit.real_variable_index);
+    add_column(circuit.public_inputs);
+
+    // The tags and the tag permutation determine the generalized permutation (id and sigma polynomials)
+    add_column(circuit.real_variable_tags);
+    std::vector<uint32_t> tau; // the (tag, image) pairs of the tag permutation, in the order of the tags
+    tau.reserve(2 * circuit.tau.size());
+    for (const auto& [tag, image] : circuit.tau) {
+        tau.emplace_back(tag);
+        tau.emplace_back(image);
+    }
+    add_column(tau);
+
+    std::vector<uint64_t> metadata{ dyadic_circuit_size,
+                                    static_cast<uint64_t>(trace_structure),
+                                    Flavor::NUM_PRECOMPUTED_ENTITIES };
+    for (const auto& table : circuit.lookup_tables) {
+        metadata.emplace_back(static_cast<uint64_t>(table.id));
+    }
+    add_column(metadata);
+    const std::string flavor_name = typeid(Flavor).name();
+    add_column(flavor_name);
+
+    // Hash the columns independently, then hash the concatenation of their digests
+    std::vector<crypto::Sha256Hash> digests(columns.size());
+    parallel_for(columns.size(), [&](size_t idx) {
+        digests[idx] = crypto::sha256(columns[idx]);
+    });
+    std::vector<uint8_t> concatenated_digests;
+    concatenated_digests.reserve(digests.size() * sizeof(crypto::Sha256Hash));
+    for (const auto& digest : digests) {
+        concatenated_digests.insert(concatenated_digests.end(), digest.begin(), digest.end());
+    }
+
+    std::stringstream key;
+    key << crypto::sha256(concatenated_digests);
+    return key.str();
+}
+
+template <class Flavor>
+bool PrecomputedPolynomialsCache<Flavor>::load([[maybe_unused]] const std::string& key,
+                                               [[maybe_unused]] ProvingKey& proving_key,
+                                               [[maybe_unused]] size_t dyadic_circuit_size,
+                                               [[maybe_unused]] size_t num_public_inputs,
+                                               [[maybe_unused]] std::shared_ptr<CommitmentKey> commitment_key) const
+{
+#ifdef __wasm__
+    return false;
+#else
+    ZoneScopedN("PrecomputedPolynomialsCache::load");
+    const std::string path = get_entry_path(key);
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        close(fd);
+        return false;
+    }
+    const auto file_size = static_cast<size_t>(file_stat.st_size);
+    // Map privately and writably: the polynomials behave like any other (mutable) polynomial but writes are never
+    // propagated to the cache entry.
+    void* addr = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    std::shared_ptr<uint8_t[]> mapping(static_cast<uint8_t*>(addr),
+                                       [file_size](uint8_t* ptr) { munmap(ptr, file_size); });
+
+    // Validate the header
+    constexpr size_t num_polynomials = Flavor::NUM_PRECOMPUTED_ENTITIES;
+    constexpr size_t HEADER_SIZE = 4;
+    const size_t header_bytes = (HEADER_SIZE + num_polynomials) * sizeof(uint64_t);
+    const size_t polynomial_bytes = (dyadic_circuit_size + Polynomial::MAXIMUM_COEFFICIENT_SHIFT) * sizeof(FF);
+    if (file_size < header_bytes) {
+        return false;
+    }
+    std::vector<uint64_t> header(HEADER_SIZE + num_polynomials);
+    memcpy(header.data(), mapping.get(), header_bytes);
+    if (header[0] != MAGIC || header[1] != VERSION || header[2] != dyadic_circuit_size ||
+        header[3] != num_polynomials) {
+        info("PrecomputedPolynomialsCache: ignoring incompatible entry ", path);
+        return false;
+    }
+    std::span<const uint64_t> offsets{ header.data() + HEADER_SIZE, num_polynomials };
+    for (const auto& offset : offsets) {
+        if (offset % POLYNOMIAL_ALIGNMENT != 0 || offset + polynomial_bytes > file_size) {
+            info("PrecomputedPolynomialsCache: ignoring corrupt entry ", path);
+            return false;
+        }
+    }
+    madvise(addr, file_size, MADV_WILLNEED);
+
+    // Initialize the proving key: precomputed polynomials alias the mapping, witness polynomials are allocated as usual
+    static_cast<typename ProvingKey::Base&>(proving_key) =
+        typename ProvingKey::Base(dyadic_circuit_size, num_public_inputs, std::move(commitment_key));
+    size_t poly_idx = 0;
+    for (auto& polynomial : proving_key.polynomials.get_precomputed()) {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        std::shared_ptr<FF[]> memory(mapping, reinterpret_cast<FF*>(mapping.get() + offsets[poly_idx++]));
+        polynomial = Polynomial(std::move(memory), dyadic_circuit_size, dyadic_circuit_size);
+    }
+    for (auto& polynomial : proving_key.polynomials.get_witness()) {
+        polynomial = Polynomial{ dyadic_circuit_size };
+    }
+    proving_key.polynomials.set_shifted();
+    vinfo("loaded precomputed polynomials from ", path);
+    return true;
+#endif
+}
+
+template <class Flavor>
+void PrecomputedPolynomialsCache<Flavor>::store([[maybe_unused]] const std::string& key,
+                                                [[maybe_unused]] ProvingKey& proving_key) const
+{
+#ifndef __wasm__
+    ZoneScopedN("PrecomputedPolynomialsCache::store");
+    const size_t circuit_size = proving_key.circuit_size;
+    for (auto& polynomial : proving_key.polynomials.get_precomputed()) {
+        if (polynomial.size() != circuit_size || polynomial.virtual_size() != circuit_size) {
+            info("PrecomputedPolynomialsCache: cannot cache polynomials of non-full size");
+            return;
+        }
+    }
+
+    // Lay out the header followed by the page-aligned polynomials, each with its zero shift padding
+    constexpr size_t num_polynomials = Flavor::NUM_PRECOMPUTED_ENTITIES;
+    const size_t polynomial_bytes = (circuit_size + Polynomial::MAXIMUM_COEFFICIENT_SHIFT) * sizeof(FF);
+    std::vector<uint64_t> header{ MAGIC, VERSION, circuit_size, num_polynomials };
+    size_t offset = align_up((header.size() + num_polynomials) * sizeof(uint64_t), POLYNOMIAL_ALIGNMENT);
+    for (size_t i = 0; i < num_polynomials; ++i) {
+        header.emplace_back(offset);
+        offset += align_up(polynomial_bytes, POLYNOMIAL_ALIGNMENT);
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(cache_dir, error);
+    const std::string path = get_entry_path(key);
+    const std::string tmp_path = path + ".tmp" + std::to_string(getpid());
+    std::ofstream os(tmp_path, std::ios::binary | std::ios::trunc);
+    const std::vector<char> zeros(POLYNOMIAL_ALIGNMENT, 0);
+    auto pad_to_alignment = [&](size_t bytes_written) {
+        os.write(zeros.data(), static_cast<std::streamsize>(align_up(bytes_written, POLYNOMIAL_ALIGNMENT) - bytes_written));
+    };
+
+    const size_t header_bytes = header.size() * sizeof(uint64_t);
+    os.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header_bytes));
+    pad_to_alignment(header_bytes);
+    for (auto& polynomial : proving_key.polynomials.get_precomputed()) {
+        os.write(reinterpret_cast<const char*>(polynomial.data()), static_cast<std::streamsize>(circuit_size * sizeof(FF)));
+        os.write(zeros.data(), static_cast<std::streamsize>(Polynomial::MAXIMUM_COEFFICIENT_SHIFT * sizeof(FF)));
+        pad_to_alignment(polynomial_bytes);
+    }
+    os.close();
+
+    if (!os.good()) {
+        info("PrecomputedPolynomialsCache: failed to write ", tmp_path);
+        std::filesystem::remove(tmp_path, error);
+        return;
+    }
+    std::filesystem::rename(tmp_path, path, error);
+    if (error) {
+        info("PrecomputedPolynomialsCache: failed to publish ", path, ": ", error.message());
+        std::filesystem::remove(tmp_path, error);
+        return;
+    }
+    vinfo("stored precomputed polynomials in ", path);
+#endif
+}
+
+template class PrecomputedPolynomialsCache<UltraFlavor>;
+template class PrecomputedPolynomialsCache<UltraKeccakFlavor>;
+template class PrecomputedPolynomialsCache<MegaFlavor>;
+
+} // namespace bb
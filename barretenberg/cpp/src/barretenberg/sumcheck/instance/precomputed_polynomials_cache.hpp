@@ -0,0 +1,78 @@
+#pragma once
+#include "barretenberg/flavor/flavor.hpp"
+#include "barretenberg/plonk_honk_shared/arithmetization/arithmetization.hpp"
+#include <memory>
+#include <string>
+
+namespace bb {
+
+/**
+ * @brief An on-disk cache of the precomputed polynomials of a Honk proving key (selectors, sigmas, ids, tables,
+ * lagrange polynomials, ...), keyed by a hash of the circuit structure.
+ * @details The precomputed polynomials depend only on the structure of a circuit, not on its witness, so repeated
+ * proofs of the same circuit can skip their construction entirely and only compute the witness-dependent columns.
+ *
+ * Each cache entry is a single file: a header followed by the precomputed polynomials, each of which starts at an
+ * offset aligned to POLYNOMIAL_ALIGNMENT (a multiple of any page size we expect to run on). On load the file is
+ * memory-mapped privately and the polynomials are constructed directly on top of the mapping, so nothing is copied and
+ * the cache file is never modified; pages are faulted in as the prover touches them.
+ *
+ * @note Polynomials are stored in their in-memory (Montgomery) representation. Entries are meant to be reused on the
+ * machine that produced them, this is not a portable serialization format.
+ * @note Memory mapping is not available in WASM; there the cache never hits and store is a no-op.
+ *
+ * @tparam Flavor An Ultra or Mega Honk flavor
+ */
+template <class Flavor> class PrecomputedPolynomialsCache {
+    using Circuit = typename Flavor::CircuitBuilder;
+    using CommitmentKey = typename Flavor::CommitmentKey;
+    using ProvingKey = typename Flavor::ProvingKey;
+    using Polynomial = typename Flavor::Polynomial;
+    using FF = typename Flavor::FF;
+
+  public:
+    static constexpr uint64_t MAGIC = 0x4b50'4b4e'4f48'4242; // "BBHONKPK"
+    static constexpr uint64_t VERSION = 1;
+    static constexpr size_t POLYNOMIAL_ALIGNMENT = 1UL << 16;
+
+    explicit PrecomputedPolynomialsCache(std::string cache_dir)
+        : cache_dir(std::move(cache_dir))
+    {}
+
+    /**
+     * @brief Compute a key identifying everything the precomputed polynomials of a finalized circuit depend on
+     * @details Hashes the wires and selectors of every block, the copy constraints (real variable indices), the public
+     * input indices, the variable tags and tag permutation, the lookup tables in use, the dyadic size, the trace
+     * structure and the flavor. Each column is hashed separately (in parallel) and the key is the hash of the column
+     * digests.
+     */
+    static std::string compute_circuit_key(Circuit& circuit,
+                                           size_t dyadic_circuit_size,
+                                           TraceStructure trace_structure);
+
+    /**
+     * @brief Initialize a proving key whose precomputed polynomials are mapped from the cache entry for key and whose
+     * witness polynomials are freshly allocated (zeroed)
+     *
+     * @return true on a cache hit; on a miss proving_key is left untouched
+     */
+    bool load(const std::string& key,
+              ProvingKey& proving_key,
+              size_t dyadic_circuit_size,
+              size_t num_public_inputs,
+              std::shared_ptr<CommitmentKey> commitment_key) const;
+
+    /**
+     * @brief Write the precomputed polynomials of a proving key to the cache entry for key
+     * @details The entry is written to a temporary file which is then renamed, so concurrent provers never observe a
+     * partially written entry.
+     */
+    void store(const std::string& key, ProvingKey& proving_key) const;
+
+    std::string get_entry_path(const std::string& key) const { return cache_dir + "/" + key + ".pk"; }
+
+  private:
+    std::string cache_dir;
+};
+
+} // namespace bb
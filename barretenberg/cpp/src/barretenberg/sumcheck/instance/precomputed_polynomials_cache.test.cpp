@@ -0,0 +1,75 @@
+#include "barretenberg/sumcheck/instance/precomputed_polynomials_cache.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
+#include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+template <typename Flavor> class PrecomputedPolynomialsCacheKeyTests : public ::testing::Test {
+  public:
+    using Builder = typename Flavor::CircuitBuilder;
+    using Cache = PrecomputedPolynomialsCache<Flavor>;
+
+    static Builder construct_circuit()
+    {
+        Builder builder;
+        MockCircuits::add_arithmetic_gates_with_public_inputs(builder, 5);
+        MockCircuits::add_lookup_gates(builder);
+        if constexpr (IsGoblinFlavor<Flavor>) {
+            MockCircuits::construct_goblin_ecc_op_circuit(builder);
+        }
+        return builder;
+    }
+};
+
+using FlavorTypes = testing::Types<UltraFlavor, MegaFlavor>;
+TYPED_TEST_SUITE(PrecomputedPolynomialsCacheKeyTests, FlavorTypes);
+
+/**
+ * @brief Check that circuits differing only in their variable tags or in their tag permutation do not share a key, as
+ * these determine the id and sigma polynomials
+ *
+ */
+TYPED_TEST(PrecomputedPolynomialsCacheKeyTests, DistinctTags)
+{
+    using Builder = typename TestFixture::Builder;
+    using Cache = typename TestFixture::Cache;
+
+    // Two pairs of variables summing to zero, whose pairs are given tags 1 and 2 if tags are assigned
+    auto construct_tagged_circuit = [](bool assign_tags, bool swap_tags) {
+        Builder builder = TestFixture::construct_circuit();
+        fr a = fr::random_element();
+        auto a_idx = builder.add_variable(a);
+        auto b_idx = builder.add_variable(-a);
+        auto c_idx = builder.add_variable(-a);
+        auto d_idx = builder.add_variable(a);
+        builder.create_add_gate({ a_idx, b_idx, builder.zero_idx, fr::one(), fr::one(), fr::zero(), fr::zero() });
+        builder.create_add_gate({ c_idx, d_idx, builder.zero_idx, fr::one(), fr::one(), fr::zero(), fr::zero() });
+        if (assign_tags) {
+            builder.create_tag(1, swap_tags ? 2 : 1);
+            builder.create_tag(2, swap_tags ? 1 : 2);
+            builder.assign_tag(a_idx, 1);
+            builder.assign_tag(b_idx, 1);
+            builder.assign_tag(c_idx, 2);
+            builder.assign_tag(d_idx, 2);
+        }
+        builder.finalize_circuit();
+        return builder;
+    };
+
+    const size_t dyadic_circuit_size = 1UL << 16;
+    auto untagged_circuit = construct_tagged_circuit(/*assign_tags=*/false, /*swap_tags=*/false);
+    auto tagged_circuit = construct_tagged_circuit(/*assign_tags=*/true, /*swap_tags=*/false);
+    auto swapped_circuit = construct_tagged_circuit(/*assign_tags=*/true, /*swap_tags=*/true);
+    auto other_untagged_circuit = construct_tagged_circuit(/*assign_tags=*/false, /*swap_tags=*/false);
+
+    const auto untagged_key = Cache::compute_circuit_key(untagged_circuit, dyadic_circuit_size, TraceStructure::NONE);
+    const auto tagged_key = Cache::compute_circuit_key(tagged_circuit, dyadic_circuit_size, TraceStructure::NONE);
+    const auto swapped_key = Cache::compute_circuit_key(swapped_circuit, dyadic_circuit_size, TraceStructure::NONE);
+    EXPECT_EQ(untagged_key,
+              Cache::compute_circuit_key(other_untagged_circuit, dyadic_circuit_size, TraceStructure::NONE));
+    EXPECT_NE(untagged_key, tagged_key);
+    EXPECT_NE(tagged_key, swapped_key);
+}
@@ -36,9 +36,10 @@ template <class Flavor> size_t ProverInstance_<Flavor>::compute_dyadic_size(Circ
  *
  * @tparam Flavor
  * @param circuit
+ * @param populate_precomputed whether to also construct the (precomputed) databus id polynomial
  */
 template <class Flavor>
-void ProverInstance_<Flavor>::construct_databus_polynomials(Circuit& circuit)
+void ProverInstance_<Flavor>::construct_databus_polynomials(Circuit& circuit, bool populate_precomputed)
     requires IsGoblinFlavor<Flavor>
 {
     auto& public_calldata = proving_key.polynomials.calldata;
@@ -72,6 +73,9 @@ void ProverInstance_<Flavor>::construct_databus_polynomials(Circuit& circuit)
         return_data_read_tags[idx] = return_data_read_counts[idx] > 0 ? 1 : 0; // has row been read or not
     }
 
+    if (!populate_precomputed) {
+        return;
+    }
     auto& databus_id = proving_key.polynomials.databus_id;
     // Compute a simple identity polynomial for use in the databus lookup argument
     for (size_t i = 0; i < databus_id.size(); ++i) {
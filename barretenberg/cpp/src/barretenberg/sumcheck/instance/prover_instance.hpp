@@ -5,7 +5,9 @@
 #include "barretenberg/plonk_honk_shared/arithmetization/ultra_arithmetization.hpp"
 #include "barretenberg/plonk_honk_shared/composer/composer_lib.hpp"
 #include "barretenberg/plonk_honk_shared/composer/permutation_lib.hpp"
+#include "barretenberg/polynomials/polynomial_scratch_store.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
+#include "barretenberg/sumcheck/instance/precomputed_polynomials_cache.hpp"
 #include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_keccak.hpp"
@@ -31,6 +33,8 @@ template <class Flavor> class ProverInstance_ {
     using RelationSeparator = typename Flavor::RelationSeparator;
 
     using Trace = ExecutionTrace_<Flavor>;
+    using PrecomputedCache = PrecomputedPolynomialsCache<Flavor>;
+    using ScratchStore = PolynomialScratchStore<FF>;
 
   public:
     ProvingKey proving_key;
@@ -42,10 +46,22 @@ template <class Flavor> class ProverInstance_ {
     // The folding parameters (\vec{β}, e) which are set for accumulators (i.e. relaxed instances).
     std::vector<FF> gate_challenges;
     FF target_sum;
+    // For accumulators, the rows on which some relation may be active (nonzero byte), as recorded by the fold that
+    // produced them. Empty if not known.
+    std::vector<uint8_t> active_rows;
 
+    // If set, the prover polynomials live in this out-of-core store and the prover gives it residency hints
+    std::shared_ptr<ScratchStore> scratch_store;
+
+    /**
+     * @param precomputed_cache If provided, the precomputed polynomials are mapped from this cache when it holds an
+     * entry for the circuit (in which case only the witness-dependent polynomials are constructed), and are written to
+     * it otherwise.
+     */
     ProverInstance_(Circuit& circuit,
                     TraceStructure trace_structure = TraceStructure::NONE,
-                    std::shared_ptr<typename Flavor::CommitmentKey> commitment_key = nullptr)
+                    std::shared_ptr<typename Flavor::CommitmentKey> commitment_key = nullptr,
+                    std::shared_ptr<PrecomputedCache> precomputed_cache = nullptr)
     {
         BB_OP_COUNT_TIME_NAME("ProverInstance(Circuit&)");
         circuit.add_gates_to_ensure_all_polys_are_non_zero();
@@ -70,25 +86,36 @@ template <class Flavor> class ProverInstance_ {
         if constexpr (IsGoblinFlavor<Flavor>) {
             circuit.op_queue->append_nonzero_ops();
         }
-        {
+        // On a cache hit the proving key comes with its precomputed polynomials already in place
+        std::string cache_key;
+        bool precomputed_from_cache = false;
+        if (precomputed_cache) {
+            cache_key = PrecomputedCache::compute_circuit_key(circuit, dyadic_circuit_size, trace_structure);
+            precomputed_from_cache = precomputed_cache->load(
+                cache_key, proving_key, dyadic_circuit_size, circuit.public_inputs.size(), commitment_key);
+        }
+        if (!precomputed_from_cache) {
             ZoneScopedN("constructing proving key");
             proving_key = ProvingKey(dyadic_circuit_size, circuit.public_inputs.size(), commitment_key);
         }
 
         // Construct and add to proving key the wire, selector and copy constraint polynomials
-        Trace::populate(circuit, proving_key, is_structured);
+        Trace::populate(circuit, proving_key, is_structured, /*populate_precomputed=*/!precomputed_from_cache);
         ZoneScopedN("constructing prover instance after trace populate");
 
         // If Goblin, construct the databus polynomials
         if constexpr (IsGoblinFlavor<Flavor>) {
-            construct_databus_polynomials(circuit);
+            construct_databus_polynomials(circuit, /*populate_precomputed=*/!precomputed_from_cache);
         }
 
-        // First and last lagrange polynomials (in the full circuit size)
-        proving_key.polynomials.lagrange_first[0] = 1;
-        proving_key.polynomials.lagrange_last[dyadic_circuit_size - 1] = 1;
+        if (!precomputed_from_cache) {
+            // First and last lagrange polynomials (in the full circuit size)
+            proving_key.polynomials.lagrange_first[0] = 1;
+            proving_key.polynomials.lagrange_last[dyadic_circuit_size - 1] = 1;
 
-        construct_lookup_table_polynomials<Flavor>(proving_key.polynomials.get_tables(), circuit, dyadic_circuit_size);
+            construct_lookup_table_polynomials<Flavor>(
+                proving_key.polynomials.get_tables(), circuit, dyadic_circuit_size);
+        }
 
         construct_lookup_read_counts<Flavor>(proving_key.polynomials.lookup_read_counts,
                                              proving_key.polynomials.lookup_read_tags,
@@ -110,11 +137,27 @@ template <class Flavor> class ProverInstance_ {
         if constexpr (IsGoblinFlavor<Flavor>) { // Set databus commitment propagation data
             proving_key.databus_propagation_data = circuit.databus_propagation_data;
         }
+
+        if (precomputed_cache && !precomputed_from_cache) {
+            precomputed_cache->store(cache_key, proving_key);
+        }
     }
 
     ProverInstance_() = default;
     ~ProverInstance_() = default;
 
+    /**
+     * @brief Move the prover polynomials into an out-of-core scratch store, so that the prover can page them out
+     * between the stages in which they are used
+     */
+    void use_scratch_store(std::shared_ptr<ScratchStore> store)
+    {
+        scratch_store = std::move(store);
+        scratch_store->adopt_all(proving_key.polynomials);
+        // Nothing is needed until Oink asks for it
+        scratch_store->release_all(proving_key.polynomials.get_unshifted());
+    }
+
   private:
     static constexpr size_t num_zero_rows = Flavor::has_zero_row ? 1 : 0;
     static constexpr size_t NUM_WIRES = Circuit::NUM_WIRES;
@@ -132,7 +175,7 @@ template <class Flavor> class ProverInstance_ {
         return builder.get_circuit_subgroup_size(minimum_size);
     }
 
-    void construct_databus_polynomials(Circuit&)
+    void construct_databus_polynomials(Circuit&, bool populate_precomputed = true)
         requires IsGoblinFlavor<Flavor>;
 };
 
@@ -187,7 +187,8 @@ template <typename Flavor> class SumcheckProver {
         return prove(instance->proving_key.polynomials,
                      instance->relation_parameters,
                      instance->alphas,
-                     instance->gate_challenges);
+                     instance->gate_challenges,
+                     instance->scratch_store.get());
     };
 
     /**
@@ -198,12 +199,15 @@ template <typename Flavor> class SumcheckProver {
      * @param relation_parameters
      * @param alpha Batching challenge for subrelations.
      * @param gate_challenges
+     * @param scratch_store If the full polynomials live in an out-of-core store, it is told that they are streamed
+     * through once in the first round and not needed afterwards
      * @return SumcheckOutput
      */
     SumcheckOutput<Flavor> prove(ProverPolynomials& full_polynomials,
                                  const bb::RelationParameters<FF>& relation_parameters,
                                  const RelationSeparator alpha,
-                                 const std::vector<FF>& gate_challenges)
+                                 const std::vector<FF>& gate_challenges,
+                                 PolynomialScratchStore<FF>* scratch_store = nullptr)
     {
         // In case the Flavor has ZK, we populate sumcheck data structure with randomness, compute correcting term for
         // the total sum, etc.
@@ -216,6 +220,9 @@ template <typename Flavor> class SumcheckProver {
         std::vector<FF> multivariate_challenge;
         multivariate_challenge.reserve(multivariate_d);
         size_t round_idx = 0;
+        if (scratch_store != nullptr) {
+            scratch_store->stream_all(full_polynomials.get_unshifted());
+        }
         // In the first round, we compute the first univariate polynomial and populate the book-keeping table of
         // #partially_evaluated_polynomials, which has \f$ n/2 \f$ rows and \f$ N \f$ columns. When the Flavor has ZK,
         // compute_univariate also takes into account the zk_sumcheck_data.
@@ -230,6 +237,10 @@ template <typename Flavor> class SumcheckProver {
             multivariate_challenge.emplace_back(round_challenge);
             // Prepare sumcheck book-keeping table for the next round
             partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+            // The remaining rounds only read the book-keeping table
+            if (scratch_store != nullptr) {
+                scratch_store->release_all(full_polynomials.get_unshifted());
+            }
             // Prepare ZK Sumcheck data for the next round
             if constexpr (Flavor::HasZK) {
                 update_zk_sumcheck_data(zk_sumcheck_data, round_challenge, round_idx);
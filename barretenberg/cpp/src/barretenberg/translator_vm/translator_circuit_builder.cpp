@@ -8,6 +8,7 @@
  *
  */
 #include "translator_circuit_builder.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include "barretenberg/plonk/proof_system/constants.hpp"
@@ -372,25 +373,54 @@ TranslatorCircuitBuilder::AccumulationInput generate_witness_values(Fr op_code,
  * @param acc_step
  */
 void TranslatorCircuitBuilder::create_accumulation_gate(const AccumulationInput acc_step)
+{
+    const size_t row = num_gates;
+    for (auto& wire : wires) {
+        wire.resize(row + 2);
+    }
+    populate_accumulation_gate(acc_step, row, add_variables(NUM_VARIABLES_PER_ACCUMULATION_GATE));
+
+    num_gates += 2;
+
+    // Check that all the wires are filled equally
+    bb::constexpr_for<0, TOTAL_COUNT, 1>([&]<size_t i>() { ASSERT(std::get<i>(wires).size() == num_gates); });
+}
+
+/**
+ * @brief Fill rows row and row + 1 of the wires and the variables starting at first_variable with an accumulation
+ * gate
+ *
+ * @details The wire rows and variables must already exist. They are written in the same order as they would be
+ * appended, and nothing else in the builder is modified, so gates for distinct rows can be populated concurrently.
+ */
+void TranslatorCircuitBuilder::populate_accumulation_gate(const AccumulationInput& acc_step,
+                                                          const size_t row,
+                                                          const uint32_t first_variable)
 {
     // The first wires OpQueue/Transcript wires
     // Opcode should be {0,1,2,3,4,8}
     ASSERT(acc_step.op_code == 0 || acc_step.op_code == 1 || acc_step.op_code == 2 || acc_step.op_code == 3 ||
            acc_step.op_code == 4 || acc_step.op_code == 8);
 
+    uint32_t next_variable = first_variable;
+    auto set_next_variable = [this, &next_variable](const Fr& value) {
+        variables[next_variable] = value;
+        return next_variable++;
+    };
+
     auto& op_wire = std::get<WireIds::OP>(wires);
-    op_wire.push_back(add_variable(acc_step.op_code));
+    op_wire[row] = set_next_variable(acc_step.op_code);
     // Every second op value in the transcript (indices 3, 5, etc) are not defined so let's just put zero there
-    op_wire.push_back(zero_idx);
+    op_wire[row + 1] = zero_idx;
 
     /**
      * @brief Insert two values into the same wire sequentially
      *
      */
-    auto insert_pair_into_wire = [this](WireIds wire_index, Fr first, Fr second) {
+    auto insert_pair_into_wire = [this, row, &set_next_variable](WireIds wire_index, Fr first, Fr second) {
         auto& current_wire = wires[wire_index];
-        current_wire.push_back(add_variable(first));
-        current_wire.push_back(add_variable(second));
+        current_wire[row] = set_next_variable(first);
+        current_wire[row + 1] = set_next_variable(second);
     };
 
     // Check and insert P_x_lo and P_y_hi into wire 1
@@ -481,13 +511,15 @@ void TranslatorCircuitBuilder::create_accumulation_gate(const AccumulationInput
      * @brief Put several values in sequential wires
      *
      */
-    auto lay_limbs_in_row =
-        [this]<size_t array_size>(std::array<Fr, array_size> input, WireIds starting_wire, size_t number_of_elements) {
-            ASSERT(number_of_elements <= array_size);
-            for (size_t i = 0; i < number_of_elements; i++) {
-                wires[starting_wire + i].push_back(add_variable(input[i]));
-            }
-        };
+    auto lay_limbs_in_row = [this, &set_next_variable]<size_t array_size>(const std::array<Fr, array_size>& input,
+                                                                          WireIds starting_wire,
+                                                                          size_t number_of_elements,
+                                                                          size_t row_index) {
+        ASSERT(number_of_elements <= array_size);
+        for (size_t i = 0; i < number_of_elements; i++) {
+            wires[starting_wire + i][row_index] = set_next_variable(input[i]);
+        }
+    };
 
     // We are using some leftover crevices for relation_wide_microlimbs
     auto low_relation_microlimbs = acc_step.relation_wide_microlimbs[0];
@@ -522,36 +554,34 @@ void TranslatorCircuitBuilder::create_accumulation_gate(const AccumulationInput
     top_quotient_microlimbs[NUM_MICRO_LIMBS - 1] = high_relation_microlimbs[NUM_MICRO_LIMBS - 1];
 
     // Now put all microlimbs into appropriate wires
-    lay_limbs_in_row(acc_step.P_x_microlimbs[0], P_X_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.P_x_microlimbs[1], P_X_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.P_x_microlimbs[2], P_X_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(top_p_x_microlimbs, P_X_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.P_y_microlimbs[0], P_Y_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.P_y_microlimbs[1], P_Y_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.P_y_microlimbs[2], P_Y_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(top_p_y_microlimbs, P_Y_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.z_1_microlimbs[0], Z_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.z_2_microlimbs[0], Z_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.z_1_microlimbs[1], Z_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.z_2_microlimbs[1], Z_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.current_accumulator, ACCUMULATORS_BINARY_LIMBS_0, NUM_BINARY_LIMBS);
-    lay_limbs_in_row(acc_step.previous_accumulator, ACCUMULATORS_BINARY_LIMBS_0, NUM_BINARY_LIMBS);
+    lay_limbs_in_row(acc_step.P_x_microlimbs[0], P_X_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, row);
+    lay_limbs_in_row(acc_step.P_x_microlimbs[1], P_X_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, row + 1);
+    lay_limbs_in_row(acc_step.P_x_microlimbs[2], P_X_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, row);
+    lay_limbs_in_row(top_p_x_microlimbs, P_X_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, row + 1);
+    lay_limbs_in_row(acc_step.P_y_microlimbs[0], P_Y_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, row);
+    lay_limbs_in_row(acc_step.P_y_microlimbs[1], P_Y_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, row + 1);
+    lay_limbs_in_row(acc_step.P_y_microlimbs[2], P_Y_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, row);
+    lay_limbs_in_row(top_p_y_microlimbs, P_Y_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, row + 1);
+    lay_limbs_in_row(acc_step.z_1_microlimbs[0], Z_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, row);
+    lay_limbs_in_row(acc_step.z_2_microlimbs[0], Z_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, row + 1);
+    lay_limbs_in_row(acc_step.z_1_microlimbs[1], Z_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, row);
+    lay_limbs_in_row(acc_step.z_2_microlimbs[1], Z_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, row + 1);
+    lay_limbs_in_row(acc_step.current_accumulator, ACCUMULATORS_BINARY_LIMBS_0, NUM_BINARY_LIMBS, row);
+    lay_limbs_in_row(acc_step.previous_accumulator, ACCUMULATORS_BINARY_LIMBS_0, NUM_BINARY_LIMBS, row + 1);
     lay_limbs_in_row(
-        acc_step.current_accumulator_microlimbs[0], ACCUMULATOR_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
+        acc_step.current_accumulator_microlimbs[0], ACCUMULATOR_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, row);
     lay_limbs_in_row(
-        acc_step.current_accumulator_microlimbs[1], ACCUMULATOR_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
+        acc_step.current_accumulator_microlimbs[1], ACCUMULATOR_LOW_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, row + 1);
     lay_limbs_in_row(
-        acc_step.current_accumulator_microlimbs[2], ACCUMULATOR_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(top_current_accumulator_microlimbs, ACCUMULATOR_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.quotient_microlimbs[0], QUOTIENT_LOW_LIMBS_RANGE_CONSTRAIN_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.quotient_microlimbs[1], QUOTIENT_LOW_LIMBS_RANGE_CONSTRAIN_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(acc_step.quotient_microlimbs[2], QUOTIENT_HIGH_LIMBS_RANGE_CONSTRAIN_0, NUM_MICRO_LIMBS);
-    lay_limbs_in_row(top_quotient_microlimbs, QUOTIENT_HIGH_LIMBS_RANGE_CONSTRAIN_0, NUM_MICRO_LIMBS);
-
-    num_gates += 2;
+        acc_step.current_accumulator_microlimbs[2], ACCUMULATOR_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, row);
+    lay_limbs_in_row(
+        top_current_accumulator_microlimbs, ACCUMULATOR_HIGH_LIMBS_RANGE_CONSTRAINT_0, NUM_MICRO_LIMBS, row + 1);
+    lay_limbs_in_row(acc_step.quotient_microlimbs[0], QUOTIENT_LOW_LIMBS_RANGE_CONSTRAIN_0, NUM_MICRO_LIMBS, row);
+    lay_limbs_in_row(acc_step.quotient_microlimbs[1], QUOTIENT_LOW_LIMBS_RANGE_CONSTRAIN_0, NUM_MICRO_LIMBS, row + 1);
+    lay_limbs_in_row(acc_step.quotient_microlimbs[2], QUOTIENT_HIGH_LIMBS_RANGE_CONSTRAIN_0, NUM_MICRO_LIMBS, row);
+    lay_limbs_in_row(top_quotient_microlimbs, QUOTIENT_HIGH_LIMBS_RANGE_CONSTRAIN_0, NUM_MICRO_LIMBS, row + 1);
 
-    // Check that all the wires are filled equally
-    bb::constexpr_for<0, TOTAL_COUNT, 1>([&]<size_t i>() { ASSERT(std::get<i>(wires).size() == num_gates); });
+    ASSERT(next_variable == first_variable + NUM_VARIABLES_PER_ACCUMULATION_GATE);
 }
 
 /**
@@ -611,8 +641,10 @@ void TranslatorCircuitBuilder::feed_ecc_op_queue_into_circuit(std::shared_ptr<EC
 
     // We need to precompute the accumulators at each step, because in the actual circuit we compute the values starting
     // from the later indices. We need to know the previous accumulator to create the gate
-    for (size_t i = 0; i < raw_ops.size(); i++) {
-        const auto& ecc_op = raw_ops[raw_ops.size() - 1 - i];
+    const size_t num_ops = raw_ops.size();
+    accumulator_trace.reserve(num_ops);
+    for (size_t i = 0; i < num_ops; i++) {
+        const auto& ecc_op = raw_ops[num_ops - 1 - i];
         current_accumulator *= x;
         current_accumulator +=
             (Fq(ecc_op.get_opcode_value()) +
@@ -620,22 +652,35 @@ void TranslatorCircuitBuilder::feed_ecc_op_queue_into_circuit(std::shared_ptr<EC
         accumulator_trace.push_back(current_accumulator);
     }
 
-    // We don't care about the last value since we'll recompute it during witness generation anyway
-    accumulator_trace.pop_back();
-
-    for (const auto& raw_op : raw_ops) {
-        Fq previous_accumulator = 0;
-        // Pop the last value from accumulator trace and use it as previous accumulator
-        if (!accumulator_trace.empty()) {
-            previous_accumulator = accumulator_trace.back();
-            accumulator_trace.pop_back();
-        }
-        // Compute witness values
-        auto one_accumulation_step = compute_witness_values_for_one_ecc_op(raw_op, previous_accumulator, v, x);
-
-        // And put them into the wires
-        create_accumulation_gate(one_accumulation_step);
+    // Reserve the rows and variables of all the gates, so that each gate can be computed and written independently
+    const size_t first_row = num_gates;
+    for (auto& wire : wires) {
+        wire.resize(first_row + 2 * num_ops);
     }
+    const uint32_t first_variable = add_variables(num_ops * NUM_VARIABLES_PER_ACCUMULATION_GATE);
+
+    parallel_for_heuristic(
+        num_ops,
+        [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+            for (size_t i = start; i < end; i++) {
+                // The previous accumulator of the op at index i is the accumulation of the ops after it. The last value
+                // of the trace (all the ops) is recomputed during witness generation
+                const Fq previous_accumulator = (i + 1 < num_ops) ? accumulator_trace[num_ops - 2 - i] : Fq(0);
+
+                // Compute witness values
+                auto one_accumulation_step =
+                    compute_witness_values_for_one_ecc_op(raw_ops[i], previous_accumulator, v, x);
+
+                // And put them into the wires
+                populate_accumulation_gate(one_accumulation_step,
+                                           first_row + 2 * i,
+                                           first_variable +
+                                               static_cast<uint32_t>(i * NUM_VARIABLES_PER_ACCUMULATION_GATE));
+            }
+        },
+        thread_heuristics::ALWAYS_MULTITHREAD);
+
+    num_gates += 2 * num_ops;
 }
 bool TranslatorCircuitBuilder::check_circuit()
 {
@@ -226,6 +226,11 @@ class TranslatorCircuitBuilder : public CircuitBuilderBase<bb::fr> {
     // Maximum size of each relation limb (in accordance with range constraints)
     static constexpr uint256_t MAX_RELATION_WIDE_LIMB_SIZE = uint256_t(1) << RELATION_WIDE_LIMB_BITS;
 
+    // Number of variables created by an accumulation gate: the op code, 16 wires holding a pair of values, 20 rows of
+    // microlimbs and 2 rows of accumulator limbs (the second op wire value is always the zero variable)
+    static constexpr size_t NUM_VARIABLES_PER_ACCUMULATION_GATE =
+        1 + 2 * 16 + 20 * NUM_MICRO_LIMBS + 2 * NUM_BINARY_LIMBS;
+
     // Shift of a single micro (range constraint) limb
     static constexpr auto MICRO_SHIFT = uint256_t(1) << MICRO_LIMB_BITS;
 
@@ -424,6 +429,15 @@ class TranslatorCircuitBuilder : public CircuitBuilderBase<bb::fr> {
      */
     void create_accumulation_gate(AccumulationInput acc_step);
 
+    /**
+     * @brief Write an accumulation gate into existing rows and variables
+     *
+     * @param acc_step
+     * @param row The first of the two rows of the gate
+     * @param first_variable The first of NUM_VARIABLES_PER_ACCUMULATION_GATE consecutive variables of the gate
+     */
+    void populate_accumulation_gate(const AccumulationInput& acc_step, size_t row, uint32_t first_variable);
+
     /**
      * @brief Get the result of accumulation
      *
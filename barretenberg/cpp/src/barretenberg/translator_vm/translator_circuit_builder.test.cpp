@@ -127,4 +127,69 @@ TEST(TranslatorCircuitBuilder, SeveralOperationCorrectness)
     EXPECT_TRUE(circuit_builder.check_circuit());
     // Check the computation result is in line with what we've computed
     EXPECT_EQ(result, circuit_builder.get_computation_result());
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Check that feeding the op queue (which builds the gates concurrently) produces the same circuit as adding the
+ * accumulation gates one at a time
+ *
+ */
+TEST(TranslatorCircuitBuilder, FeedingOpQueueMatchesSequentialGates)
+{
+    using point = g1::affine_element;
+    using scalar = fr;
+    using Fq = fq;
+
+    auto op_queue = std::make_shared<ECCOpQueue>();
+    for (size_t i = 0; i < 40; i++) {
+        op_queue->add_accumulate(point::random_element());
+        op_queue->mul_accumulate(point::random_element(), scalar::random_element());
+        op_queue->eq_and_reset();
+    }
+    op_queue->empty_row_for_testing();
+
+    Fq v = Fq::random_element();
+    Fq x = Fq::random_element();
+    auto circuit_builder = TranslatorCircuitBuilder(v, x, op_queue);
+    EXPECT_TRUE(circuit_builder.check_circuit());
+
+    // Compute the previous accumulator of each op, i.e. the accumulation of the ops after it
+    const auto& raw_ops = op_queue->get_raw_ops();
+    std::vector<Fq> previous_accumulators(raw_ops.size());
+    Fq accumulator = 0;
+    for (size_t i = raw_ops.size(); i-- > 0;) {
+        previous_accumulators[i] = accumulator;
+        const auto& op = raw_ops[i];
+        accumulator = accumulator * x + Fq(op.get_opcode_value()) +
+                      v * (op.base_point.x + v * (op.base_point.y + v * (op.z1 + v * op.z2)));
+    }
+
+    constexpr size_t NUM_LIMB_BITS = TranslatorCircuitBuilder::NUM_LIMB_BITS;
+    auto sequential_builder = TranslatorCircuitBuilder(v, x);
+    for (size_t i = 0; i < raw_ops.size(); i++) {
+        const auto& op = raw_ops[i];
+        const uint256_t p_x = op.base_point.x;
+        const uint256_t p_y = op.base_point.y;
+        const fr p_x_lo = p_x.slice(0, 2 * NUM_LIMB_BITS);
+        const fr p_x_hi = p_x.slice(2 * NUM_LIMB_BITS, 4 * NUM_LIMB_BITS);
+        const fr p_y_lo = p_y.slice(0, 2 * NUM_LIMB_BITS);
+        const fr p_y_hi = p_y.slice(2 * NUM_LIMB_BITS, 4 * NUM_LIMB_BITS);
+        sequential_builder.create_accumulation_gate(generate_witness_values(fr(op.get_opcode_value()),
+                                                                            p_x_lo,
+                                                                            p_x_hi,
+                                                                            p_y_lo,
+                                                                            p_y_hi,
+                                                                            fr(op.z1),
+                                                                            fr(op.z2),
+                                                                            previous_accumulators[i],
+                                                                            v,
+                                                                            x));
+    }
+
+    EXPECT_EQ(circuit_builder.num_gates, sequential_builder.num_gates);
+    EXPECT_EQ(circuit_builder.variables, sequential_builder.variables);
+    for (size_t wire_idx = 0; wire_idx < TranslatorCircuitBuilder::NUM_WIRES; wire_idx++) {
+        EXPECT_EQ(circuit_builder.wires[wire_idx], sequential_builder.wires[wire_idx]);
+    }
+    EXPECT_EQ(circuit_builder.get_computation_result(), sequential_builder.get_computation_result());
+}
@@ -45,6 +45,11 @@ template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_relation_ch
 template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_pcs_rounds()
 {
     using ZeroMorph = ZeroMorphProver_<Curve>;
+    // The full polynomials are read once more, in a single pass, to be batched
+    auto& scratch_store = accumulator->scratch_store;
+    if (scratch_store) {
+        scratch_store->stream_all(accumulator->proving_key.polynomials.get_unshifted());
+    }
     auto prover_opening_claim = ZeroMorph::prove(accumulator->proving_key.circuit_size,
                                                  accumulator->proving_key.polynomials.get_unshifted(),
                                                  accumulator->proving_key.polynomials.get_to_be_shifted(),
@@ -53,6 +58,9 @@ template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_pcs_rounds(
                                                  sumcheck_output.challenge,
                                                  commitment_key,
                                                  transcript);
+    if (scratch_store) {
+        scratch_store->release_all(accumulator->proving_key.polynomials.get_unshifted());
+    }
     PCS::compute_opening_proof(commitment_key, prover_opening_claim, transcript);
 }
 
@@ -73,6 +81,10 @@ template <IsUltraFlavor Flavor> HonkProof DeciderProver_<Flavor>::construct_proo
     // Execute Zeromorph multilinear PCS
     execute_pcs_rounds();
 
+    if (accumulator->scratch_store) {
+        accumulator->scratch_store->print_statistics();
+    }
+
     return export_proof();
 }
 
@@ -36,6 +36,25 @@ template <typename Flavor> bool DeciderVerifier_<Flavor>::verify_proof(const Dec
  *
  */
 template <typename Flavor> bool DeciderVerifier_<Flavor>::verify()
+{
+    auto pairing_points = reduce_to_pairing_check();
+    if (!pairing_points.has_value()) {
+        return false;
+    }
+    return pcs_verification_key->pairing_check((*pairing_points)[0], (*pairing_points)[1]);
+}
+
+/**
+ * @brief Run sumcheck and the PCS reduction on the proof contained in the transcript, leaving only the final pairing
+ * check to be done
+ * @details Splitting off the pairing check allows the checks of many proofs to be batched into one, see
+ * UltraBatchVerifier_.
+ *
+ * @return The points {P₀, P₁} such that the proof is valid iff e(P₀,[1]₂)e(P₁,[x]₂) = 1, or std::nullopt if sumcheck
+ * failed
+ */
+template <typename Flavor>
+std::optional<typename DeciderVerifier_<Flavor>::PairingPoints> DeciderVerifier_<Flavor>::reduce_to_pairing_check()
 {
     using PCS = typename Flavor::PCS;
     using Curve = typename Flavor::Curve;
@@ -51,9 +70,9 @@ template <typename Flavor> bool DeciderVerifier_<Flavor>::verify()
         sumcheck.verify(accumulator->relation_parameters, accumulator->alphas, accumulator->gate_challenges);
 
     // If Sumcheck did not verify, return false
-    if (sumcheck_verified.has_value() && !sumcheck_verified.value()) {
+    if (!sumcheck_verified.value_or(false)) {
         info("Sumcheck verification failed.");
-        return false;
+        return std::nullopt;
     }
 
     // Execute ZeroMorph rounds. See https://hackmd.io/dlf9xEwhTQyE3hiGbq4FsA?view for a complete description of the
@@ -66,11 +85,7 @@ template <typename Flavor> bool DeciderVerifier_<Flavor>::verify()
                                            multivariate_challenge,
                                            Commitment::one(),
                                            transcript);
-    auto pairing_points = PCS::reduce_verify(opening_claim, transcript);
-
-    auto verified = pcs_verification_key->pairing_check(pairing_points[0], pairing_points[1]);
-
-    return sumcheck_verified.value() && verified;
+    return PCS::reduce_verify(opening_claim, transcript);
 }
 
 template class DeciderVerifier_<UltraFlavor>;
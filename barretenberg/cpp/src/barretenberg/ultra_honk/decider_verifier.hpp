@@ -17,6 +17,8 @@ template <typename Flavor> class DeciderVerifier_ {
     using DeciderProof = std::vector<FF>;
 
   public:
+    using PairingPoints = typename Flavor::PCS::VerifierAccumulator;
+
     explicit DeciderVerifier_();
     /**
      * @brief Constructor from prover instance and a transcript assumed to be initialized with a full honk proof
@@ -34,6 +36,7 @@ template <typename Flavor> class DeciderVerifier_ {
 
     bool verify_proof(const DeciderProof&); // used when a decider proof is known explicitly
     bool verify();                          // used when transcript that has been initialized with a proof
+    std::optional<PairingPoints> reduce_to_pairing_check();
     std::shared_ptr<VerificationKey> key;
     std::map<std::string, Commitment> commitments;
     std::shared_ptr<VerifierInstance> accumulator;
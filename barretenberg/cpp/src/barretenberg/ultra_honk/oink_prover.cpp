@@ -74,6 +74,10 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
 {
     // Commit to the first three wire polynomials of the instance
     // We only commit to the fourth wire polynomial after adding memory recordss
+    auto& scratch_store = instance->scratch_store;
+    if (scratch_store) {
+        scratch_store->prefetch_all(instance->proving_key.polynomials.get_wires());
+    }
     {
         BB_OP_COUNT_TIME_NAME("COMMIT::wires");
         witness_commitments.w_l = commitment_key->commit(instance->proving_key.polynomials.w_l);
@@ -110,6 +114,11 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
             }
             transcript->send_to_verifier(domain_separator + label, commitment);
         }
+        // The ecc op wires and databus columns are next used in sumcheck
+        if (scratch_store) {
+            scratch_store->release_all(instance->proving_key.polynomials.get_ecc_op_wires());
+            scratch_store->release_all(instance->proving_key.polynomials.get_databus_entities());
+        }
     }
 }
 
@@ -180,6 +189,17 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_log_derivative_
             transcript->send_to_verifier(domain_separator + label, commitment);
         }
     }
+
+    // The lookup argument is complete until sumcheck
+    if (instance->scratch_store) {
+        instance->scratch_store->release_all(instance->proving_key.polynomials.get_tables());
+        instance->scratch_store->release(instance->proving_key.polynomials.lookup_read_counts);
+        instance->scratch_store->release(instance->proving_key.polynomials.lookup_read_tags);
+        instance->scratch_store->release(instance->proving_key.polynomials.lookup_inverses);
+        if constexpr (IsGoblinFlavor<Flavor>) {
+            instance->scratch_store->release_all(instance->proving_key.polynomials.get_databus_inverses());
+        }
+    }
 }
 
 /**
@@ -195,6 +215,11 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_grand_product_c
         witness_commitments.z_perm = commitment_key->commit(instance->proving_key.polynomials.z_perm);
     }
     transcript->send_to_verifier(domain_separator + commitment_labels.z_perm, witness_commitments.z_perm);
+
+    // Nothing is needed again until sumcheck streams through all polynomials
+    if (instance->scratch_store) {
+        instance->scratch_store->release_all(instance->proving_key.polynomials.get_unshifted());
+    }
 }
 
 template <IsUltraFlavor Flavor> typename Flavor::RelationSeparator OinkProver<Flavor>::generate_alphas_round()
@@ -0,0 +1,107 @@
+#include "barretenberg/sumcheck/instance/precomputed_polynomials_cache.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
+#include "barretenberg/ultra_honk/ultra_prover.hpp"
+#include "barretenberg/ultra_honk/ultra_verifier.hpp"
+
+#include <filesystem>
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+template <typename Flavor> class PrecomputedPolynomialsCacheTests : public ::testing::Test {
+  public:
+    using Builder = typename Flavor::CircuitBuilder;
+    using ProverInstance = ProverInstance_<Flavor>;
+    using Prover = UltraProver_<Flavor>;
+    using Verifier = UltraVerifier_<Flavor>;
+    using VerificationKey = typename Flavor::VerificationKey;
+    using Cache = PrecomputedPolynomialsCache<Flavor>;
+
+    static void SetUpTestSuite() { bb::srs::init_crs_factory("../srs_db/ignition"); }
+
+    void SetUp() override
+    {
+        cache_dir = std::filesystem::temp_directory_path() /
+                    ("bb_pk_cache_" + std::to_string(reinterpret_cast<uintptr_t>(this)));
+        std::filesystem::remove_all(cache_dir);
+    }
+    void TearDown() override { std::filesystem::remove_all(cache_dir); }
+
+    // Circuits constructed by this method have the same structure but (random) distinct witnesses
+    static Builder construct_circuit()
+    {
+        Builder builder;
+        MockCircuits::add_arithmetic_gates_with_public_inputs(builder, 5);
+        MockCircuits::add_lookup_gates(builder);
+        if constexpr (IsGoblinFlavor<Flavor>) {
+            MockCircuits::construct_goblin_ecc_op_circuit(builder);
+        }
+        return builder;
+    }
+
+    static bool prove_and_verify(const std::shared_ptr<ProverInstance>& instance)
+    {
+        Prover prover(instance);
+        auto verification_key = std::make_shared<VerificationKey>(instance->proving_key);
+        Verifier verifier(verification_key);
+        auto proof = prover.construct_proof();
+        return verifier.verify_proof(proof);
+    }
+
+    std::filesystem::path cache_dir;
+};
+
+using FlavorTypes = testing::Types<UltraFlavor, MegaFlavor>;
+TYPED_TEST_SUITE(PrecomputedPolynomialsCacheTests, FlavorTypes);
+
+/**
+ * @brief Check that a second instance of the same circuit maps precomputed polynomials identical to the ones computed
+ * from scratch and that it produces a valid proof
+ *
+ */
+TYPED_TEST(PrecomputedPolynomialsCacheTests, RepeatedCircuit)
+{
+    using ProverInstance = typename TestFixture::ProverInstance;
+    using Cache = typename TestFixture::Cache;
+    auto cache = std::make_shared<Cache>(this->cache_dir.string());
+
+    // The first instance misses the cache and populates it
+    auto first_circuit = TestFixture::construct_circuit();
+    auto first_instance =
+        std::make_shared<ProverInstance>(first_circuit, TraceStructure::NONE, /*commitment_key=*/nullptr, cache);
+    EXPECT_TRUE(TestFixture::prove_and_verify(first_instance));
+    EXPECT_EQ(std::distance(std::filesystem::directory_iterator(this->cache_dir), {}), 1);
+
+    // A circuit with the same structure but a different witness hits the cache
+    auto second_circuit = TestFixture::construct_circuit();
+    auto uncached_circuit = second_circuit;
+    auto second_instance =
+        std::make_shared<ProverInstance>(second_circuit, TraceStructure::NONE, /*commitment_key=*/nullptr, cache);
+    auto uncached_instance = std::make_shared<ProverInstance>(uncached_circuit);
+
+    for (auto [cached, computed] : zip_view(second_instance->proving_key.polynomials.get_all(),
+                                            uncached_instance->proving_key.polynomials.get_all())) {
+        EXPECT_EQ(cached, computed);
+    }
+    EXPECT_TRUE(TestFixture::prove_and_verify(second_instance));
+}
+
+/**
+ * @brief Check that circuits of differing structure do not share a cache entry
+ *
+ */
+TYPED_TEST(PrecomputedPolynomialsCacheTests, DistinctCircuits)
+{
+    using ProverInstance = typename TestFixture::ProverInstance;
+    using Cache = typename TestFixture::Cache;
+    auto cache = std::make_shared<Cache>(this->cache_dir.string());
+
+    auto circuit = TestFixture::construct_circuit();
+    auto instance = std::make_shared<ProverInstance>(circuit, TraceStructure::NONE, nullptr, cache);
+
+    auto other_circuit = TestFixture::construct_circuit();
+    MockCircuits::add_arithmetic_gates(other_circuit, 1);
+    auto other_instance = std::make_shared<ProverInstance>(other_circuit, TraceStructure::NONE, nullptr, cache);
+    EXPECT_TRUE(TestFixture::prove_and_verify(other_instance));
+    EXPECT_EQ(std::distance(std::filesystem::directory_iterator(this->cache_dir), {}), 2);
+}
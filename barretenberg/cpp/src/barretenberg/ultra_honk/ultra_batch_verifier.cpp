@@ -0,0 +1,74 @@
+#include "./ultra_batch_verifier.hpp"
+#include "barretenberg/common/thread.hpp"
+
+namespace bb {
+
+template <typename Flavor>
+std::vector<bool> UltraBatchVerifier_<Flavor>::verify_proofs(
+    const std::vector<std::shared_ptr<VerificationKey>>& verification_keys, const std::vector<HonkProof>& proofs)
+{
+    ASSERT(verification_keys.size() == proofs.size());
+    const size_t num_proofs = proofs.size();
+    if (num_proofs == 0) {
+        return {};
+    }
+
+    // Verify each proof up to its pairing check. Proofs failing before it (e.g. in sumcheck) have no pairing points.
+    std::vector<std::optional<PairingPoints>> pairing_points(num_proofs);
+    parallel_for(num_proofs, [&](size_t idx) {
+        Verifier verifier{ verification_keys[idx] };
+        pairing_points[idx] = verifier.reduce_to_pairing_check(proofs[idx]);
+    });
+
+    // Batch the pairing checks with a random linear combination. The randomness is drawn upfront since the engine is
+    // not shared across threads.
+    std::vector<FF> batching_scalars(num_proofs);
+    for (auto& scalar : batching_scalars) {
+        scalar = FF::random_element();
+    }
+    std::vector<PairingPoints> scaled_pairing_points(num_proofs);
+    parallel_for(num_proofs, [&](size_t idx) {
+        if (pairing_points[idx].has_value()) {
+            scaled_pairing_points[idx] = { (*pairing_points[idx])[0] * batching_scalars[idx],
+                                           (*pairing_points[idx])[1] * batching_scalars[idx] };
+        }
+    });
+    PairingPoints batched_pairing_points{ GroupElement::infinity(), GroupElement::infinity() };
+    for (size_t idx = 0; idx < num_proofs; ++idx) {
+        if (pairing_points[idx].has_value()) {
+            batched_pairing_points[0] += scaled_pairing_points[idx][0];
+            batched_pairing_points[1] += scaled_pairing_points[idx][1];
+        }
+    }
+
+    auto pcs_verification_key = verification_keys[0]->pcs_verification_key;
+    std::vector<uint8_t> verified(num_proofs);
+    if (pcs_verification_key->pairing_check(batched_pairing_points[0], batched_pairing_points[1])) {
+        for (size_t idx = 0; idx < num_proofs; ++idx) {
+            verified[idx] = pairing_points[idx].has_value() ? 1 : 0;
+        }
+    } else {
+        // Some pairing check failed, find out which ones
+        parallel_for(num_proofs, [&](size_t idx) {
+            verified[idx] = pairing_points[idx].has_value() &&
+                                    verification_keys[idx]->pcs_verification_key->pairing_check(
+                                        (*pairing_points[idx])[0], (*pairing_points[idx])[1])
+                                ? 1
+                                : 0;
+        });
+    }
+    return { verified.begin(), verified.end() };
+}
+
+template <typename Flavor>
+std::vector<bool> UltraBatchVerifier_<Flavor>::verify_proofs(const std::shared_ptr<VerificationKey>& verification_key,
+                                                             const std::vector<HonkProof>& proofs)
+{
+    return verify_proofs(std::vector<std::shared_ptr<VerificationKey>>(proofs.size(), verification_key), proofs);
+}
+
+template class UltraBatchVerifier_<UltraFlavor>;
+template class UltraBatchVerifier_<UltraKeccakFlavor>;
+template class UltraBatchVerifier_<MegaFlavor>;
+
+} // namespace bb
@@ -0,0 +1,42 @@
+#pragma once
+#include "barretenberg/honk/proof_system/types/proof.hpp"
+#include "barretenberg/ultra_honk/ultra_verifier.hpp"
+
+namespace bb {
+
+/**
+ * @brief Verifies many Ultra/Mega Honk proofs at the cost of a single pairing
+ * @details Each proof is verified up to its final KZG pairing check e(P₀,[1]₂)e(P₁,[x]₂) = 1, in parallel across
+ * proofs. Since all pairing checks are against the same G2 points, they are batched with random scalars r_i into the
+ * single check e(∑ r_i⋅P₀_i,[1]₂)e(∑ r_i⋅P₁_i,[x]₂) = 1, which fails with overwhelming probability if any of the
+ * individual checks does. If the batched check fails, the pairing checks are redone per proof to find the invalid ones.
+ */
+template <typename Flavor> class UltraBatchVerifier_ {
+    using FF = typename Flavor::FF;
+    using GroupElement = typename Flavor::GroupElement;
+    using VerificationKey = typename Flavor::VerificationKey;
+    using Verifier = UltraVerifier_<Flavor>;
+    using PairingPoints = typename Verifier::PairingPoints;
+
+  public:
+    /**
+     * @brief Verify each proof against the verification key of the same index
+     * @note All verification keys must use the same verifier SRS.
+     *
+     * @return For each proof, whether it is valid
+     */
+    static std::vector<bool> verify_proofs(const std::vector<std::shared_ptr<VerificationKey>>& verification_keys,
+                                           const std::vector<HonkProof>& proofs);
+
+    /**
+     * @brief Verify all proofs against the same verification key
+     */
+    static std::vector<bool> verify_proofs(const std::shared_ptr<VerificationKey>& verification_key,
+                                           const std::vector<HonkProof>& proofs);
+};
+
+using UltraBatchVerifier = UltraBatchVerifier_<UltraFlavor>;
+using UltraKeccakBatchVerifier = UltraBatchVerifier_<UltraKeccakFlavor>;
+using MegaBatchVerifier = UltraBatchVerifier_<MegaFlavor>;
+
+} // namespace bb
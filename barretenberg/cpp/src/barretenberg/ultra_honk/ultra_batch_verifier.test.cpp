@@ -0,0 +1,105 @@
+#include "barretenberg/ultra_honk/ultra_batch_verifier.hpp"
+#include "barretenberg/ecc/fields/field_conversion.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
+#include "barretenberg/ultra_honk/ultra_prover.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+namespace {
+
+template <typename Flavor> class UltraBatchVerifierTests : public ::testing::Test {
+  public:
+    using Builder = typename Flavor::CircuitBuilder;
+    using Commitment = typename Flavor::Commitment;
+    using VerificationKey = typename Flavor::VerificationKey;
+    using ProverInstance = ProverInstance_<Flavor>;
+    using Prover = UltraProver_<Flavor>;
+    using Verifier = UltraVerifier_<Flavor>;
+    using BatchVerifier = UltraBatchVerifier_<Flavor>;
+
+    static void SetUpTestSuite() { bb::srs::init_crs_factory("../srs_db/ignition"); }
+
+    struct ProofAndKey {
+        HonkProof proof;
+        std::shared_ptr<VerificationKey> verification_key;
+    };
+
+    static ProofAndKey construct_proof(size_t num_gates)
+    {
+        Builder builder;
+        MockCircuits::add_arithmetic_gates_with_public_inputs(builder, num_gates);
+        auto instance = std::make_shared<ProverInstance>(builder);
+        Prover prover(instance);
+        auto verification_key = std::make_shared<VerificationKey>(instance->proving_key);
+        return { prover.construct_proof(), verification_key };
+    }
+
+    /**
+     * @brief Double the KZG quotient commitment, which is the last element of the proof. No challenge depends on it, so
+     * the proof only fails the final pairing check.
+     */
+    static void tamper_with_kzg_quotient(HonkProof& proof)
+    {
+        constexpr size_t num_frs = bb::field_conversion::calc_num_bn254_frs<Commitment>();
+        std::span<const fr> serialized{ proof.end() - num_frs, proof.end() };
+        auto quotient = bb::field_conversion::convert_from_bn254_frs<Commitment>(serialized);
+        Commitment tampered_quotient = quotient + quotient;
+        auto tampered_serialized = bb::field_conversion::convert_to_bn254_frs(tampered_quotient);
+        std::copy(tampered_serialized.begin(), tampered_serialized.end(), proof.end() - num_frs);
+    }
+};
+
+using FlavorTypes = ::testing::Types<UltraFlavor, MegaFlavor>;
+TYPED_TEST_SUITE(UltraBatchVerifierTests, FlavorTypes);
+
+} // namespace
+
+/**
+ * @brief Batch verify valid proofs of circuits of different sizes
+ *
+ */
+TYPED_TEST(UltraBatchVerifierTests, ValidProofs)
+{
+    using BatchVerifier = typename TestFixture::BatchVerifier;
+    using VerificationKey = typename TestFixture::VerificationKey;
+
+    std::vector<HonkProof> proofs;
+    std::vector<std::shared_ptr<VerificationKey>> verification_keys;
+    for (size_t num_gates : { 4, 100, 300, 4 }) {
+        auto [proof, verification_key] = TestFixture::construct_proof(num_gates);
+        proofs.emplace_back(proof);
+        verification_keys.emplace_back(verification_key);
+    }
+
+    auto results = BatchVerifier::verify_proofs(verification_keys, proofs);
+    EXPECT_EQ(results, std::vector<bool>(proofs.size(), true));
+}
+
+/**
+ * @brief Check that the batched pairing check catches a proof failing only its own pairing check, and that the
+ * fallback identifies it, as well as a proof failing sumcheck
+ *
+ */
+TYPED_TEST(UltraBatchVerifierTests, InvalidProofs)
+{
+    using BatchVerifier = typename TestFixture::BatchVerifier;
+    using Verifier = typename TestFixture::Verifier;
+
+    auto [proof, verification_key] = TestFixture::construct_proof(100);
+    std::vector<HonkProof> proofs(5, proof);
+
+    // Fails the pairing check only
+    TestFixture::tamper_with_kzg_quotient(proofs[1]);
+    {
+        Verifier verifier(verification_key);
+        EXPECT_FALSE(verifier.verify_proof(proofs[1]));
+    }
+    // Fails sumcheck, through the public input delta of the permutation relation. The public inputs follow the
+    // circuit size, the number of public inputs and their offset.
+    proofs[3][3] += fr(1);
+
+    auto results = BatchVerifier::verify_proofs(verification_key, proofs);
+    EXPECT_EQ(results, std::vector<bool>({ true, false, true, false, true }));
+}
@@ -106,6 +106,30 @@ TEST_F(UltraHonkTests, StructuredTrace)
     EXPECT_TRUE(verifier.verify_proof(proof));
 }
 
+/**
+ * @brief Test proof construction/verification with the prover polynomials paged out to a scratch file between stages
+ *
+ */
+TEST_F(UltraHonkTests, OutOfCorePolynomials)
+{
+    auto builder = UltraCircuitBuilder();
+    MockCircuits::add_arithmetic_gates_with_public_inputs(builder, 10);
+    MockCircuits::add_lookup_gates(builder);
+
+    auto instance = std::make_shared<ProverInstance>(builder);
+    // A zero budget evicts every polynomial as soon as the prover releases it
+    auto scratch_store = std::make_shared<PolynomialScratchStore<bb::fr>>(
+        PolynomialScratchStore<bb::fr>::Options{ .max_resident_bytes = 0 });
+    instance->use_scratch_store(scratch_store);
+    UltraProver prover(instance);
+    auto verification_key = std::make_shared<VerificationKey>(instance->proving_key);
+    UltraVerifier verifier(verification_key);
+    auto proof = prover.construct_proof();
+    EXPECT_TRUE(verifier.verify_proof(proof));
+    EXPECT_GT(scratch_store->get_statistics().num_evictions, 0);
+    EXPECT_EQ(scratch_store->get_resident_bytes(), 0);
+}
+
 /**
  * @brief Test simple circuit with public inputs
  *
@@ -730,13 +730,17 @@ bool AvmCircuitBuilder::check_circuit() const
         });
     });
 
-    // Add calculation of logderivatives and lookup/permutation checks.
+    // Calculate the logderivative inverses (each of them in parallel) ahead of the checks.
+    bb::constexpr_for<0, std::tuple_size_v<AvmFlavor::LookupRelations>, 1>([&]<size_t i>() {
+        using Relation = std::tuple_element_t<i, AvmFlavor::LookupRelations>;
+        bb::compute_logderivative_inverse<Flavor, Relation>(polys, params, num_rows);
+    });
+
+    // Add lookup/permutation checks.
     bb::constexpr_for<0, std::tuple_size_v<AvmFlavor::LookupRelations>, 1>([&]<size_t i>() {
         using Relation = std::tuple_element_t<i, AvmFlavor::LookupRelations>;
         checks.push_back([&, num_rows](SignalErrorFn signal_error) {
             // Check the logderivative relation
-            bb::compute_logderivative_inverse<Flavor, Relation>(polys, params, num_rows);
-
             typename Relation::SumcheckArrayOfValuesOverSubrelations lookup_result;
 
             for (auto& r : lookup_result) {
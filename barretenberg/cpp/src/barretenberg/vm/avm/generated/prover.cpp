@@ -74,18 +74,15 @@ void AvmProver::execute_log_derivative_inverse_round()
     relation_parameters.gamma = gamm;
 
     auto prover_polynomials = ProverPolynomials(*key);
-    std::vector<std::function<void()>> tasks;
 
+    // Each inverse is computed over chunks of rows in parallel, which balances the work better than one task per
+    // relation (the relations differ widely in how many rows they are active at)
     bb::constexpr_for<0, std::tuple_size_v<Flavor::LookupRelations>, 1>([&]<size_t relation_idx>() {
         using Relation = std::tuple_element_t<relation_idx, Flavor::LookupRelations>;
-        tasks.push_back([&]() {
-            AVM_TRACK_TIME(std::string("prove/execute_log_derivative_inverse_round/") + Relation::NAME,
-                           (compute_logderivative_inverse<Flavor, Relation>(
-                               prover_polynomials, relation_parameters, key->circuit_size)));
-        });
+        AVM_TRACK_TIME(std::string("prove/execute_log_derivative_inverse_round/") + Relation::NAME,
+                       (compute_logderivative_inverse<Flavor, Relation>(
+                           prover_polynomials, relation_parameters, key->circuit_size)));
     });
-
-    bb::parallel_for(tasks.size(), [&](size_t i) { tasks[i](); });
 }
 
 void AvmProver::execute_log_derivative_inverse_commitments_round()
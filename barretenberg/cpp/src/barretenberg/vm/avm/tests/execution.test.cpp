@@ -2447,4 +2447,15 @@ TEST_F(AvmExecutionTests, truncatedInstructionNoOperand)
     EXPECT_THROW_WITH_MESSAGE(Deserialization::parse(bytecode), "Operand is missing");
 }
 
+// Negative test detecting an instruction, not parsed from bytecode, with fewer operands than its opcode
+TEST_F(AvmExecutionTests, instructionWithMissingOperand)
+{
+    std::vector<Instruction> instructions = {
+        Instruction(OpCode::ADD, { static_cast<uint8_t>(0), AvmMemoryTag::U8, static_cast<uint32_t>(0), 1U }),
+        Instruction(OpCode::RETURN, { static_cast<uint8_t>(0), 0U, 0U }),
+    };
+
+    EXPECT_THROW_WITH_MESSAGE(Execution::gen_trace(instructions), "has 4 operands instead of 5");
+}
+
 } // namespace tests_avm
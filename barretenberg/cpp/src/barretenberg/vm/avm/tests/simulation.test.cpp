@@ -0,0 +1,334 @@
+#include "barretenberg/vm/avm/trace/execution.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "barretenberg/numeric/random/engine.hpp"
+#include "barretenberg/vm/avm/trace/common.hpp"
+#include "barretenberg/vm/avm/trace/instructions.hpp"
+#include "barretenberg/vm/avm/trace/opcode.hpp"
+#include "common.test.hpp"
+
+#include "barretenberg/vm/aztec_constants.hpp"
+
+namespace tests_avm {
+
+using namespace bb;
+using namespace bb::avm_trace;
+using namespace testing;
+
+namespace {
+
+auto& engine = numeric::get_debug_randomness();
+
+const std::vector<AvmMemoryTag> INT_TAGS = {
+    AvmMemoryTag::U8, AvmMemoryTag::U16, AvmMemoryTag::U32, AvmMemoryTag::U64, AvmMemoryTag::U128
+};
+
+Instruction set(AvmMemoryTag tag, uint128_t value, uint32_t dst_offset)
+{
+    Operand immediate;
+    switch (tag) {
+    case AvmMemoryTag::U8:
+        immediate = static_cast<uint8_t>(value);
+        break;
+    case AvmMemoryTag::U16:
+        immediate = static_cast<uint16_t>(value);
+        break;
+    case AvmMemoryTag::U32:
+        immediate = static_cast<uint32_t>(value);
+        break;
+    case AvmMemoryTag::U64:
+        immediate = static_cast<uint64_t>(value);
+        break;
+    default:
+        immediate = value;
+        break;
+    }
+    return Instruction(OpCode::SET, { static_cast<uint8_t>(0), tag, immediate, dst_offset });
+}
+
+Instruction binary_op(OpCode op_code, AvmMemoryTag tag, uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset)
+{
+    return Instruction(op_code, { static_cast<uint8_t>(0), tag, a_offset, b_offset, dst_offset });
+}
+
+Instruction unary_op(OpCode op_code, AvmMemoryTag tag, uint32_t a_offset, uint32_t dst_offset)
+{
+    return Instruction(op_code, { static_cast<uint8_t>(0), tag, a_offset, dst_offset });
+}
+
+Instruction ret(uint32_t offset, uint32_t size)
+{
+    return Instruction(OpCode::RETURN, { static_cast<uint8_t>(0), offset, size });
+}
+
+uint32_t tag_bits(AvmMemoryTag tag)
+{
+    switch (tag) {
+    case AvmMemoryTag::U8:
+        return 8;
+    case AvmMemoryTag::U16:
+        return 16;
+    case AvmMemoryTag::U32:
+        return 32;
+    case AvmMemoryTag::U64:
+        return 64;
+    default:
+        return 128;
+    }
+}
+
+uint128_t random_value(AvmMemoryTag tag)
+{
+    uint128_t value = engine.get_random_uint128();
+    return tag == AvmMemoryTag::U128 ? value : value & ((uint128_t(1) << tag_bits(tag)) - 1);
+}
+
+} // namespace
+
+class AvmSimulationTests : public ::testing::Test {
+  public:
+    std::vector<FF> public_inputs_vec;
+
+    AvmSimulationTests()
+        : public_inputs_vec(PUBLIC_CIRCUIT_PUBLIC_INPUTS_LENGTH){};
+
+  protected:
+    // TODO(640): The Standard Honk on Grumpkin test suite fails unless the SRS is initialised for every test.
+    void SetUp() override
+    {
+        srs::init_crs_factory("../srs_db/ignition");
+        public_inputs_vec.at(DA_START_GAS_LEFT_PCPI_OFFSET) = DEFAULT_INITIAL_DA_GAS;
+        public_inputs_vec.at(L2_START_GAS_LEFT_PCPI_OFFSET) = DEFAULT_INITIAL_L2_GAS;
+    };
+
+    /**
+     * @brief Run the instructions in simulation mode and check everything the simulation reports against a fully
+     *        generated trace: the return data, the remaining gas and the side effects in the kernel output columns.
+     */
+    ExecutionResult check_simulation(std::vector<Instruction> const& instructions, std::vector<FF> const& calldata = {})
+    {
+        auto simulated = Execution::simulate(instructions, calldata, public_inputs_vec);
+
+        std::vector<FF> returndata;
+        auto trace = Execution::gen_trace(instructions, returndata, calldata, public_inputs_vec);
+        EXPECT_EQ(simulated.returndata, returndata);
+
+        // The gas remaining after an instruction is set in the next row, so the last row with some gas left holds the
+        // gas left at the end of the execution.
+        auto last_gas_row = std::find_if(
+            trace.rbegin(), trace.rend(), [](Row const& row) { return !row.main_l2_gas_remaining.is_zero(); });
+        EXPECT_EQ(last_gas_row->main_l2_gas_remaining, FF(simulated.l2_gas_left));
+        EXPECT_EQ(last_gas_row->main_da_gas_remaining, FF(simulated.da_gas_left));
+
+        for (size_t i = 0; i < KERNEL_OUTPUTS_LENGTH; i++) {
+            EXPECT_EQ(trace.at(i).main_kernel_value_out, std::get<KERNEL_OUTPUTS_VALUE>(simulated.public_inputs).at(i));
+            EXPECT_EQ(trace.at(i).main_kernel_side_effect_out,
+                      std::get<KERNEL_OUTPUTS_SIDE_EFFECT_COUNTER>(simulated.public_inputs).at(i));
+            EXPECT_EQ(trace.at(i).main_kernel_metadata_out,
+                      std::get<KERNEL_OUTPUTS_METADATA>(simulated.public_inputs).at(i));
+        }
+
+        return simulated;
+    }
+};
+
+// All the integer ALU opcodes on random operands of every tag.
+TEST_F(AvmSimulationTests, aluOpcodesAllTags)
+{
+    for (const auto tag : INT_TAGS) {
+        for (size_t i = 0; i < 4; i++) {
+            const uint32_t num_bits = tag_bits(tag);
+            // Shift amounts cover both in-range and out-of-range shifts.
+            const auto shift = static_cast<uint128_t>(engine.get_random_uint8() % (2 * num_bits));
+            const AvmMemoryTag cast_tag = INT_TAGS[engine.get_random_uint8() % INT_TAGS.size()];
+
+            std::vector<Instruction> instructions = {
+                set(tag, random_value(tag), 0),
+                // Make the divisor nonzero half of the time only.
+                set(tag, i % 2 == 0 ? random_value(tag) | 1 : 0, 1),
+                set(tag, shift, 2),
+                binary_op(OpCode::ADD, tag, 0, 1, 10),
+                binary_op(OpCode::SUB, tag, 0, 1, 11),
+                binary_op(OpCode::MUL, tag, 0, 1, 12),
+                binary_op(OpCode::DIV, tag, 0, 1, 13),
+                binary_op(OpCode::EQ, tag, 0, 1, 14),
+                binary_op(OpCode::LT, tag, 0, 1, 15),
+                binary_op(OpCode::LTE, tag, 1, 0, 16),
+                binary_op(OpCode::AND, tag, 0, 1, 17),
+                binary_op(OpCode::OR, tag, 0, 1, 18),
+                binary_op(OpCode::XOR, tag, 0, 1, 19),
+                unary_op(OpCode::NOT, tag, 0, 20),
+                binary_op(OpCode::SHL, tag, 0, 2, 21),
+                binary_op(OpCode::SHR, tag, 0, 2, 22),
+                unary_op(OpCode::CAST, cast_tag, 0, 23),
+                ret(10, 14),
+            };
+            auto result = check_simulation(instructions);
+            EXPECT_EQ(result.returndata.size(), 14);
+        }
+    }
+}
+
+// Field arithmetic and comparisons on calldata.
+TEST_F(AvmSimulationTests, fieldOpcodes)
+{
+    std::vector<FF> calldata = { FF::random_element(), FF::random_element() };
+    std::vector<Instruction> instructions = {
+        Instruction(OpCode::CALLDATACOPY, { static_cast<uint8_t>(0), uint32_t(0), uint32_t(2), uint32_t(0) }),
+        binary_op(OpCode::ADD, AvmMemoryTag::FF, 0, 1, 10),
+        binary_op(OpCode::SUB, AvmMemoryTag::FF, 0, 1, 11),
+        binary_op(OpCode::MUL, AvmMemoryTag::FF, 0, 1, 12),
+        Instruction(OpCode::FDIV, { static_cast<uint8_t>(0), uint32_t(0), uint32_t(1), uint32_t(13) }),
+        binary_op(OpCode::EQ, AvmMemoryTag::FF, 0, 1, 14),
+        binary_op(OpCode::LT, AvmMemoryTag::FF, 0, 1, 15),
+        binary_op(OpCode::LTE, AvmMemoryTag::FF, 0, 0, 16),
+        unary_op(OpCode::CAST, AvmMemoryTag::U64, 0, 17),
+        ret(10, 8),
+    };
+    auto result = check_simulation(instructions, calldata);
+    EXPECT_EQ(result.returndata.at(0), calldata[0] + calldata[1]);
+    EXPECT_EQ(result.returndata.at(3), calldata[0] / calldata[1]);
+}
+
+// Tag mismatches and out-of-tag operands are errors that both modes must handle alike.
+TEST_F(AvmSimulationTests, tagErrors)
+{
+    std::vector<Instruction> instructions = {
+        set(AvmMemoryTag::U8, 200, 0),
+        set(AvmMemoryTag::U64, 300, 1),
+        binary_op(OpCode::ADD, AvmMemoryTag::U8, 0, 1, 10),
+        binary_op(OpCode::EQ, AvmMemoryTag::U64, 0, 1, 11),
+        binary_op(OpCode::XOR, AvmMemoryTag::U64, 0, 1, 12),
+        binary_op(OpCode::SHL, AvmMemoryTag::U8, 1, 0, 13),
+        ret(10, 4),
+    };
+    check_simulation(instructions);
+}
+
+// Long random sequences of ALU and memory opcodes over a small memory holding values of mixed tags, so that operands
+// of mismatching tags are frequent.
+TEST_F(AvmSimulationTests, randomPrograms)
+{
+    const std::vector<AvmMemoryTag> tags = {
+        AvmMemoryTag::U8, AvmMemoryTag::U16, AvmMemoryTag::U32, AvmMemoryTag::U64
+    };
+    const std::vector<OpCode> binary_op_codes = { OpCode::ADD, OpCode::SUB, OpCode::MUL, OpCode::DIV,
+                                                  OpCode::EQ,  OpCode::LT,  OpCode::LTE, OpCode::AND,
+                                                  OpCode::OR,  OpCode::XOR };
+    constexpr uint32_t MEM_SIZE = 16;
+
+    for (size_t program = 0; program < 4; program++) {
+        std::vector<Instruction> instructions;
+        for (uint32_t addr = 0; addr < MEM_SIZE; addr++) {
+            auto tag = tags[engine.get_random_uint8() % tags.size()];
+            instructions.push_back(set(tag, random_value(tag), addr));
+        }
+        for (size_t i = 0; i < 100; i++) {
+            auto tag = tags[engine.get_random_uint8() % tags.size()];
+            uint32_t a = engine.get_random_uint8() % MEM_SIZE;
+            uint32_t b = engine.get_random_uint8() % MEM_SIZE;
+            uint32_t dst = engine.get_random_uint8() % MEM_SIZE;
+            switch (engine.get_random_uint8() % 4) {
+            case 0:
+                instructions.push_back(unary_op(OpCode::NOT, tag, a, dst));
+                break;
+            case 1:
+                instructions.push_back(unary_op(OpCode::CAST, tag, a, dst));
+                break;
+            case 2:
+                instructions.push_back(Instruction(OpCode::MOV, { static_cast<uint8_t>(0), a, dst }));
+                break;
+            default:
+                instructions.push_back(
+                    binary_op(binary_op_codes[engine.get_random_uint8() % binary_op_codes.size()], tag, a, b, dst));
+                break;
+            }
+        }
+        instructions.push_back(ret(0, MEM_SIZE));
+        check_simulation(instructions);
+    }
+}
+
+// Jumps, conditional jumps, internal calls and conditional moves.
+TEST_F(AvmSimulationTests, controlFlow)
+{
+    // Counts down from 10 at address 0, accumulating in address 1, then calls a subroutine doubling address 1.
+    std::vector<Instruction> instructions = {
+        set(AvmMemoryTag::U32, 10, 0),
+        set(AvmMemoryTag::U32, 0, 1),
+        set(AvmMemoryTag::U32, 1, 2),
+        // Loop body at pc 3
+        binary_op(OpCode::ADD, AvmMemoryTag::U32, 1, 0, 1),
+        binary_op(OpCode::SUB, AvmMemoryTag::U32, 0, 2, 0),
+        Instruction(OpCode::JUMPI, { static_cast<uint8_t>(0), uint32_t(3), uint32_t(0) }),
+        Instruction(OpCode::INTERNALCALL, { uint32_t(11) }),
+        Instruction(OpCode::CMOV, { static_cast<uint8_t>(0), uint32_t(1), uint32_t(2), uint32_t(0), uint32_t(3) }),
+        Instruction(OpCode::CMOV, { static_cast<uint8_t>(0), uint32_t(1), uint32_t(2), uint32_t(2), uint32_t(4) }),
+        Instruction(OpCode::L2GASLEFT, { static_cast<uint8_t>(0), uint32_t(5) }),
+        Instruction(OpCode::JUMP, { uint32_t(13) }),
+        // Subroutine at pc 11
+        binary_op(OpCode::ADD, AvmMemoryTag::U32, 1, 1, 1),
+        Instruction(OpCode::INTERNALRETURN, {}),
+        Instruction(OpCode::DAGASLEFT, { static_cast<uint8_t>(0), uint32_t(6) }),
+        ret(0, 7),
+    };
+    auto result = check_simulation(instructions);
+    EXPECT_EQ(result.returndata.at(1), 110);
+    EXPECT_EQ(result.returndata.at(3), 1);
+    EXPECT_EQ(result.returndata.at(4), 110);
+}
+
+// Indirect memory accesses through pointers.
+TEST_F(AvmSimulationTests, indirectAccesses)
+{
+    std::vector<Instruction> instructions = {
+        set(AvmMemoryTag::U32, 20, 0),
+        set(AvmMemoryTag::U32, 21, 1),
+        set(AvmMemoryTag::U32, 22, 2),
+        set(AvmMemoryTag::U16, 1000, 20),
+        set(AvmMemoryTag::U16, 2345, 21),
+        Instruction(OpCode::ADD,
+                    { static_cast<uint8_t>(7), AvmMemoryTag::U16, uint32_t(0), uint32_t(1), uint32_t(2) }),
+        Instruction(OpCode::MOV, { static_cast<uint8_t>(1), uint32_t(2), uint32_t(23) }),
+        ret(20, 4),
+    };
+    auto result = check_simulation(instructions);
+    EXPECT_EQ(result.returndata.at(2), 3345);
+    EXPECT_EQ(result.returndata.at(3), 3345);
+}
+
+// Environment getters and side effects, which are reported through the public inputs.
+TEST_F(AvmSimulationTests, sideEffects)
+{
+    public_inputs_vec[SENDER_SELECTOR] = 1234;
+    std::vector<FF> calldata = { 42, 123, 9, 10 };
+    std::vector<Instruction> instructions = {
+        Instruction(OpCode::CALLDATACOPY, { static_cast<uint8_t>(0), uint32_t(0), uint32_t(4), uint32_t(1) }),
+        Instruction(OpCode::SENDER, { static_cast<uint8_t>(0), uint32_t(10) }),
+        Instruction(OpCode::EMITNOTEHASH, { static_cast<uint8_t>(0), uint32_t(1) }),
+        Instruction(OpCode::EMITNULLIFIER, { static_cast<uint8_t>(0), uint32_t(2) }),
+        Instruction(OpCode::SENDL2TOL1MSG, { static_cast<uint8_t>(0), uint32_t(3), uint32_t(4) }),
+        Instruction(OpCode::SSTORE, { static_cast<uint8_t>(0), uint32_t(1), uint32_t(1), uint32_t(3) }),
+        ret(10, 1),
+    };
+    auto result = check_simulation(instructions, calldata);
+    EXPECT_EQ(result.returndata.at(0), 1234);
+    EXPECT_EQ(std::get<KERNEL_OUTPUTS_VALUE>(result.public_inputs)[START_EMIT_NOTE_HASH_WRITE_OFFSET], 42);
+    EXPECT_EQ(std::get<KERNEL_OUTPUTS_VALUE>(result.public_inputs)[START_EMIT_NULLIFIER_WRITE_OFFSET], 123);
+}
+
+// Reverting returns the data like RETURN.
+TEST_F(AvmSimulationTests, revert)
+{
+    std::vector<Instruction> instructions = {
+        set(AvmMemoryTag::U64, 77, 0),
+        Instruction(OpCode::REVERT, { static_cast<uint8_t>(0), uint32_t(0), uint32_t(1) }),
+    };
+    auto result = check_simulation(instructions);
+    EXPECT_EQ(result.returndata, std::vector<FF>{ 77 });
+}
+
+} // namespace tests_avm
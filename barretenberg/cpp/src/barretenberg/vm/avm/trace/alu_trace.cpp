@@ -221,6 +221,10 @@ FF AvmAluTraceBuilder::op_add(FF const& a, FF const& b, AvmMemoryTag in_tag, uin
         }
     }
 
+    if (simulation_mode) {
+        return c;
+    }
+
     // The range checks are activated for all tags and therefore we need to call the slice register
     // routines also for tag FF with input 0.
     auto [u8_r0, u8_r1, u16_reg] = to_alu_slice_registers(in_tag == AvmMemoryTag::FF ? 0 : c_u128);
@@ -300,6 +304,10 @@ FF AvmAluTraceBuilder::op_sub(FF const& a, FF const& b, AvmMemoryTag in_tag, uin
         }
     }
 
+    if (simulation_mode) {
+        return c;
+    }
+
     // The range checks are activated for all tags and therefore we need to call the slice register
     // routines also for tag FF with input 0.
     auto [u8_r0, u8_r1, u16_reg] = to_alu_slice_registers(in_tag == AvmMemoryTag::FF ? 0 : c_u128);
@@ -364,6 +372,10 @@ FF AvmAluTraceBuilder::op_mul(FF const& a, FF const& b, AvmMemoryTag in_tag, uin
         c = FF{ static_cast<uint64_t>(c_u128) };
         break;
     case AvmMemoryTag::U128: {
+        if (simulation_mode) {
+            return FF{ uint256_t::from_uint128(c_u128) };
+        }
+
         uint256_t a_u256{ a };
         uint256_t b_u256{ b };
         uint256_t c_u256 = a_u256 * b_u256; // Multiplication over the integers (not mod. 2^128)
@@ -427,6 +439,10 @@ FF AvmAluTraceBuilder::op_mul(FF const& a, FF const& b, AvmMemoryTag in_tag, uin
         return FF{ 0 };
     }
 
+    if (simulation_mode) {
+        return c;
+    }
+
     // Following code executed for: u8, u16, u32, u64 (u128 returned handled specifically).
     // The range checks are activated for all tags and therefore we need to call the slice register
     // routines also for tag FF with input 0.
@@ -465,6 +481,10 @@ FF AvmAluTraceBuilder::op_div(FF const& a, FF const& b, AvmMemoryTag in_tag, uin
         return 0;
     }
 
+    if (simulation_mode) {
+        return c_u256;
+    }
+
     if (a_u256 < b_u256) {
         // If a < b, the result is trivially 0
         uint256_t rng_chk_lo = b_u256 - a_u256 - 1;
@@ -561,9 +581,14 @@ FF AvmAluTraceBuilder::op_div(FF const& a, FF const& b, AvmMemoryTag in_tag, uin
 FF AvmAluTraceBuilder::op_eq(FF const& a, FF const& b, AvmMemoryTag in_tag, uint32_t const clk)
 {
     FF c = a - b;
+    FF res = c == FF::zero() ? FF::one() : FF::zero();
+
+    if (simulation_mode) {
+        return res;
+    }
+
     // Don't invert 0 as it will throw
     FF inv_c = c != FF::zero() ? c.invert() : FF::zero();
-    FF res = c == FF::zero() ? FF::one() : FF::zero();
 
     alu_trace.push_back(AvmAluTraceBuilder::AluTraceEntry{
         .alu_clk = clk,
@@ -595,6 +620,10 @@ FF AvmAluTraceBuilder::op_lt(FF const& a, FF const& b, AvmMemoryTag in_tag, uint
 {
     bool c = uint256_t(a) < uint256_t(b);
 
+    if (simulation_mode) {
+        return FF{ static_cast<int>(c) };
+    }
+
     // Note: This is counter-intuitive, to show that a < b we actually show that b > a
     // The subtlety is here that the circuit is designed as a GT(x,y) circuit, therefore we swap the inputs a & b
     // Get the decomposition of b
@@ -646,6 +675,10 @@ FF AvmAluTraceBuilder::op_lte(FF const& a, FF const& b, AvmMemoryTag in_tag, uin
 {
     bool c = uint256_t(a) <= uint256_t(b);
 
+    if (simulation_mode) {
+        return FF{ static_cast<int>(c) };
+    }
+
     // Get the decomposition of a
     auto [a_lo, a_hi] = decompose(a, 128);
     // Get the decomposition of b
@@ -720,6 +753,10 @@ FF AvmAluTraceBuilder::op_not(FF const& a, AvmMemoryTag in_tag, uint32_t const c
         return FF{ 0 };
     }
 
+    if (simulation_mode) {
+        return c;
+    }
+
     alu_trace.push_back(AvmAluTraceBuilder::AluTraceEntry{
         .alu_clk = clk,
         .opcode = OpCode::NOT,
@@ -754,6 +791,11 @@ FF AvmAluTraceBuilder::op_shl(FF const& a, FF const& b, AvmMemoryTag in_tag, uin
     uint256_t c_u256 = a_u256 << b_u8;
 
     uint8_t num_bits = mem_tag_bits(in_tag);
+    if (simulation_mode) {
+        // The result truncated to num_bits, as done below per tag
+        return b_u8 >= num_bits ? FF(0) : FF(c_u256 & ((uint256_t(1) << num_bits) - 1));
+    }
+
     u8_pow_2_counters[0][b_u8]++;
     // If we are shifting more than the number of bits, the result is trivially 0
     if (b_u8 >= num_bits) {
@@ -853,6 +895,10 @@ FF AvmAluTraceBuilder::op_shr(FF const& a, FF const& b, AvmMemoryTag in_tag, uin
     uint256_t c_u256 = a_u256 >> b_u8;
 
     uint8_t num_bits = mem_tag_bits(in_tag);
+    if (simulation_mode) {
+        return b_u8 >= num_bits ? FF(0) : FF(c_u256);
+    }
+
     u8_pow_2_counters[0][b_u8]++;
 
     // If we are shifting more than the number of bits, the result is trivially 0
@@ -951,6 +997,10 @@ FF AvmAluTraceBuilder::op_cast(FF const& a, AvmMemoryTag in_tag, uint32_t clk)
         break;
     }
 
+    if (simulation_mode) {
+        return c;
+    }
+
     // Get the decomposition of a
     auto [a_lo, a_hi] = decompose(uint256_t(a), 128);
     // Decomposition of p-a
@@ -3,12 +3,12 @@
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include "barretenberg/vm/avm/generated/full_row.hpp"
 #include "barretenberg/vm/avm/trace/common.hpp"
+#include "barretenberg/vm/avm/trace/lookup_counts.hpp"
 #include "barretenberg/vm/avm/trace/opcode.hpp"
 
 #include <array>
 #include <cstdint>
 #include <optional>
-#include <unordered_map>
 #include <vector>
 
 namespace bb::avm_trace {
@@ -64,12 +64,14 @@ class AvmAluTraceBuilder {
         std::array<uint16_t, 8> div_u64_range_chk{};
     };
 
-    std::array<std::unordered_map<uint8_t, uint32_t>, 2> u8_range_chk_counters;
-    std::array<std::unordered_map<uint8_t, uint32_t>, 2> u8_pow_2_counters;
-    std::array<std::unordered_map<uint16_t, uint32_t>, 15> u16_range_chk_counters;
-    std::array<std::unordered_map<uint16_t, uint32_t>, 8> div_u64_range_chk_counters;
+    std::array<U8LookupCounts, 2> u8_range_chk_counters;
+    std::array<U8LookupCounts, 2> u8_pow_2_counters;
+    std::array<U16LookupCounts, 15> u16_range_chk_counters;
+    std::array<U16LookupCounts, 8> div_u64_range_chk_counters;
 
-    AvmAluTraceBuilder() = default;
+    explicit AvmAluTraceBuilder(bool simulation_mode = false)
+        : simulation_mode(simulation_mode)
+    {}
     size_t size() const { return alu_trace.size(); }
     void reset();
     void finalize(std::vector<AvmFullRow<FF>>& main_trace);
@@ -95,6 +97,8 @@ class AvmAluTraceBuilder {
 
   private:
     std::vector<AluTraceEntry> alu_trace;
+    // In simulation mode, only the results of the operations are computed (see AvmTraceBuilder)
+    bool simulation_mode = false;
     bool range_checked_required = false;
 
     template <typename T> std::tuple<uint8_t, uint8_t, std::array<uint16_t, 15>> to_alu_slice_registers(T a);
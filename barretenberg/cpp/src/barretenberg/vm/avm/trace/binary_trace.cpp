@@ -46,6 +46,10 @@ std::vector<uint8_t> bytes_decompose_le(uint128_t const& val)
 void AvmBinaryTraceBuilder::entry_builder(
     uint128_t const& a, uint128_t const& b, uint128_t const& c, AvmMemoryTag instr_tag, uint32_t clk, uint8_t op_id)
 {
+    if (simulation_mode) {
+        return;
+    }
+
     // Given the instruction tag, calculate the number of bytes to decompose values into
     // The number of rows for this entry will be number of bytes + 1
     size_t num_bytes = 1 << (static_cast<uint8_t>(instr_tag) - 1);
@@ -188,9 +192,8 @@ void AvmBinaryTraceBuilder::finalize(std::vector<AvmFullRow<FF>>& main_trace)
 
 void AvmBinaryTraceBuilder::finalize_lookups(std::vector<AvmFullRow<FF>>& main_trace)
 {
-    for (auto const& [clk, count] : byte_operation_counter) {
-        main_trace.at(clk).lookup_byte_operations_counts = count;
-    }
+    byte_operation_counter.for_each_nonzero(
+        [&](size_t clk, uint32_t count) { main_trace.at(clk).lookup_byte_operations_counts = count; });
 
     for (uint8_t avm_in_tag = 0; avm_in_tag < 5; avm_in_tag++) {
         // The +1 here is because the instruction tags we care about (i.e excl U0 and FF) has the range [1,5]
@@ -3,8 +3,7 @@
 #include "barretenberg/numeric/uint128/uint128.hpp"
 #include "barretenberg/vm/avm/generated/full_row.hpp"
 #include "barretenberg/vm/avm/trace/common.hpp"
-
-#include <unordered_map>
+#include "barretenberg/vm/avm/trace/lookup_counts.hpp"
 
 namespace bb::avm_trace {
 
@@ -29,10 +28,12 @@ class AvmBinaryTraceBuilder {
         uint8_t bin_ic_bytes = 0;
     };
 
-    std::unordered_map<uint32_t, uint32_t> byte_operation_counter;
-    std::unordered_map<uint32_t, uint32_t> byte_length_counter;
+    ByteOperationCounts byte_operation_counter;
+    LookupCounts<MAX_MEM_TAG + 1> byte_length_counter;
 
-    AvmBinaryTraceBuilder() = default;
+    explicit AvmBinaryTraceBuilder(bool simulation_mode = false)
+        : simulation_mode(simulation_mode)
+    {}
 
     size_t size() const { return binary_trace.size(); }
     void reset();
@@ -49,6 +50,8 @@ class AvmBinaryTraceBuilder {
 
   private:
     std::vector<BinaryTraceEntry> binary_trace;
+    // In simulation mode, only the results of the operations are computed (see AvmTraceBuilder)
+    bool simulation_mode = false;
     // Helper Function to build binary trace entries
     void entry_builder(uint128_t const& a,
                        uint128_t const& b,
@@ -184,6 +184,22 @@ const std::unordered_map<OperandType, size_t> OPERAND_TYPE_SIZE = {
 
 } // Anonymous namespace
 
+/**
+ * @brief The operand types of an opcode in the wire format, as specified in OPCODE_WIRE_FORMAT.
+ *
+ * @param opcode Any opcode but SET
+ * @throws runtime_error exception when the opcode has no wire format.
+ * @return The operand types, in wire order
+ */
+std::vector<OperandType> const& Deserialization::get_wire_format(OpCode opcode)
+{
+    auto const iter = OPCODE_WIRE_FORMAT.find(opcode);
+    if (iter == OPCODE_WIRE_FORMAT.end()) {
+        throw_or_abort("Opcode not found in OPCODE_WIRE_FORMAT: " + to_hex(opcode) + " name " + to_string(opcode));
+    }
+    return iter->second;
+}
+
 /**
  * @brief Parsing of the supplied bytecode into a vector of instructions. It essentially
  *        checks that each opcode value is in the defined range and extracts the operands
@@ -255,12 +271,7 @@ std::vector<Instruction> Deserialization::parse(std::vector<uint8_t> const& byte
                 throw_or_abort("Error processing wire format of SET opcode.");
             }
         } else {
-            auto const iter = OPCODE_WIRE_FORMAT.find(opcode);
-            if (iter == OPCODE_WIRE_FORMAT.end()) {
-                throw_or_abort("Opcode not found in OPCODE_WIRE_FORMAT: " + to_hex(opcode) + " name " +
-                               to_string(opcode));
-            }
-            inst_format = iter->second;
+            inst_format = get_wire_format(opcode);
         }
 
         std::vector<Operand> operands;
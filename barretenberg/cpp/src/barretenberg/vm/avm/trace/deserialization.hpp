@@ -18,6 +18,9 @@ class Deserialization {
     Deserialization() = default;
 
     static std::vector<Instruction> parse(std::vector<uint8_t> const& bytecode);
+
+    // The operand types of an opcode in the wire format (any opcode but SET, whose format depends on its tag)
+    static std::vector<OperandType> const& get_wire_format(OpCode opcode);
 };
 
 } // namespace bb::avm_trace
@@ -1,5 +1,6 @@
 #include "barretenberg/vm/avm/trace/execution.hpp"
 #include "barretenberg/bb/log.hpp"
+#include "barretenberg/common/log.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
@@ -17,6 +18,7 @@
 #include "barretenberg/vm/constants.hpp"
 #include "barretenberg/vm/stats.hpp"
 
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
@@ -81,6 +83,582 @@ std::unordered_map</*relation*/ std::string, /*degrees*/ std::string> get_relati
     return relations_degrees;
 }
 
+/**
+ * @brief An instruction with its operands unpacked from their variants, together with the handler executing it.
+ * @details The memory offsets and jump destinations of an instruction are its UINT32 operands, stored in wire order
+ * in `operands`. The struct fits in a cache line so that the dispatch loop walks a compact array.
+ */
+struct DecodedInstruction {
+    using Handler = void (*)(AvmTraceBuilder& trace_builder,
+                             DecodedInstruction const& inst,
+                             std::vector<FF>& returndata);
+
+    Handler handler = nullptr;
+    OpCode op_code = OpCode::LAST_OPCODE_SENTINEL;
+    uint8_t indirect = 0;
+    AvmMemoryTag tag = AvmMemoryTag::U0;
+    std::array<uint32_t, 8> operands{};
+    // Value of the SET opcode
+    uint128_t immediate = 0;
+};
+
+/**
+ * @brief Unpack the indirect flag, the tag and the UINT32 operands of an instruction (any instruction but SET), which
+ * must have as many operands as its opcode in the wire format.
+ */
+DecodedInstruction unpack_operands(Instruction const& inst)
+{
+    const size_t arity = Deserialization::get_wire_format(inst.op_code).size();
+    if (inst.operands.size() != arity) {
+        throw_or_abort("Instruction " + inst.to_string() + " has " + std::to_string(inst.operands.size()) +
+                       " operands instead of " + std::to_string(arity));
+    }
+
+    DecodedInstruction decoded;
+    decoded.op_code = inst.op_code;
+    size_t num_operands = 0;
+    for (size_t i = 0; i < inst.operands.size(); i++) {
+        const auto& operand = inst.operands[i];
+        if (i == 0 && std::holds_alternative<uint8_t>(operand)) {
+            decoded.indirect = std::get<uint8_t>(operand);
+        } else if (std::holds_alternative<AvmMemoryTag>(operand)) {
+            decoded.tag = std::get<AvmMemoryTag>(operand);
+        } else if (std::holds_alternative<uint32_t>(operand) && num_operands < decoded.operands.size()) {
+            decoded.operands[num_operands++] = std::get<uint32_t>(operand);
+        } else {
+            throw_or_abort("Unexpected operand " + std::to_string(i) + " in instruction " + inst.to_string());
+        }
+    }
+    return decoded;
+}
+
+/**
+ * @brief Unpack the operands of a SET instruction, whose value operand has the type of its tag.
+ */
+DecodedInstruction unpack_set_operands(Instruction const& inst)
+{
+    // Indirect flag, tag, value and destination offset
+    if (inst.operands.size() != 4) {
+        throw_or_abort("Instruction " + inst.to_string() + " has " + std::to_string(inst.operands.size()) +
+                       " operands instead of 4");
+    }
+
+    DecodedInstruction decoded;
+    decoded.op_code = inst.op_code;
+    decoded.indirect = std::get<uint8_t>(inst.operands.at(0));
+    decoded.tag = std::get<AvmMemoryTag>(inst.operands.at(1));
+    switch (decoded.tag) {
+    case AvmMemoryTag::U8:
+        decoded.immediate = std::get<uint8_t>(inst.operands.at(2));
+        break;
+    case AvmMemoryTag::U16:
+        decoded.immediate = std::get<uint16_t>(inst.operands.at(2));
+        break;
+    case AvmMemoryTag::U32:
+        decoded.immediate = std::get<uint32_t>(inst.operands.at(2));
+        break;
+    case AvmMemoryTag::U64:
+        decoded.immediate = std::get<uint64_t>(inst.operands.at(2));
+        break;
+    case AvmMemoryTag::U128:
+        decoded.immediate = std::get<uint128_t>(inst.operands.at(2));
+        break;
+    default:
+        break;
+    }
+    decoded.operands[0] = std::get<uint32_t>(inst.operands.at(3));
+    return decoded;
+}
+
+/**
+ * @brief Decode an instruction once, resolving its operands and the trace builder routine executing it, so that the
+ * execution loop does no variant access nor opcode switch per executed instruction.
+ */
+DecodedInstruction decode_instruction(Instruction const& inst)
+{
+    using ReturnData = std::vector<FF>;
+    DecodedInstruction decoded;
+
+    switch (inst.op_code) {
+        // Compute
+        // Compute - Arithmetic
+    case OpCode::ADD:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_add(i.indirect, i.operands[0], i.operands[1], i.operands[2], i.tag);
+        };
+        break;
+    case OpCode::SUB:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_sub(i.indirect, i.operands[0], i.operands[1], i.operands[2], i.tag);
+        };
+        break;
+    case OpCode::MUL:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_mul(i.indirect, i.operands[0], i.operands[1], i.operands[2], i.tag);
+        };
+        break;
+    case OpCode::DIV:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_div(i.indirect, i.operands[0], i.operands[1], i.operands[2], i.tag);
+        };
+        break;
+    case OpCode::FDIV:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_fdiv(i.indirect, i.operands[0], i.operands[1], i.operands[2]);
+        };
+        break;
+
+    // Compute - Comparators
+    case OpCode::EQ:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_eq(i.indirect, i.operands[0], i.operands[1], i.operands[2], i.tag);
+        };
+        break;
+    case OpCode::LT:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_lt(i.indirect, i.operands[0], i.operands[1], i.operands[2], i.tag);
+        };
+        break;
+    case OpCode::LTE:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_lte(i.indirect, i.operands[0], i.operands[1], i.operands[2], i.tag);
+        };
+        break;
+
+    // Compute - Bitwise
+    case OpCode::AND:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_and(i.indirect, i.operands[0], i.operands[1], i.operands[2], i.tag);
+        };
+        break;
+    case OpCode::OR:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_or(i.indirect, i.operands[0], i.operands[1], i.operands[2], i.tag);
+        };
+        break;
+    case OpCode::XOR:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_xor(i.indirect, i.operands[0], i.operands[1], i.operands[2], i.tag);
+        };
+        break;
+    case OpCode::NOT:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_not(i.indirect, i.operands[0], i.operands[1], i.tag);
+        };
+        break;
+    case OpCode::SHL:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_shl(i.indirect, i.operands[0], i.operands[1], i.operands[2], i.tag);
+        };
+        break;
+    case OpCode::SHR:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_shr(i.indirect, i.operands[0], i.operands[1], i.operands[2], i.tag);
+        };
+        break;
+
+        // Compute - Type Conversions
+    case OpCode::CAST:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_cast(i.indirect, i.operands[0], i.operands[1], i.tag);
+        };
+        break;
+
+        // Execution Environment
+        // TODO(https://github.com/AztecProtocol/aztec-packages/issues/6284): support indirect for below
+    case OpCode::ADDRESS:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_address(i.indirect, i.operands[0]);
+        };
+        break;
+    case OpCode::STORAGEADDRESS:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_storage_address(i.indirect, i.operands[0]);
+        };
+        break;
+    case OpCode::SENDER:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_sender(i.indirect, i.operands[0]);
+        };
+        break;
+    case OpCode::FUNCTIONSELECTOR:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_function_selector(i.indirect, i.operands[0]);
+        };
+        break;
+    case OpCode::TRANSACTIONFEE:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_transaction_fee(i.indirect, i.operands[0]);
+        };
+        break;
+
+        // Execution Environment - Globals
+    case OpCode::CHAINID:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_chain_id(i.indirect, i.operands[0]);
+        };
+        break;
+    case OpCode::VERSION:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_version(i.indirect, i.operands[0]);
+        };
+        break;
+    case OpCode::BLOCKNUMBER:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_block_number(i.indirect, i.operands[0]);
+        };
+        break;
+    case OpCode::TIMESTAMP:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_timestamp(i.indirect, i.operands[0]);
+        };
+        break;
+    case OpCode::COINBASE:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_coinbase(i.indirect, i.operands[0]);
+        };
+        break;
+    case OpCode::FEEPERL2GAS:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_fee_per_l2_gas(i.indirect, i.operands[0]);
+        };
+        break;
+    case OpCode::FEEPERDAGAS:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_fee_per_da_gas(i.indirect, i.operands[0]);
+        };
+        break;
+
+        // Execution Environment - Calldata
+    case OpCode::CALLDATACOPY:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_calldata_copy(i.indirect, i.operands[0], i.operands[1], i.operands[2]);
+        };
+        break;
+
+        // Machine State - Gas
+    case OpCode::L2GASLEFT:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_l2gasleft(i.indirect, i.operands[0]);
+        };
+        break;
+    case OpCode::DAGASLEFT:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_dagasleft(i.indirect, i.operands[0]);
+        };
+        break;
+
+        // Machine State - Internal Control Flow
+    case OpCode::JUMP:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_jump(i.operands[0]);
+        };
+        break;
+    case OpCode::JUMPI:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_jumpi(i.indirect, i.operands[0], i.operands[1]);
+        };
+        break;
+    case OpCode::INTERNALCALL:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_internal_call(i.operands[0]);
+        };
+        break;
+    case OpCode::INTERNALRETURN:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const&, ReturnData&) {
+            trace_builder.op_internal_return();
+        };
+        break;
+
+        // Machine State - Memory
+    case OpCode::SET:
+        decoded = unpack_set_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_set(i.indirect, i.immediate, i.operands[0], i.tag);
+        };
+        break;
+    case OpCode::MOV:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_mov(i.indirect, i.operands[0], i.operands[1]);
+        };
+        break;
+    case OpCode::CMOV:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_cmov(i.indirect, i.operands[0], i.operands[1], i.operands[2], i.operands[3]);
+        };
+        break;
+
+        // World State
+    case OpCode::SLOAD:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_sload(i.indirect, i.operands[0], i.operands[1], i.operands[2]);
+        };
+        break;
+    case OpCode::SSTORE:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_sstore(i.indirect, i.operands[0], i.operands[1], i.operands[2]);
+        };
+        break;
+    case OpCode::NOTEHASHEXISTS:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            // TODO: leaf offset exists (i.operands[1])
+            trace_builder.op_note_hash_exists(i.indirect, i.operands[0], i.operands[2]);
+        };
+        break;
+    case OpCode::EMITNOTEHASH:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_emit_note_hash(i.indirect, i.operands[0]);
+        };
+        break;
+    case OpCode::NULLIFIEREXISTS:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            // TODO: Address offset for siloing (i.operands[1])
+            trace_builder.op_nullifier_exists(i.indirect, i.operands[0], i.operands[2]);
+        };
+        break;
+    case OpCode::EMITNULLIFIER:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_emit_nullifier(i.indirect, i.operands[0]);
+        };
+        break;
+
+    case OpCode::L1TOL2MSGEXISTS:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            // TODO: leaf offset exists (i.operands[1])
+            trace_builder.op_l1_to_l2_msg_exists(i.indirect, i.operands[0], i.operands[2]);
+        };
+        break;
+    case OpCode::GETCONTRACTINSTANCE:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_get_contract_instance(i.indirect, i.operands[0], i.operands[1]);
+        };
+        break;
+
+        // Accrued Substate
+    case OpCode::EMITUNENCRYPTEDLOG:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_emit_unencrypted_log(i.indirect, i.operands[0], i.operands[1]);
+        };
+        break;
+    case OpCode::SENDL2TOL1MSG:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_emit_l2_to_l1_msg(i.indirect, i.operands[0], i.operands[1]);
+        };
+        break;
+
+        // Control Flow - Contract Calls
+    case OpCode::CALL:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_call(i.indirect,
+                                  i.operands[0],
+                                  i.operands[1],
+                                  i.operands[2],
+                                  i.operands[3],
+                                  i.operands[4],
+                                  i.operands[5],
+                                  i.operands[6],
+                                  i.operands[7]);
+        };
+        break;
+    case OpCode::RETURN:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData& returndata) {
+            auto ret = trace_builder.op_return(i.indirect, i.operands[0], i.operands[1]);
+            returndata.insert(returndata.end(), ret.begin(), ret.end());
+        };
+        break;
+    case OpCode::REVERT:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData& returndata) {
+            auto ret = trace_builder.op_revert(i.indirect, i.operands[0], i.operands[1]);
+            returndata.insert(returndata.end(), ret.begin(), ret.end());
+        };
+        break;
+
+        // Misc
+    case OpCode::DEBUGLOG:
+        decoded.op_code = inst.op_code;
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const&, ReturnData&) {
+            // We want a noop, but we need to execute something that both advances the PC,
+            // and adds a valid row to the trace.
+            trace_builder.op_jump(trace_builder.getPc() + 1);
+        };
+        break;
+
+        // Gadgets
+    case OpCode::KECCAK:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_keccak(i.indirect, i.operands[0], i.operands[1], i.operands[2]);
+        };
+        break;
+    case OpCode::POSEIDON2:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_poseidon2_permutation(i.indirect, i.operands[0], i.operands[1]);
+        };
+        break;
+    case OpCode::SHA256:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_sha256(i.indirect, i.operands[0], i.operands[1], i.operands[2]);
+        };
+        break;
+    case OpCode::PEDERSEN:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_pedersen_hash(i.indirect, i.operands[0], i.operands[1], i.operands[2], i.operands[3]);
+        };
+        break;
+    case OpCode::ECADD:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_ec_add(i.indirect,
+                                    i.operands[0],
+                                    i.operands[1],
+                                    i.operands[2],
+                                    i.operands[3],
+                                    i.operands[4],
+                                    i.operands[5],
+                                    i.operands[6]);
+        };
+        break;
+    case OpCode::MSM:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_variable_msm(i.indirect, i.operands[0], i.operands[1], i.operands[2], i.operands[3]);
+        };
+        break;
+
+        // Conversions
+    case OpCode::TORADIXLE:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_to_radix_le(i.indirect, i.operands[0], i.operands[1], i.operands[2], i.operands[3]);
+        };
+        break;
+
+        // Future Gadgets -- pending changes in noir
+    case OpCode::SHA256COMPRESSION:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_sha256_compression(i.indirect, i.operands[0], i.operands[1], i.operands[2]);
+        };
+        break;
+
+    case OpCode::KECCAKF1600:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_keccakf1600(i.indirect, i.operands[0], i.operands[1], i.operands[2]);
+        };
+        break;
+    case OpCode::PEDERSENCOMMITMENT:
+        decoded = unpack_operands(inst);
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            trace_builder.op_pedersen_commit(i.indirect, i.operands[0], i.operands[1], i.operands[2], i.operands[3]);
+        };
+        break;
+    default:
+        // Unknown opcodes only fail if they are reached by the execution.
+        decoded.op_code = inst.op_code;
+        decoded.handler = [](AvmTraceBuilder& trace_builder, DecodedInstruction const& i, ReturnData&) {
+            throw_or_abort("Don't know how to execute opcode " + to_hex(i.op_code) + " at pc " +
+                           std::to_string(trace_builder.getPc()) + ".");
+        };
+        break;
+    }
+
+    return decoded;
+}
+
+/**
+ * @brief Decode a whole program. Entry i of the result is the decoded instruction at pc i.
+ */
+std::vector<DecodedInstruction> decode(std::vector<Instruction> const& instructions)
+{
+    std::vector<DecodedInstruction> program;
+    program.reserve(instructions.size());
+    for (const auto& inst : instructions) {
+        program.push_back(decode_instruction(inst));
+    }
+    return program;
+}
+
+/**
+ * @brief Run the instructions with the supplied trace builder, appending the returned data to returndata.
+ */
+void execute(AvmTraceBuilder& trace_builder, std::vector<Instruction> const& instructions, std::vector<FF>& returndata)
+{
+    // Copied version of pc maintained in trace builder. The value of pc is evolving based
+    // on opcode logic and therefore is not maintained here. However, the next opcode in the execution
+    // is determined by this value which require read access to the code below.
+    const auto program = decode(instructions);
+    uint32_t pc = 0;
+    while ((pc = trace_builder.getPc()) < program.size()) {
+        if (debug_logging) {
+            debug("[@" + std::to_string(pc) + "] " + instructions[pc].to_string());
+        }
+        const DecodedInstruction& inst = program[pc];
+        inst.handler(trace_builder, inst, returndata);
+    }
+}
+
+/**
+ * @brief The side effect counter at the start of the execution, as given by the public inputs (0 if there are none).
+ */
+uint32_t start_side_effect_counter(std::vector<FF> const& public_inputs_vec)
+{
+    return !public_inputs_vec.empty() ? static_cast<uint32_t>(public_inputs_vec[PCPI_START_SIDE_EFFECT_COUNTER_OFFSET])
+                                      : 0;
+}
+
 } // namespace
 
 /**
@@ -157,6 +735,34 @@ std::tuple<AvmFlavor::VerificationKey, HonkProof> Execution::prove(std::vector<u
     return std::make_tuple(*verifier.key, proof);
 }
 
+/**
+ * @brief Execute the supplied instructions without generating any trace, e.g., to estimate fees or to pre-check an
+ *        execution before proving it. The opcodes are run by the same trace builder routines as in gen_trace, in
+ *        simulation mode.
+ *
+ * @param instructions A vector of the instructions to be executed.
+ * @param calldata expressed as a vector of finite field elements.
+ * @param public_inputs expressed as a vector of finite field elements.
+ * @return The return data, remaining gas and side effects of the execution.
+ */
+ExecutionResult Execution::simulate(std::vector<Instruction> const& instructions,
+                                    std::vector<FF> const& calldata,
+                                    std::vector<FF> const& public_inputs_vec,
+                                    ExecutionHints const& execution_hints)
+{
+    AvmTraceBuilder trace_builder(convert_public_inputs(public_inputs_vec),
+                                  execution_hints,
+                                  start_side_effect_counter(public_inputs_vec),
+                                  calldata,
+                                  /*simulation_mode=*/true);
+    ExecutionResult result;
+    execute(trace_builder, instructions, result.returndata);
+    result.l2_gas_left = trace_builder.get_l2_gas_left();
+    result.da_gas_left = trace_builder.get_da_gas_left();
+    result.public_inputs = trace_builder.get_public_inputs();
+    return result;
+}
+
 /**
  * @brief Generate the execution trace pertaining to the supplied instructions.
  *
@@ -386,434 +992,9 @@ std::vector<Row> Execution::gen_trace(std::vector<Instruction> const& instructio
     // TODO(https://github.com/AztecProtocol/aztec-packages/issues/6718): construction of the public input columns
     // should be done in the kernel - this is stubbed and underconstrained
     VmPublicInputs public_inputs = convert_public_inputs(public_inputs_vec);
-    uint32_t start_side_effect_counter =
-        !public_inputs_vec.empty() ? static_cast<uint32_t>(public_inputs_vec[PCPI_START_SIDE_EFFECT_COUNTER_OFFSET])
-                                   : 0;
-    AvmTraceBuilder trace_builder(public_inputs, execution_hints, start_side_effect_counter, calldata);
-
-    // Copied version of pc maintained in trace builder. The value of pc is evolving based
-    // on opcode logic and therefore is not maintained here. However, the next opcode in the execution
-    // is determined by this value which require read access to the code below.
-    uint32_t pc = 0;
-    while ((pc = trace_builder.getPc()) < instructions.size()) {
-        auto inst = instructions.at(pc);
-        debug("[@" + std::to_string(pc) + "] " + inst.to_string());
-
-        // TODO: We do not yet support the indirect flag. Therefore we do not extract
-        // inst.operands(0) (i.e. the indirect flag) when processiing the instructions.
-        switch (inst.op_code) {
-            // Compute
-            // Compute - Arithmetic
-        case OpCode::ADD:
-            trace_builder.op_add(std::get<uint8_t>(inst.operands.at(0)),
-                                 std::get<uint32_t>(inst.operands.at(2)),
-                                 std::get<uint32_t>(inst.operands.at(3)),
-                                 std::get<uint32_t>(inst.operands.at(4)),
-                                 std::get<AvmMemoryTag>(inst.operands.at(1)));
-            break;
-        case OpCode::SUB:
-            trace_builder.op_sub(std::get<uint8_t>(inst.operands.at(0)),
-                                 std::get<uint32_t>(inst.operands.at(2)),
-                                 std::get<uint32_t>(inst.operands.at(3)),
-                                 std::get<uint32_t>(inst.operands.at(4)),
-                                 std::get<AvmMemoryTag>(inst.operands.at(1)));
-            break;
-        case OpCode::MUL:
-            trace_builder.op_mul(std::get<uint8_t>(inst.operands.at(0)),
-                                 std::get<uint32_t>(inst.operands.at(2)),
-                                 std::get<uint32_t>(inst.operands.at(3)),
-                                 std::get<uint32_t>(inst.operands.at(4)),
-                                 std::get<AvmMemoryTag>(inst.operands.at(1)));
-            break;
-        case OpCode::DIV:
-            trace_builder.op_div(std::get<uint8_t>(inst.operands.at(0)),
-                                 std::get<uint32_t>(inst.operands.at(2)),
-                                 std::get<uint32_t>(inst.operands.at(3)),
-                                 std::get<uint32_t>(inst.operands.at(4)),
-                                 std::get<AvmMemoryTag>(inst.operands.at(1)));
-            break;
-        case OpCode::FDIV:
-            trace_builder.op_fdiv(std::get<uint8_t>(inst.operands.at(0)),
-                                  std::get<uint32_t>(inst.operands.at(1)),
-                                  std::get<uint32_t>(inst.operands.at(2)),
-                                  std::get<uint32_t>(inst.operands.at(3)));
-            break;
-
-        // Compute - Comparators
-        case OpCode::EQ:
-            trace_builder.op_eq(std::get<uint8_t>(inst.operands.at(0)),
-                                std::get<uint32_t>(inst.operands.at(2)),
-                                std::get<uint32_t>(inst.operands.at(3)),
-                                std::get<uint32_t>(inst.operands.at(4)),
-                                std::get<AvmMemoryTag>(inst.operands.at(1)));
-            break;
-        case OpCode::LT:
-            trace_builder.op_lt(std::get<uint8_t>(inst.operands.at(0)),
-                                std::get<uint32_t>(inst.operands.at(2)),
-                                std::get<uint32_t>(inst.operands.at(3)),
-                                std::get<uint32_t>(inst.operands.at(4)),
-                                std::get<AvmMemoryTag>(inst.operands.at(1)));
-            break;
-        case OpCode::LTE:
-            trace_builder.op_lte(std::get<uint8_t>(inst.operands.at(0)),
-                                 std::get<uint32_t>(inst.operands.at(2)),
-                                 std::get<uint32_t>(inst.operands.at(3)),
-                                 std::get<uint32_t>(inst.operands.at(4)),
-                                 std::get<AvmMemoryTag>(inst.operands.at(1)));
-            break;
-
-        // Compute - Bitwise
-        case OpCode::AND:
-            trace_builder.op_and(std::get<uint8_t>(inst.operands.at(0)),
-                                 std::get<uint32_t>(inst.operands.at(2)),
-                                 std::get<uint32_t>(inst.operands.at(3)),
-                                 std::get<uint32_t>(inst.operands.at(4)),
-                                 std::get<AvmMemoryTag>(inst.operands.at(1)));
-            break;
-        case OpCode::OR:
-            trace_builder.op_or(std::get<uint8_t>(inst.operands.at(0)),
-                                std::get<uint32_t>(inst.operands.at(2)),
-                                std::get<uint32_t>(inst.operands.at(3)),
-                                std::get<uint32_t>(inst.operands.at(4)),
-                                std::get<AvmMemoryTag>(inst.operands.at(1)));
-            break;
-        case OpCode::XOR:
-            trace_builder.op_xor(std::get<uint8_t>(inst.operands.at(0)),
-                                 std::get<uint32_t>(inst.operands.at(2)),
-                                 std::get<uint32_t>(inst.operands.at(3)),
-                                 std::get<uint32_t>(inst.operands.at(4)),
-                                 std::get<AvmMemoryTag>(inst.operands.at(1)));
-            break;
-        case OpCode::NOT:
-            trace_builder.op_not(std::get<uint8_t>(inst.operands.at(0)),
-                                 std::get<uint32_t>(inst.operands.at(2)),
-                                 std::get<uint32_t>(inst.operands.at(3)),
-                                 std::get<AvmMemoryTag>(inst.operands.at(1)));
-            break;
-        case OpCode::SHL:
-            trace_builder.op_shl(std::get<uint8_t>(inst.operands.at(0)),
-                                 std::get<uint32_t>(inst.operands.at(2)),
-                                 std::get<uint32_t>(inst.operands.at(3)),
-                                 std::get<uint32_t>(inst.operands.at(4)),
-                                 std::get<AvmMemoryTag>(inst.operands.at(1)));
-            break;
-        case OpCode::SHR:
-            trace_builder.op_shr(std::get<uint8_t>(inst.operands.at(0)),
-                                 std::get<uint32_t>(inst.operands.at(2)),
-                                 std::get<uint32_t>(inst.operands.at(3)),
-                                 std::get<uint32_t>(inst.operands.at(4)),
-                                 std::get<AvmMemoryTag>(inst.operands.at(1)));
-            break;
-
-            // Compute - Type Conversions
-        case OpCode::CAST:
-            trace_builder.op_cast(std::get<uint8_t>(inst.operands.at(0)),
-                                  std::get<uint32_t>(inst.operands.at(2)),
-                                  std::get<uint32_t>(inst.operands.at(3)),
-                                  std::get<AvmMemoryTag>(inst.operands.at(1)));
-            break;
-
-            // Execution Environment
-            // TODO(https://github.com/AztecProtocol/aztec-packages/issues/6284): support indirect for below
-        case OpCode::ADDRESS:
-            trace_builder.op_address(std::get<uint8_t>(inst.operands.at(0)), std::get<uint32_t>(inst.operands.at(1)));
-            break;
-        case OpCode::STORAGEADDRESS:
-            trace_builder.op_storage_address(std::get<uint8_t>(inst.operands.at(0)),
-                                             std::get<uint32_t>(inst.operands.at(1)));
-            break;
-        case OpCode::SENDER:
-            trace_builder.op_sender(std::get<uint8_t>(inst.operands.at(0)), std::get<uint32_t>(inst.operands.at(1)));
-            break;
-        case OpCode::FUNCTIONSELECTOR:
-            trace_builder.op_function_selector(std::get<uint8_t>(inst.operands.at(0)),
-                                               std::get<uint32_t>(inst.operands.at(1)));
-            break;
-        case OpCode::TRANSACTIONFEE:
-            trace_builder.op_transaction_fee(std::get<uint8_t>(inst.operands.at(0)),
-                                             std::get<uint32_t>(inst.operands.at(1)));
-            break;
-
-            // Execution Environment - Globals
-        case OpCode::CHAINID:
-            trace_builder.op_chain_id(std::get<uint8_t>(inst.operands.at(0)), std::get<uint32_t>(inst.operands.at(1)));
-            break;
-        case OpCode::VERSION:
-            trace_builder.op_version(std::get<uint8_t>(inst.operands.at(0)), std::get<uint32_t>(inst.operands.at(1)));
-            break;
-        case OpCode::BLOCKNUMBER:
-            trace_builder.op_block_number(std::get<uint8_t>(inst.operands.at(0)),
-                                          std::get<uint32_t>(inst.operands.at(1)));
-            break;
-        case OpCode::TIMESTAMP:
-            trace_builder.op_timestamp(std::get<uint8_t>(inst.operands.at(0)), std::get<uint32_t>(inst.operands.at(1)));
-            break;
-        case OpCode::COINBASE:
-            trace_builder.op_coinbase(std::get<uint8_t>(inst.operands.at(0)), std::get<uint32_t>(inst.operands.at(1)));
-            break;
-        case OpCode::FEEPERL2GAS:
-            trace_builder.op_fee_per_l2_gas(std::get<uint8_t>(inst.operands.at(0)),
-                                            std::get<uint32_t>(inst.operands.at(1)));
-            break;
-        case OpCode::FEEPERDAGAS:
-            trace_builder.op_fee_per_da_gas(std::get<uint8_t>(inst.operands.at(0)),
-                                            std::get<uint32_t>(inst.operands.at(1)));
-            break;
-
-            // Execution Environment - Calldata
-        case OpCode::CALLDATACOPY:
-            trace_builder.op_calldata_copy(std::get<uint8_t>(inst.operands.at(0)),
-                                           std::get<uint32_t>(inst.operands.at(1)),
-                                           std::get<uint32_t>(inst.operands.at(2)),
-                                           std::get<uint32_t>(inst.operands.at(3)));
-            break;
-
-            // Machine State - Gas
-        case OpCode::L2GASLEFT:
-            trace_builder.op_l2gasleft(std::get<uint8_t>(inst.operands.at(0)), std::get<uint32_t>(inst.operands.at(1)));
-            break;
-        case OpCode::DAGASLEFT:
-            trace_builder.op_dagasleft(std::get<uint8_t>(inst.operands.at(0)), std::get<uint32_t>(inst.operands.at(1)));
-            break;
-
-            // Machine State - Internal Control Flow
-        case OpCode::JUMP:
-            trace_builder.op_jump(std::get<uint32_t>(inst.operands.at(0)));
-            break;
-        case OpCode::JUMPI:
-            trace_builder.op_jumpi(std::get<uint8_t>(inst.operands.at(0)),
-                                   std::get<uint32_t>(inst.operands.at(1)),
-                                   std::get<uint32_t>(inst.operands.at(2)));
-            break;
-        case OpCode::INTERNALCALL:
-            trace_builder.op_internal_call(std::get<uint32_t>(inst.operands.at(0)));
-            break;
-        case OpCode::INTERNALRETURN:
-            trace_builder.op_internal_return();
-            break;
-
-            // Machine State - Memory
-        case OpCode::SET: {
-            uint128_t val = 0;
-            AvmMemoryTag in_tag = std::get<AvmMemoryTag>(inst.operands.at(1));
-
-            switch (in_tag) {
-            case AvmMemoryTag::U8:
-                val = std::get<uint8_t>(inst.operands.at(2));
-                break;
-            case AvmMemoryTag::U16:
-                val = std::get<uint16_t>(inst.operands.at(2));
-                break;
-            case AvmMemoryTag::U32:
-                val = std::get<uint32_t>(inst.operands.at(2));
-                break;
-            case AvmMemoryTag::U64:
-                val = std::get<uint64_t>(inst.operands.at(2));
-                break;
-            case AvmMemoryTag::U128:
-                val = std::get<uint128_t>(inst.operands.at(2));
-                break;
-            default:
-                break;
-            }
-
-            trace_builder.op_set(
-                std::get<uint8_t>(inst.operands.at(0)), val, std::get<uint32_t>(inst.operands.at(3)), in_tag);
-            break;
-        }
-        case OpCode::MOV:
-            trace_builder.op_mov(std::get<uint8_t>(inst.operands.at(0)),
-                                 std::get<uint32_t>(inst.operands.at(1)),
-                                 std::get<uint32_t>(inst.operands.at(2)));
-            break;
-        case OpCode::CMOV:
-            trace_builder.op_cmov(std::get<uint8_t>(inst.operands.at(0)),
-                                  std::get<uint32_t>(inst.operands.at(1)),
-                                  std::get<uint32_t>(inst.operands.at(2)),
-                                  std::get<uint32_t>(inst.operands.at(3)),
-                                  std::get<uint32_t>(inst.operands.at(4)));
-            break;
-
-            // World State
-        case OpCode::SLOAD:
-            trace_builder.op_sload(std::get<uint8_t>(inst.operands.at(0)),
-                                   std::get<uint32_t>(inst.operands.at(1)),
-                                   std::get<uint32_t>(inst.operands.at(2)),
-                                   std::get<uint32_t>(inst.operands.at(3)));
-            break;
-        case OpCode::SSTORE:
-            trace_builder.op_sstore(std::get<uint8_t>(inst.operands.at(0)),
-                                    std::get<uint32_t>(inst.operands.at(1)),
-                                    std::get<uint32_t>(inst.operands.at(2)),
-                                    std::get<uint32_t>(inst.operands.at(3)));
-            break;
-        case OpCode::NOTEHASHEXISTS:
-            trace_builder.op_note_hash_exists(std::get<uint8_t>(inst.operands.at(0)),
-                                              std::get<uint32_t>(inst.operands.at(1)),
-                                              // TODO: leaf offset exists
-                                              // std::get<uint32_t>(inst.operands.at(2))
-                                              std::get<uint32_t>(inst.operands.at(3)));
-            break;
-        case OpCode::EMITNOTEHASH:
-            trace_builder.op_emit_note_hash(std::get<uint8_t>(inst.operands.at(0)),
-                                            std::get<uint32_t>(inst.operands.at(1)));
-            break;
-        case OpCode::NULLIFIEREXISTS:
-            trace_builder.op_nullifier_exists(std::get<uint8_t>(inst.operands.at(0)),
-                                              std::get<uint32_t>(inst.operands.at(1)),
-                                              // std::get<uint32_t>(inst.operands.at(2))
-                                              /**TODO: Address offset for siloing */
-                                              std::get<uint32_t>(inst.operands.at(3)));
-            break;
-        case OpCode::EMITNULLIFIER:
-            trace_builder.op_emit_nullifier(std::get<uint8_t>(inst.operands.at(0)),
-                                            std::get<uint32_t>(inst.operands.at(1)));
-            break;
-
-        case OpCode::L1TOL2MSGEXISTS:
-            trace_builder.op_l1_to_l2_msg_exists(std::get<uint8_t>(inst.operands.at(0)),
-                                                 std::get<uint32_t>(inst.operands.at(1)),
-                                                 // TODO: leaf offset exists
-                                                 // std::get<uint32_t>(inst.operands.at(2))
-                                                 std::get<uint32_t>(inst.operands.at(3)));
-            break;
-        case OpCode::GETCONTRACTINSTANCE:
-            trace_builder.op_get_contract_instance(std::get<uint8_t>(inst.operands.at(0)),
-                                                   std::get<uint32_t>(inst.operands.at(1)),
-                                                   std::get<uint32_t>(inst.operands.at(2)));
-            break;
-
-            // Accrued Substate
-        case OpCode::EMITUNENCRYPTEDLOG:
-            trace_builder.op_emit_unencrypted_log(std::get<uint8_t>(inst.operands.at(0)),
-                                                  std::get<uint32_t>(inst.operands.at(1)),
-                                                  std::get<uint32_t>(inst.operands.at(2)));
-            break;
-        case OpCode::SENDL2TOL1MSG:
-            trace_builder.op_emit_l2_to_l1_msg(std::get<uint8_t>(inst.operands.at(0)),
-                                               std::get<uint32_t>(inst.operands.at(1)),
-                                               std::get<uint32_t>(inst.operands.at(2)));
-            break;
-
-            // Control Flow - Contract Calls
-        case OpCode::CALL:
-            trace_builder.op_call(std::get<uint8_t>(inst.operands.at(0)),
-                                  std::get<uint32_t>(inst.operands.at(1)),
-                                  std::get<uint32_t>(inst.operands.at(2)),
-                                  std::get<uint32_t>(inst.operands.at(3)),
-                                  std::get<uint32_t>(inst.operands.at(4)),
-                                  std::get<uint32_t>(inst.operands.at(5)),
-                                  std::get<uint32_t>(inst.operands.at(6)),
-                                  std::get<uint32_t>(inst.operands.at(7)),
-                                  std::get<uint32_t>(inst.operands.at(8)));
-            break;
-        case OpCode::RETURN: {
-            auto ret = trace_builder.op_return(std::get<uint8_t>(inst.operands.at(0)),
-                                               std::get<uint32_t>(inst.operands.at(1)),
-                                               std::get<uint32_t>(inst.operands.at(2)));
-            returndata.insert(returndata.end(), ret.begin(), ret.end());
-
-            break;
-        }
-        case OpCode::REVERT: {
-            auto ret = trace_builder.op_revert(std::get<uint8_t>(inst.operands.at(0)),
-                                               std::get<uint32_t>(inst.operands.at(1)),
-                                               std::get<uint32_t>(inst.operands.at(2)));
-            returndata.insert(returndata.end(), ret.begin(), ret.end());
-
-            break;
-        }
-
-            // Misc
-        case OpCode::DEBUGLOG:
-            // We want a noop, but we need to execute something that both advances the PC,
-            // and adds a valid row to the trace.
-            trace_builder.op_jump(pc + 1);
-            break;
-
-            // Gadgets
-        case OpCode::KECCAK:
-            trace_builder.op_keccak(std::get<uint8_t>(inst.operands.at(0)),
-                                    std::get<uint32_t>(inst.operands.at(1)),
-                                    std::get<uint32_t>(inst.operands.at(2)),
-                                    std::get<uint32_t>(inst.operands.at(3)));
-
-            break;
-        case OpCode::POSEIDON2:
-            trace_builder.op_poseidon2_permutation(std::get<uint8_t>(inst.operands.at(0)),
-                                                   std::get<uint32_t>(inst.operands.at(1)),
-                                                   std::get<uint32_t>(inst.operands.at(2)));
-
-            break;
-        case OpCode::SHA256:
-            trace_builder.op_sha256(std::get<uint8_t>(inst.operands.at(0)),
-                                    std::get<uint32_t>(inst.operands.at(1)),
-                                    std::get<uint32_t>(inst.operands.at(2)),
-                                    std::get<uint32_t>(inst.operands.at(3)));
-            break;
-        case OpCode::PEDERSEN:
-            trace_builder.op_pedersen_hash(std::get<uint8_t>(inst.operands.at(0)),
-                                           std::get<uint32_t>(inst.operands.at(1)),
-                                           std::get<uint32_t>(inst.operands.at(2)),
-                                           std::get<uint32_t>(inst.operands.at(3)),
-                                           std::get<uint32_t>(inst.operands.at(4)));
-            break;
-        case OpCode::ECADD:
-            trace_builder.op_ec_add(std::get<uint8_t>(inst.operands.at(0)),
-                                    std::get<uint32_t>(inst.operands.at(1)),
-                                    std::get<uint32_t>(inst.operands.at(2)),
-                                    std::get<uint32_t>(inst.operands.at(3)),
-                                    std::get<uint32_t>(inst.operands.at(4)),
-                                    std::get<uint32_t>(inst.operands.at(5)),
-                                    std::get<uint32_t>(inst.operands.at(6)),
-                                    std::get<uint32_t>(inst.operands.at(7)));
-            break;
-        case OpCode::MSM:
-            trace_builder.op_variable_msm(std::get<uint8_t>(inst.operands.at(0)),
-                                          std::get<uint32_t>(inst.operands.at(1)),
-                                          std::get<uint32_t>(inst.operands.at(2)),
-                                          std::get<uint32_t>(inst.operands.at(3)),
-                                          std::get<uint32_t>(inst.operands.at(4)));
-            break;
-
-            // Conversions
-        case OpCode::TORADIXLE:
-            trace_builder.op_to_radix_le(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint32_t>(inst.operands.at(1)),
-                                         std::get<uint32_t>(inst.operands.at(2)),
-                                         std::get<uint32_t>(inst.operands.at(3)),
-                                         std::get<uint32_t>(inst.operands.at(4)));
-            break;
-
-            // Future Gadgets -- pending changes in noir
-        case OpCode::SHA256COMPRESSION:
-            trace_builder.op_sha256_compression(std::get<uint8_t>(inst.operands.at(0)),
-                                                std::get<uint32_t>(inst.operands.at(1)),
-                                                std::get<uint32_t>(inst.operands.at(2)),
-                                                std::get<uint32_t>(inst.operands.at(3)));
-            break;
-
-        case OpCode::KECCAKF1600:
-            trace_builder.op_keccakf1600(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint32_t>(inst.operands.at(1)),
-                                         std::get<uint32_t>(inst.operands.at(2)),
-                                         std::get<uint32_t>(inst.operands.at(3)));
-
-            break;
-        case OpCode::PEDERSENCOMMITMENT:
-            trace_builder.op_pedersen_commit(std::get<uint8_t>(inst.operands.at(0)),
-                                             std::get<uint32_t>(inst.operands.at(1)),
-                                             std::get<uint32_t>(inst.operands.at(2)),
-                                             std::get<uint32_t>(inst.operands.at(3)),
-                                             std::get<uint32_t>(inst.operands.at(4)));
-
-            break;
-        default:
-            throw_or_abort("Don't know how to execute opcode " + to_hex(inst.op_code) + " at pc " + std::to_string(pc) +
-                           ".");
-            break;
-        }
-    }
+    AvmTraceBuilder trace_builder(
+        public_inputs, execution_hints, start_side_effect_counter(public_inputs_vec), calldata);
+    execute(trace_builder, instructions, returndata);
 
     auto trace = trace_builder.finalize();
     vinfo("Built trace size: ", trace.size());
@@ -12,6 +12,15 @@
 
 namespace bb::avm_trace {
 
+// Outputs of the execution of a bytecode, which do not require generating the trace.
+struct ExecutionResult {
+    std::vector<FF> returndata;
+    uint32_t l2_gas_left = 0;
+    uint32_t da_gas_left = 0;
+    // The side effects are recorded in the kernel output columns of the public inputs.
+    VmPublicInputs public_inputs;
+};
+
 class Execution {
   public:
     // Hardcoded circuit size for now, with enough to support 16-bit range checks and more.
@@ -38,6 +47,11 @@ class Execution {
                                       std::vector<FF> const& public_inputs,
                                       ExecutionHints const& execution_hints);
 
+    static ExecutionResult simulate(std::vector<Instruction> const& instructions,
+                                    std::vector<FF> const& calldata = {},
+                                    std::vector<FF> const& public_inputs = {},
+                                    ExecutionHints const& execution_hints = {});
+
     static std::tuple<AvmFlavor::VerificationKey, bb::HonkProof> prove(
         std::vector<uint8_t> const& bytecode,
         std::vector<FF> const& calldata = {},
@@ -5,6 +5,7 @@
 
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/vm/avm/trace/common.hpp"
+#include "barretenberg/vm/avm/trace/lookup_counts.hpp"
 #include "barretenberg/vm/avm/trace/opcode.hpp"
 
 namespace bb::avm_trace {
@@ -15,7 +16,7 @@ class FixedBytesTable {
 
     void finalize(std::vector<AvmFullRow<FF>>& main_trace) const;
     void finalize_for_testing(std::vector<AvmFullRow<FF>>& main_trace,
-                              const std::unordered_map<uint32_t, uint32_t>& byte_operation_counter) const;
+                              const ByteOperationCounts& byte_operation_counter) const;
 
   private:
     FixedBytesTable() = default;
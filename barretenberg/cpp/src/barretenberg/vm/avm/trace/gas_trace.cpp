@@ -25,17 +25,19 @@ void AvmGasTraceBuilder::set_initial_gas(uint32_t l2_gas, uint32_t da_gas)
 
 uint32_t AvmGasTraceBuilder::get_l2_gas_left() const
 {
-    return gas_trace.back().remaining_l2_gas;
+    return remaining_l2_gas;
 }
 
 uint32_t AvmGasTraceBuilder::get_da_gas_left() const
 {
-    return gas_trace.back().remaining_da_gas;
+    return remaining_da_gas;
 }
 
 void AvmGasTraceBuilder::constrain_gas(uint32_t clk, OpCode opcode, uint32_t dyn_gas_multiplier)
 {
-    gas_opcode_lookup_counter[opcode]++;
+    if (!simulation_mode) {
+        gas_opcode_lookup_counter[static_cast<size_t>(opcode)]++;
+    }
 
     // Get the gas prices for this opcode
     const auto& GAS_COST_TABLE = FixedGasTable::get();
@@ -49,6 +51,10 @@ void AvmGasTraceBuilder::constrain_gas(uint32_t clk, OpCode opcode, uint32_t dyn
     remaining_l2_gas -= base_l2_gas_cost + dyn_l2_gas_cost * dyn_gas_multiplier;
     remaining_da_gas -= base_da_gas_cost + dyn_da_gas_cost * dyn_gas_multiplier;
 
+    if (simulation_mode) {
+        return;
+    }
+
     // Create a gas trace entry
     gas_trace.push_back({
         .clk = clk,
@@ -69,7 +75,9 @@ void AvmGasTraceBuilder::constrain_gas_for_external_call(uint32_t clk,
                                                          uint32_t nested_da_gas_cost)
 {
     const OpCode opcode = OpCode::CALL;
-    gas_opcode_lookup_counter[opcode]++;
+    if (!simulation_mode) {
+        gas_opcode_lookup_counter[static_cast<size_t>(opcode)]++;
+    }
 
     // Get the gas prices for this opcode
     const auto& GAS_COST_TABLE = FixedGasTable::get();
@@ -84,6 +92,10 @@ void AvmGasTraceBuilder::constrain_gas_for_external_call(uint32_t clk,
     remaining_l2_gas -= (base_l2_gas_cost + dyn_gas_multiplier * dyn_l2_gas_cost) + nested_l2_gas_cost;
     remaining_da_gas -= (base_da_gas_cost + dyn_gas_multiplier * dyn_da_gas_cost) + nested_da_gas_cost;
 
+    if (simulation_mode) {
+        return;
+    }
+
     // Create a gas trace entry
     gas_trace.push_back({
         .clk = clk,
@@ -172,9 +184,8 @@ void AvmGasTraceBuilder::finalize_lookups(std::vector<AvmFullRow<FF>>& main_trac
 {
     // Finalise gas left lookup counts
     // TODO: find the right place for this. This is not really over the main trace, but over the opcode trace.
-    for (auto const& [opcode, count] : gas_opcode_lookup_counter) {
-        main_trace.at(static_cast<uint8_t>(opcode)).lookup_opcode_gas_counts = count;
-    }
+    gas_opcode_lookup_counter.for_each_nonzero(
+        [&](size_t opcode, uint32_t count) { main_trace.at(opcode).lookup_opcode_gas_counts = count; });
 }
 
 } // namespace bb::avm_trace
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include "barretenberg/vm/avm/generated/full_row.hpp"
 #include "barretenberg/vm/avm/trace/common.hpp"
+#include "barretenberg/vm/avm/trace/lookup_counts.hpp"
 #include "barretenberg/vm/avm/trace/opcode.hpp"
 
 namespace bb::avm_trace {
@@ -23,7 +24,9 @@ class AvmGasTraceBuilder {
         uint32_t remaining_da_gas = 0;
     };
 
-    AvmGasTraceBuilder() = default;
+    explicit AvmGasTraceBuilder(bool simulation_mode = false)
+        : simulation_mode(simulation_mode)
+    {}
 
     size_t size() const { return gas_trace.size(); }
     void reset();
@@ -43,12 +46,14 @@ class AvmGasTraceBuilder {
     uint32_t get_da_gas_left() const;
 
     // Counts each time an opcode is read: opcode -> count
-    std::unordered_map<OpCode, uint32_t> gas_opcode_lookup_counter;
+    LookupCounts<static_cast<size_t>(OpCode::LAST_OPCODE_SENTINEL)> gas_opcode_lookup_counter;
     // Data structure to collect all lookup counts pertaining to 16-bit range checks related to remaining gas
-    std::array<std::unordered_map<uint16_t, uint32_t>, 4> rem_gas_rng_check_counts;
+    std::array<U16LookupCounts, 4> rem_gas_rng_check_counts;
 
   private:
     std::vector<GasTraceEntry> gas_trace;
+    // In simulation mode, only the results of the operations are computed (see AvmTraceBuilder)
+    bool simulation_mode = false;
 
     uint32_t initial_l2_gas = 0;
     uint32_t initial_da_gas = 0;
@@ -489,28 +489,12 @@ void AvmKernelTraceBuilder::finalize_columns(std::vector<AvmFullRow<FF>>& main_t
     }
 
     // Write lookup counts for inputs
-    for (auto const& [selector, count] : kernel_input_selector_counter) {
-        main_trace.at(selector).lookup_into_kernel_counts = FF(count);
-    }
-    // for (uint32_t i = 0; i < KERNEL_INPUTS_LENGTH; i++) {
-    //     auto value = kernel_input_selector_counter.find(i);
-    //     if (value != kernel_input_selector_counter.end()) {
-    //         auto& dest = main_trace.at(i);
-    //         dest.lookup_into_kernel_counts = FF(value->second);
-    //     }
-    // }
+    kernel_input_selector_counter.for_each_nonzero(
+        [&](size_t selector, uint32_t count) { main_trace.at(selector).lookup_into_kernel_counts = FF(count); });
 
     // Write lookup counts for outputs
-    for (auto const& [selector, count] : kernel_output_selector_counter) {
-        main_trace.at(selector).kernel_output_lookup_counts = FF(count);
-    }
-    // for (uint32_t i = 0; i < KERNEL_OUTPUTS_LENGTH; i++) {
-    //     auto value = kernel_output_selector_counter.find(i);
-    //     if (value != kernel_output_selector_counter.end()) {
-    //         auto& dest = main_trace.at(i);
-    //         dest.kernel_output_lookup_counts = FF(value->second);
-    //     }
-    // }
+    kernel_output_selector_counter.for_each_nonzero(
+        [&](size_t selector, uint32_t count) { main_trace.at(selector).kernel_output_lookup_counts = FF(count); });
 }
 
 } // namespace bb::avm_trace
@@ -3,11 +3,11 @@
 #include "barretenberg/numeric/uint128/uint128.hpp"
 #include "barretenberg/vm/avm/trace/common.hpp"
 #include "barretenberg/vm/avm/trace/execution_hints.hpp"
+#include "barretenberg/vm/avm/trace/lookup_counts.hpp"
 
 #include "barretenberg/vm/constants.hpp"
 
 #include <cstdint>
-#include <unordered_map>
 #include <vector>
 
 namespace bb::avm_trace {
@@ -51,11 +51,11 @@ class AvmKernelTraceBuilder {
     };
 
     // Counts the number of accesses into each SELECTOR for the environment selector lookups;
-    std::unordered_map<uint32_t, uint32_t> kernel_input_selector_counter;
+    LookupCounts<KERNEL_INPUTS_LENGTH> kernel_input_selector_counter;
 
     // TODO(https://github.com/AztecProtocol/aztec-packages/issues/6484): as outputs are only written to once, we can
     // optimise this to just hardcode the counter to be the same as the lookup selector value!!!
-    std::unordered_map<uint32_t, uint32_t> kernel_output_selector_counter;
+    LookupCounts<KERNEL_OUTPUTS_LENGTH> kernel_output_selector_counter;
 
     AvmKernelTraceBuilder(uint32_t initial_side_effect_counter, VmPublicInputs public_inputs, ExecutionHints hints)
         : initial_side_effect_counter(initial_side_effect_counter)
@@ -67,6 +67,9 @@ class AvmKernelTraceBuilder {
     void finalize(std::vector<AvmFullRow<FF>>& main_trace);
     void finalize_columns(std::vector<AvmFullRow<FF>>& main_trace) const;
 
+    // The public inputs, whose output columns are filled in by the side effect opcodes
+    VmPublicInputs const& get_public_inputs() const { return public_inputs; }
+
     // Context
     FF op_address(uint32_t clk);
     FF op_storage_address(uint32_t clk);
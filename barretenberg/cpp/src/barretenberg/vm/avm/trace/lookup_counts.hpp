@@ -0,0 +1,61 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bb::avm_trace {
+
+/**
+ * @brief Multiplicities of the lookups into a fixed table with rows indexed by [0, SIZE), e.g. a range check table
+ * @details Counting into a flat array makes every increment a single indexed access, and the counts come out in row
+ * order so they can be written straight into the lookup counts column. The array lives on the heap, as a trace
+ * builder holds dozens of 2^16-entry tables.
+ */
+template <size_t SIZE> class LookupCounts {
+  public:
+    LookupCounts()
+        : counts(SIZE, 0)
+    {}
+
+    static constexpr size_t size() { return SIZE; }
+
+    uint32_t& operator[](size_t key) { return counts[key]; }
+    uint32_t operator[](size_t key) const { return counts[key]; }
+
+    void clear() { std::fill(counts.begin(), counts.end(), 0); }
+
+    // Adds the counts of other, e.g. to combine counts collected concurrently into separate tables
+    LookupCounts& operator+=(LookupCounts const& other)
+    {
+        for (size_t key = 0; key < SIZE; key++) {
+            counts[key] += other.counts[key];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Call fn(key, count) on every key that has been looked up, in increasing order of keys
+     */
+    template <typename Fn> void for_each_nonzero(Fn&& fn) const
+    {
+        for (size_t key = 0; key < SIZE; key++) {
+            if (counts[key] != 0) {
+                fn(key, counts[key]);
+            }
+        }
+    }
+
+  private:
+    std::vector<uint32_t> counts;
+};
+
+// Lookup counts into the 8-bit and 16-bit range check tables
+using U8LookupCounts = LookupCounts<1 << 8>;
+using U16LookupCounts = LookupCounts<1 << 16>;
+// Lookup counts into the bitwise operations table, whose rows are indexed by (op_id << 16) + (a << 8) + b for the
+// op_ids of AND, OR and XOR
+using ByteOperationCounts = LookupCounts<3 << 16>;
+
+} // namespace bb::avm_trace
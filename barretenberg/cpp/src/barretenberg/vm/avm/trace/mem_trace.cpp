@@ -1,7 +1,9 @@
 #include "barretenberg/vm/avm/trace/mem_trace.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/vm/avm/trace/common.hpp"
 #include "barretenberg/vm/avm/trace/trace.hpp"
 
+#include <algorithm>
 #include <cstdint>
 
 namespace bb::avm_trace {
@@ -12,20 +14,63 @@ namespace bb::avm_trace {
  */
 void AvmMemTraceBuilder::reset()
 {
-    mem_trace.clear();
-    memory.fill({});
+    for (auto& buckets : mem_trace_buckets) {
+        buckets.clear();
+    }
+    for (auto& mem_space : memory) {
+        mem_space.clear();
+    }
 }
 
 /**
  * @brief Prepare the memory trace to be incorporated into the main trace.
+ * @details The entries are bucketed by address space and range of addresses, and the buckets are visited in increasing
+ * order of (space_id, page). Sorting every bucket, in parallel, thus sorts the whole trace.
  *
- * @return The memory trace (which is moved).
+ * @return The memory trace sorted by space_id, address, clk and sub-clk.
  */
 std::vector<AvmMemTraceBuilder::MemoryTraceEntry> AvmMemTraceBuilder::finalize()
 {
-    // Sort avm_mem
-    std::sort(mem_trace.begin(), mem_trace.end());
-    return std::move(mem_trace);
+    std::vector<std::vector<MemoryTraceEntry>*> buckets;
+    for (auto& space_buckets : mem_trace_buckets) {
+        for (auto& bucket : space_buckets) {
+            if (!bucket.empty()) {
+                buckets.push_back(&bucket);
+            }
+        }
+    }
+
+    // Offsets of the buckets in the sorted trace
+    std::vector<size_t> offsets(buckets.size() + 1, 0);
+    for (size_t i = 0; i < buckets.size(); i++) {
+        offsets[i + 1] = offsets[i] + buckets[i]->size();
+    }
+
+    std::vector<MemoryTraceEntry> mem_trace(offsets.back());
+    parallel_for(buckets.size(), [&](size_t i) {
+        auto& bucket = *buckets[i];
+        std::sort(bucket.begin(), bucket.end());
+        std::move(bucket.begin(), bucket.end(), mem_trace.begin() + static_cast<std::ptrdiff_t>(offsets[i]));
+        bucket = {};
+    });
+    return mem_trace;
+}
+
+/**
+ * @brief Append an entry to the memory trace, in the bucket of its address space and range of addresses.
+ */
+void AvmMemTraceBuilder::add_to_mem_trace(MemoryTraceEntry const& entry)
+{
+    if (simulation_mode) {
+        return;
+    }
+
+    auto& buckets = mem_trace_buckets.at(entry.m_space_id);
+    const size_t bucket_index = entry.m_addr >> LOG_BUCKET_SIZE;
+    if (bucket_index >= buckets.size()) {
+        buckets.resize(bucket_index + 1);
+    }
+    buckets[bucket_index].push_back(entry);
 }
 
 /**
@@ -72,7 +117,7 @@ void AvmMemTraceBuilder::insert_in_mem_trace(uint8_t space_id,
         mem_trace_entry.poseidon_mem_op = true;
         break;
     }
-    mem_trace.emplace_back(mem_trace_entry);
+    add_to_mem_trace(mem_trace_entry);
 }
 
 // Memory operations need to be performed before the addition of the corresponding row in
@@ -101,6 +146,10 @@ void AvmMemTraceBuilder::load_mismatch_tag_in_mem_trace(uint8_t space_id,
                                                         AvmMemoryTag const w_in_tag,
                                                         AvmMemoryTag const m_tag)
 {
+    if (simulation_mode) {
+        return;
+    }
+
     FF one_min_inv = FF(1) - (FF(static_cast<uint32_t>(r_in_tag)) - FF(static_cast<uint32_t>(m_tag))).invert();
 
     // Relevant for inclusion (lookup) check #[INCL_MEM_TAG_ERR]. We need to
@@ -113,17 +162,17 @@ void AvmMemTraceBuilder::load_mismatch_tag_in_mem_trace(uint8_t space_id,
     // Lookup counter hint, used for #[INCL_MAIN_TAG_ERR] lookup (joined on clk)
     m_tag_err_lookup_counts[m_clk]++;
 
-    mem_trace.emplace_back(MemoryTraceEntry{ .m_space_id = space_id,
-                                             .m_clk = m_clk,
-                                             .m_sub_clk = m_sub_clk,
-                                             .m_addr = m_addr,
-                                             .m_val = m_val,
-                                             .m_tag = m_tag,
-                                             .r_in_tag = r_in_tag,
-                                             .w_in_tag = w_in_tag,
-                                             .m_tag_err = true,
-                                             .m_one_min_inv = one_min_inv,
-                                             .m_tag_err_count_relevant = tag_err_count_relevant });
+    add_to_mem_trace(MemoryTraceEntry{ .m_space_id = space_id,
+                                       .m_clk = m_clk,
+                                       .m_sub_clk = m_sub_clk,
+                                       .m_addr = m_addr,
+                                       .m_val = m_val,
+                                       .m_tag = m_tag,
+                                       .r_in_tag = r_in_tag,
+                                       .w_in_tag = w_in_tag,
+                                       .m_tag_err = true,
+                                       .m_one_min_inv = one_min_inv,
+                                       .m_tag_err_count_relevant = tag_err_count_relevant });
 }
 
 /**
@@ -149,8 +198,7 @@ bool AvmMemTraceBuilder::load_from_mem_trace(uint8_t space_id,
                                              AvmMemoryTag w_in_tag,
                                              MemOpOwner mem_op_owner)
 {
-    auto& mem_space = memory.at(space_id);
-    AvmMemoryTag m_tag = mem_space.contains(addr) ? mem_space.at(addr).tag : AvmMemoryTag::U0;
+    AvmMemoryTag m_tag = memory.at(space_id).get(addr).tag;
 
     if (m_tag == AvmMemoryTag::U0 || m_tag == r_in_tag) {
         insert_in_mem_trace(space_id, clk, sub_clk, addr, val, m_tag, r_in_tag, w_in_tag, false, mem_op_owner);
@@ -221,9 +269,9 @@ AvmMemTraceBuilder::MemEntry AvmMemTraceBuilder::read_and_load_mov_opcode(uint8_
                                                                           uint32_t const addr)
 {
     auto& mem_space = memory.at(space_id);
-    MemEntry mem_entry = mem_space.contains(addr) ? mem_space.at(addr) : MemEntry{};
+    MemEntry mem_entry = mem_space.get(addr);
 
-    mem_trace.emplace_back(MemoryTraceEntry{
+    add_to_mem_trace(MemoryTraceEntry{
         .m_space_id = space_id,
         .m_clk = clk,
         .m_sub_clk = SUB_CLK_LOAD_A,
@@ -258,15 +306,15 @@ std::array<AvmMemTraceBuilder::MemEntry, 3> AvmMemTraceBuilder::read_and_load_cm
     uint8_t space_id, uint32_t clk, uint32_t a_addr, uint32_t b_addr, uint32_t cond_addr)
 {
     auto& mem_space = memory.at(space_id);
-    MemEntry a_mem_entry = mem_space.contains(a_addr) ? mem_space.at(a_addr) : MemEntry{};
-    MemEntry b_mem_entry = mem_space.contains(b_addr) ? mem_space.at(b_addr) : MemEntry{};
-    MemEntry cond_mem_entry = mem_space.contains(cond_addr) ? mem_space.at(cond_addr) : MemEntry{};
+    MemEntry a_mem_entry = mem_space.get(a_addr);
+    MemEntry b_mem_entry = mem_space.get(b_addr);
+    MemEntry cond_mem_entry = mem_space.get(cond_addr);
 
     bool mov_b = cond_mem_entry.val == 0;
 
     AvmMemoryTag r_w_in_tag = mov_b ? b_mem_entry.tag : a_mem_entry.tag;
 
-    mem_trace.emplace_back(MemoryTraceEntry{
+    add_to_mem_trace(MemoryTraceEntry{
         .m_space_id = space_id,
         .m_clk = clk,
         .m_sub_clk = SUB_CLK_LOAD_A,
@@ -279,7 +327,7 @@ std::array<AvmMemTraceBuilder::MemEntry, 3> AvmMemTraceBuilder::read_and_load_cm
         .m_sel_cmov = true,
     });
 
-    mem_trace.emplace_back(MemoryTraceEntry{
+    add_to_mem_trace(MemoryTraceEntry{
         .m_space_id = space_id,
         .m_clk = clk,
         .m_sub_clk = SUB_CLK_LOAD_B,
@@ -292,7 +340,7 @@ std::array<AvmMemTraceBuilder::MemEntry, 3> AvmMemTraceBuilder::read_and_load_cm
         .m_sel_cmov = true,
     });
 
-    mem_trace.emplace_back(MemoryTraceEntry{
+    add_to_mem_trace(MemoryTraceEntry{
         .m_space_id = space_id,
         .m_clk = clk,
         .m_sub_clk = SUB_CLK_LOAD_D,
@@ -324,9 +372,9 @@ AvmMemTraceBuilder::MemEntry AvmMemTraceBuilder::read_and_load_jumpi_opcode(uint
                                                                             uint32_t cond_addr)
 {
     auto& mem_space = memory.at(space_id);
-    MemEntry cond_mem_entry = mem_space.contains(cond_addr) ? mem_space.at(cond_addr) : MemEntry{};
+    MemEntry cond_mem_entry = mem_space.get(cond_addr);
 
-    mem_trace.emplace_back(MemoryTraceEntry{
+    add_to_mem_trace(MemoryTraceEntry{
         .m_space_id = space_id,
         .m_clk = clk,
         .m_sub_clk = SUB_CLK_LOAD_D,
@@ -361,9 +409,9 @@ AvmMemTraceBuilder::MemEntry AvmMemTraceBuilder::read_and_load_cast_opcode(uint8
                                                                            AvmMemoryTag w_in_tag)
 {
     auto& mem_space = memory.at(space_id);
-    MemEntry mem_entry = mem_space.contains(addr) ? mem_space.at(addr) : MemEntry{};
+    MemEntry mem_entry = mem_space.get(addr);
 
-    mem_trace.emplace_back(MemoryTraceEntry{
+    add_to_mem_trace(MemoryTraceEntry{
         .m_space_id = space_id,
         .m_clk = clk,
         .m_sub_clk = SUB_CLK_LOAD_A,
@@ -415,8 +463,7 @@ AvmMemTraceBuilder::MemRead AvmMemTraceBuilder::read_and_load_from_memory(uint8_
         sub_clk = SUB_CLK_LOAD_D;
         break;
     }
-    auto& mem_space = memory.at(space_id);
-    FF val = mem_space.contains(addr) ? mem_space.at(addr).val : 0;
+    FF val = memory.at(space_id).get(addr).val;
     bool tagMatch = load_from_mem_trace(space_id, clk, sub_clk, addr, val, r_in_tag, w_in_tag, mem_op_owner);
 
     return MemRead{
@@ -446,8 +493,7 @@ AvmMemTraceBuilder::MemRead AvmMemTraceBuilder::indirect_read_and_load_from_memo
         break;
     }
 
-    auto& mem_space = memory.at(space_id);
-    FF val = mem_space.contains(addr) ? mem_space.at(addr).val : 0;
+    FF val = memory.at(space_id).get(addr).val;
     bool tagMatch = load_from_mem_trace(space_id, clk, sub_clk, addr, val, AvmMemoryTag::U32, AvmMemoryTag::U0);
 
     return MemRead{
@@ -514,9 +560,7 @@ std::vector<FF> AvmMemTraceBuilder::read_return_opcode(uint32_t clk,
     std::vector<FF> returndata;
     for (uint32_t i = 0; i < ret_size; i++) {
         auto addr = direct_ret_offset + i;
-        auto& mem_space = memory.at(space_id);
-        FF val = mem_space.contains(addr) ? mem_space.at(addr).val : 0;
-        AvmMemoryTag tag = mem_space.contains(addr) ? mem_space.at(addr).tag : AvmMemoryTag::U0;
+        auto [val, tag] = memory.at(space_id).get(addr);
 
         // No tag checking is performed for RETURN opcode.
         insert_in_mem_trace(space_id,
@@ -571,14 +615,7 @@ void AvmMemTraceBuilder::write_in_simulated_mem_table(uint8_t space_id,
                                                       FF const& val,
                                                       AvmMemoryTag w_in_tag)
 {
-    MemEntry memEntry{ val, w_in_tag };
-    auto& mem_space = memory.at(space_id);
-    auto it = mem_space.find(addr);
-    if (it != mem_space.end()) {
-        it->second = memEntry;
-    } else {
-        mem_space.emplace(addr, memEntry);
-    }
+    memory.at(space_id).set(addr, MemEntry{ val, w_in_tag });
 }
 
 } // namespace bb::avm_trace
@@ -2,7 +2,11 @@
 
 #include "barretenberg/vm/avm/trace/common.hpp"
 
+#include <array>
 #include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace bb::avm_trace {
 
@@ -60,6 +64,41 @@ class AvmMemTraceBuilder {
         AvmMemoryTag tag = AvmMemoryTag::U0;
     };
 
+    /**
+     * @brief Simulated memory of one address space: entries are stored in small fixed-size pages, each allocated on the
+     * first write into it and looked up by page index, so that sparse accesses across the 32-bit address range only
+     * allocate the pages they touch. Addresses which were never written hold the default entry (value 0, tag U0).
+     */
+    class MemorySpace {
+      public:
+        static constexpr size_t LOG_PAGE_SIZE = 8;
+        static constexpr size_t PAGE_SIZE = 1 << LOG_PAGE_SIZE;
+
+        MemEntry get(uint32_t addr) const
+        {
+            auto it = pages.find(addr >> LOG_PAGE_SIZE);
+            if (it == pages.end()) {
+                return {};
+            }
+            return (*it->second)[addr & (PAGE_SIZE - 1)];
+        }
+
+        void set(uint32_t addr, MemEntry const& entry)
+        {
+            auto& page = pages[addr >> LOG_PAGE_SIZE];
+            if (page == nullptr) {
+                page = std::make_unique<Page>();
+            }
+            (*page)[addr & (PAGE_SIZE - 1)] = entry;
+        }
+
+        void clear() { pages.clear(); }
+
+      private:
+        using Page = std::array<MemEntry, PAGE_SIZE>;
+        std::unordered_map<uint32_t, std::unique_ptr<Page>> pages;
+    };
+
     // Structure to return value and tag matching boolean after a memory read.
     struct MemRead {
         bool tag_match = false;
@@ -73,7 +112,9 @@ class AvmMemTraceBuilder {
         POSEIDON2,
     };
 
-    AvmMemTraceBuilder() = default;
+    explicit AvmMemTraceBuilder(bool simulation_mode = false)
+        : simulation_mode(simulation_mode)
+    {}
 
     void reset();
 
@@ -109,13 +150,21 @@ class AvmMemTraceBuilder {
     std::vector<FF> read_return_opcode(uint32_t clk, uint8_t space_id, uint32_t direct_ret_offset, uint32_t ret_size);
 
     // DO NOT USE FOR REAL OPERATIONS
-    FF unconstrained_read(uint8_t space_id, uint32_t addr) { return memory[space_id][addr].val; }
+    FF unconstrained_read(uint8_t space_id, uint32_t addr) { return memory[space_id].get(addr).val; }
 
   private:
-    std::vector<MemoryTraceEntry> mem_trace; // Entries will be sorted by m_clk, m_sub_clk after finalize().
+    // Memory trace entries bucketed by space_id and range of 2^LOG_BUCKET_SIZE addresses, in insertion order. They are
+    // sorted by address, m_clk and m_sub_clk in finalize().
+    static constexpr size_t LOG_BUCKET_SIZE = 12;
+    std::array<std::vector<std::vector<MemoryTraceEntry>>, NUM_MEM_SPACES> mem_trace_buckets;
+
+    // Global Memory table (used for simulation), one per space_id
+    std::array<MemorySpace, NUM_MEM_SPACES> memory;
+
+    // In simulation mode, only the results of the operations are computed (see AvmTraceBuilder)
+    bool simulation_mode = false;
 
-    // Global Memory table (used for simulation): (space_id, (address, mem_entry))
-    std::array<std::unordered_map<uint32_t, MemEntry>, NUM_MEM_SPACES> memory;
+    void add_to_mem_trace(MemoryTraceEntry const& entry);
 
     void insert_in_mem_trace(uint8_t space_id,
                              uint32_t m_clk,
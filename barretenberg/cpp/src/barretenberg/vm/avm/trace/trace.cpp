@@ -10,10 +10,10 @@
 #include <set>
 #include <string>
 #include <sys/types.h>
-#include <unordered_map>
 #include <vector>
 
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
@@ -42,21 +42,19 @@ uint32_t finalize_rng_chks_for_testing(
     std::vector<Row>& main_trace,
     AvmAluTraceBuilder const& alu_trace_builder,
     AvmMemTraceBuilder const& mem_trace_builder,
-    std::unordered_map<uint16_t, uint32_t> const& mem_rng_check_lo_counts,
-    std::unordered_map<uint16_t, uint32_t> const& mem_rng_check_mid_counts,
-    std::unordered_map<uint8_t, uint32_t> const& mem_rng_check_hi_counts,
-    std::array<std::unordered_map<uint16_t, uint32_t>, 4> const& rem_gas_rng_check_counts)
+    U16LookupCounts const& mem_rng_check_lo_counts,
+    U16LookupCounts const& mem_rng_check_mid_counts,
+    U8LookupCounts const& mem_rng_check_hi_counts,
+    std::array<U16LookupCounts, 4> const& rem_gas_rng_check_counts)
 {
     // Build the main_trace, and add any new rows with specific clks that line up with lookup reads
+    std::vector<std::reference_wrapper<U8LookupCounts const>> u8_rng_chks = {
+        alu_trace_builder.u8_range_chk_counters[0], alu_trace_builder.u8_range_chk_counters[1],
+        alu_trace_builder.u8_pow_2_counters[0],     alu_trace_builder.u8_pow_2_counters[1],
+        mem_rng_check_hi_counts
+    };
 
-    // Is there a "spread-like" operator in cpp or can I make it generic of the first param of the unordered map
-    std::vector<std::unordered_map<uint8_t, uint32_t>> u8_rng_chks = { alu_trace_builder.u8_range_chk_counters[0],
-                                                                       alu_trace_builder.u8_range_chk_counters[1],
-                                                                       alu_trace_builder.u8_pow_2_counters[0],
-                                                                       alu_trace_builder.u8_pow_2_counters[1],
-                                                                       std::move(mem_rng_check_hi_counts) };
-
-    std::vector<std::reference_wrapper<std::unordered_map<uint16_t, uint32_t> const>> u16_rng_chks;
+    std::vector<std::reference_wrapper<U16LookupCounts const>> u16_rng_chks;
 
     u16_rng_chks.emplace_back(mem_rng_check_lo_counts);
     u16_rng_chks.emplace_back(mem_rng_check_mid_counts);
@@ -68,29 +66,18 @@ uint32_t finalize_rng_chks_for_testing(
         u16_rng_chks.emplace_back(alu_trace_builder.u16_range_chk_counters[i]);
     }
 
-    auto custom_clk = std::set<uint32_t>{};
-    for (auto const& row : u8_rng_chks) {
-        for (auto const& [key, value] : row) {
-            custom_clk.insert(key);
-        }
+    for (size_t i = 0; i < 8; i++) {
+        u16_rng_chks.emplace_back(alu_trace_builder.div_u64_range_chk_counters[i]);
     }
 
-    for (auto const& row : alu_trace_builder.u16_range_chk_counters) {
-        for (auto const& [key, value] : row) {
-            custom_clk.insert(key);
-        }
+    auto custom_clk = std::set<uint32_t>{};
+    const auto insert_clk = [&](size_t key, uint32_t /*count*/) { custom_clk.insert(static_cast<uint32_t>(key)); };
+    for (auto row : u8_rng_chks) {
+        row.get().for_each_nonzero(insert_clk);
     }
 
     for (auto row : u16_rng_chks) {
-        for (auto const& [key, value] : row.get()) {
-            custom_clk.insert(key);
-        }
-    }
-
-    for (auto const& row : alu_trace_builder.div_u64_range_chk_counters) {
-        for (auto const& [key, value] : row) {
-            custom_clk.insert(key);
-        }
+        row.get().for_each_nonzero(insert_clk);
     }
 
     for (auto const& [clk, count] : mem_trace_builder.m_tag_err_lookup_counts) {
@@ -137,6 +124,142 @@ template <typename MEM, size_t T> std::array<MEM, T> vec_to_arr(std::vector<MEM>
     return arr;
 }
 
+// Minimum number of rows of the memory trace merged into the main trace by a single thread
+constexpr size_t MIN_MEM_ROWS_PER_CHUNK = 1 << 12;
+
+// Lookup counts into the range check tables of the differences between consecutive rows of the memory trace
+struct MemRngChkCounts {
+    U16LookupCounts lo;
+    U16LookupCounts mid;
+    U8LookupCounts hi;
+};
+
+/**
+ * @brief Incorporates the rows [start, end) of the sorted memory trace into the main trace. Every row only depends on
+ *        the memory trace entries at the same and next index, so that disjoint ranges can be merged concurrently.
+ */
+void merge_mem_trace_rows(std::vector<AvmMemTraceBuilder::MemoryTraceEntry> const& mem_trace,
+                          std::vector<Row>& main_trace,
+                          size_t start,
+                          size_t end,
+                          MemRngChkCounts& rng_chk_counts)
+{
+    const auto tsp = [](AvmMemTraceBuilder::MemoryTraceEntry const& entry) {
+        return FF(AvmMemTraceBuilder::NUM_SUB_CLK * entry.m_clk + entry.m_sub_clk);
+    };
+    const auto glob_addr = [](AvmMemTraceBuilder::MemoryTraceEntry const& entry) {
+        return FF(entry.m_addr + (static_cast<uint64_t>(entry.m_space_id) << 32));
+    };
+
+    for (size_t i = start; i < end; i++) {
+        auto const& src = mem_trace.at(i);
+        auto& dest = main_trace.at(i);
+
+        dest.mem_sel_mem = FF(1);
+        dest.mem_clk = FF(src.m_clk);
+        dest.mem_addr = FF(src.m_addr);
+        dest.mem_space_id = FF(src.m_space_id);
+        dest.mem_val = src.m_val;
+        dest.mem_rw = FF(static_cast<uint32_t>(src.m_rw));
+        dest.mem_r_in_tag = FF(static_cast<uint32_t>(src.r_in_tag));
+        dest.mem_w_in_tag = FF(static_cast<uint32_t>(src.w_in_tag));
+        dest.mem_tag = FF(static_cast<uint32_t>(src.m_tag));
+        dest.mem_tag_err = FF(static_cast<uint32_t>(src.m_tag_err));
+        dest.mem_one_min_inv = src.m_one_min_inv;
+        dest.mem_sel_mov_ia_to_ic = FF(static_cast<uint32_t>(src.m_sel_mov_ia_to_ic));
+        dest.mem_sel_mov_ib_to_ic = FF(static_cast<uint32_t>(src.m_sel_mov_ib_to_ic));
+        dest.mem_sel_op_cmov = FF(static_cast<uint32_t>(src.m_sel_cmov));
+        dest.mem_sel_op_slice = FF(static_cast<uint32_t>(src.m_sel_op_slice));
+        dest.mem_tsp = tsp(src);
+        dest.mem_glob_addr = glob_addr(src);
+
+        dest.incl_mem_tag_err_counts = FF(static_cast<uint32_t>(src.m_tag_err_count_relevant));
+
+        // TODO: Should be a cleaner way to do this in the future. Perhaps an "into_canoncal" function in
+        // mem_trace_builder
+        if (!src.m_sel_op_slice) {
+            switch (src.m_sub_clk) {
+            case AvmMemTraceBuilder::SUB_CLK_LOAD_A:
+                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_a = 1 : dest.mem_sel_op_a = 1;
+                break;
+            case AvmMemTraceBuilder::SUB_CLK_STORE_A:
+                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_a = 1 : dest.mem_sel_op_a = 1;
+                break;
+            case AvmMemTraceBuilder::SUB_CLK_LOAD_B:
+                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_b = 1 : dest.mem_sel_op_b = 1;
+                break;
+            case AvmMemTraceBuilder::SUB_CLK_STORE_B:
+                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_b = 1 : dest.mem_sel_op_b = 1;
+                break;
+            case AvmMemTraceBuilder::SUB_CLK_LOAD_C:
+                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_c = 1 : dest.mem_sel_op_c = 1;
+                break;
+            case AvmMemTraceBuilder::SUB_CLK_STORE_C:
+                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_c = 1 : dest.mem_sel_op_c = 1;
+                break;
+            case AvmMemTraceBuilder::SUB_CLK_LOAD_D:
+                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_d = 1 : dest.mem_sel_op_d = 1;
+                break;
+            case AvmMemTraceBuilder::SUB_CLK_STORE_D:
+                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_d = 1 : dest.mem_sel_op_d = 1;
+                break;
+            case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_A:
+                dest.mem_sel_resolve_ind_addr_a = 1;
+                break;
+            case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_B:
+                dest.mem_sel_resolve_ind_addr_b = 1;
+                break;
+            case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_C:
+                dest.mem_sel_resolve_ind_addr_c = 1;
+                break;
+            case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_D:
+                dest.mem_sel_resolve_ind_addr_d = 1;
+                break;
+            default:
+                break;
+            }
+        }
+
+        if (src.m_sel_cmov || src.m_sel_op_slice) {
+            dest.mem_skip_check_tag =
+                dest.mem_sel_op_cmov * (dest.mem_sel_op_d + dest.mem_sel_op_a * (-dest.mem_sel_mov_ia_to_ic + 1) +
+                                        dest.mem_sel_op_b * (-dest.mem_sel_mov_ib_to_ic + 1)) +
+                dest.mem_sel_op_slice;
+        }
+
+        if (i + 1 < mem_trace.size()) {
+            auto const& next = mem_trace.at(i + 1);
+            const FF next_glob_addr = glob_addr(next);
+
+            FF diff{};
+            if (next_glob_addr == dest.mem_glob_addr) {
+                diff = tsp(next) - dest.mem_tsp;
+            } else {
+                diff = next_glob_addr - dest.mem_glob_addr;
+                dest.mem_lastAccess = FF(1);
+            }
+            dest.mem_sel_rng_chk = FF(1);
+
+            // Decomposition of diff
+            auto const diff_64 = uint64_t(diff);
+            auto const diff_hi = static_cast<uint8_t>(diff_64 >> 32);
+            auto const diff_mid = static_cast<uint16_t>((diff_64 & UINT32_MAX) >> 16);
+            auto const diff_lo = static_cast<uint16_t>(diff_64 & UINT16_MAX);
+            dest.mem_diff_hi = FF(diff_hi);
+            dest.mem_diff_mid = FF(diff_mid);
+            dest.mem_diff_lo = FF(diff_lo);
+
+            // Add the range checks counts
+            rng_chk_counts.hi[diff_hi]++;
+            rng_chk_counts.mid[diff_mid]++;
+            rng_chk_counts.lo[diff_lo]++;
+        } else {
+            dest.mem_lastAccess = FF(1);
+            dest.mem_last = FF(1);
+        }
+    }
+}
+
 } // anonymous namespace
 
 /**************************************************************************************************
@@ -281,6 +404,18 @@ void AvmTraceBuilder::finalise_mem_trace_lookup_counts()
     }
 }
 
+/**
+ * @brief Append a row to the main trace, or only count it in simulation mode.
+ */
+void AvmTraceBuilder::add_main_trace_row(Row const& row)
+{
+    if (simulation_mode) {
+        num_simulated_rows++;
+        return;
+    }
+    main_trace.push_back(row);
+}
+
 /**
  * @brief Constructor of a trace builder of AVM. Only serves to set the capacity of the
  *        underlying traces and initialize gas values.
@@ -288,12 +423,18 @@ void AvmTraceBuilder::finalise_mem_trace_lookup_counts()
 AvmTraceBuilder::AvmTraceBuilder(VmPublicInputs public_inputs,
                                  ExecutionHints execution_hints_,
                                  uint32_t side_effect_counter,
-                                 std::vector<FF> calldata)
+                                 std::vector<FF> calldata,
+                                 bool simulation_mode)
     // NOTE: we initialise the environment builder here as it requires public inputs
-    : calldata(std::move(calldata))
+    : simulation_mode(simulation_mode)
+    , calldata(std::move(calldata))
     , side_effect_counter(side_effect_counter)
     , execution_hints(std::move(execution_hints_))
+    , mem_trace_builder(simulation_mode)
+    , alu_trace_builder(simulation_mode)
+    , bin_trace_builder(simulation_mode)
     , kernel_trace_builder(side_effect_counter, public_inputs, execution_hints)
+    , gas_trace_builder(simulation_mode)
 {
     // TODO: think about cast
     gas_trace_builder.set_initial_gas(
@@ -317,7 +458,7 @@ AvmTraceBuilder::AvmTraceBuilder(VmPublicInputs public_inputs,
 void AvmTraceBuilder::op_add(
     uint8_t indirect, uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     // Resolve any potential indirects in the order they are encoded in the indirect byte.
     auto [resolved_a, resolved_b, resolved_c] = unpack_indirects<3>(indirect, { a_offset, b_offset, dst_offset });
@@ -343,7 +484,7 @@ void AvmTraceBuilder::op_add(
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::ADD);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_alu_in_tag = FF(static_cast<uint32_t>(in_tag)),
         .main_call_ptr = call_ptr,
@@ -384,7 +525,7 @@ void AvmTraceBuilder::op_add(
 void AvmTraceBuilder::op_sub(
     uint8_t indirect, uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     // Resolve any potential indirects in the order they are encoded in the indirect byte.
     auto [resolved_a, resolved_b, resolved_c] = unpack_indirects<3>(indirect, { a_offset, b_offset, dst_offset });
@@ -410,7 +551,7 @@ void AvmTraceBuilder::op_sub(
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::SUB);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_alu_in_tag = FF(static_cast<uint32_t>(in_tag)),
         .main_call_ptr = call_ptr,
@@ -451,7 +592,7 @@ void AvmTraceBuilder::op_sub(
 void AvmTraceBuilder::op_mul(
     uint8_t indirect, uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     // Resolve any potential indirects in the order they are encoded in the indirect byte.
     auto [resolved_a, resolved_b, resolved_c] = unpack_indirects<3>(indirect, { a_offset, b_offset, dst_offset });
@@ -477,7 +618,7 @@ void AvmTraceBuilder::op_mul(
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::MUL);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_alu_in_tag = FF(static_cast<uint32_t>(in_tag)),
         .main_call_ptr = call_ptr,
@@ -518,7 +659,7 @@ void AvmTraceBuilder::op_mul(
 void AvmTraceBuilder::op_div(
     uint8_t indirect, uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     auto [resolved_a, resolved_b, resolved_dst] = unpack_indirects<3>(indirect, { a_offset, b_offset, dst_offset });
 
@@ -555,7 +696,7 @@ void AvmTraceBuilder::op_div(
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::DIV);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_alu_in_tag = FF(static_cast<uint32_t>(in_tag)),
         .main_call_ptr = call_ptr,
@@ -597,7 +738,7 @@ void AvmTraceBuilder::op_div(
  */
 void AvmTraceBuilder::op_fdiv(uint8_t indirect, uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     // Resolve any potential indirects in the order they are encoded in the indirect byte.
     auto [resolved_a, resolved_b, resolved_c] = unpack_indirects<3>(indirect, { a_offset, b_offset, dst_offset });
@@ -635,7 +776,7 @@ void AvmTraceBuilder::op_fdiv(uint8_t indirect, uint32_t a_offset, uint32_t b_of
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::FDIV);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_call_ptr = call_ptr,
         .main_ia = tag_match ? read_a.val : FF(0),
@@ -681,7 +822,7 @@ void AvmTraceBuilder::op_fdiv(uint8_t indirect, uint32_t a_offset, uint32_t b_of
 void AvmTraceBuilder::op_eq(
     uint8_t indirect, uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     auto [resolved_a, resolved_b, resolved_c] = unpack_indirects<3>(indirect, { a_offset, b_offset, dst_offset });
 
@@ -705,7 +846,7 @@ void AvmTraceBuilder::op_eq(
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::EQ);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_alu_in_tag = FF(static_cast<uint32_t>(in_tag)),
         .main_call_ptr = call_ptr,
@@ -737,7 +878,7 @@ void AvmTraceBuilder::op_eq(
 void AvmTraceBuilder::op_lt(
     uint8_t indirect, uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     auto [resolved_a, resolved_b, resolved_c] = unpack_indirects<3>(indirect, { a_offset, b_offset, dst_offset });
 
@@ -757,7 +898,7 @@ void AvmTraceBuilder::op_lt(
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::LT);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_alu_in_tag = FF(static_cast<uint32_t>(in_tag)),
         .main_call_ptr = call_ptr,
@@ -789,7 +930,7 @@ void AvmTraceBuilder::op_lt(
 void AvmTraceBuilder::op_lte(
     uint8_t indirect, uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     auto [resolved_a, resolved_b, resolved_c] = unpack_indirects<3>(indirect, { a_offset, b_offset, dst_offset });
 
@@ -810,7 +951,7 @@ void AvmTraceBuilder::op_lte(
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::LTE);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_alu_in_tag = FF(static_cast<uint32_t>(in_tag)),
         .main_call_ptr = call_ptr,
@@ -846,7 +987,7 @@ void AvmTraceBuilder::op_lte(
 void AvmTraceBuilder::op_and(
     uint8_t indirect, uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     auto [resolved_a, resolved_b, resolved_c] = unpack_indirects<3>(indirect, { a_offset, b_offset, dst_offset });
 
@@ -866,7 +1007,7 @@ void AvmTraceBuilder::op_and(
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::AND);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_bin_op_id = FF(0),
         .main_call_ptr = call_ptr,
@@ -899,7 +1040,7 @@ void AvmTraceBuilder::op_and(
 void AvmTraceBuilder::op_or(
     uint8_t indirect, uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
     auto [resolved_a, resolved_b, resolved_c] = unpack_indirects<3>(indirect, { a_offset, b_offset, dst_offset });
 
     // Reading from memory and loading into ia resp. ib.
@@ -918,7 +1059,7 @@ void AvmTraceBuilder::op_or(
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::OR);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_bin_op_id = FF(1),
         .main_call_ptr = call_ptr,
@@ -951,7 +1092,7 @@ void AvmTraceBuilder::op_or(
 void AvmTraceBuilder::op_xor(
     uint8_t indirect, uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     auto [resolved_a, resolved_b, resolved_c] = unpack_indirects<3>(indirect, { a_offset, b_offset, dst_offset });
 
@@ -971,7 +1112,7 @@ void AvmTraceBuilder::op_xor(
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::XOR);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_bin_op_id = FF(2),
         .main_call_ptr = call_ptr,
@@ -1011,7 +1152,7 @@ void AvmTraceBuilder::op_xor(
  */
 void AvmTraceBuilder::op_not(uint8_t indirect, uint32_t a_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     // Resolve any potential indirects in the order they are encoded in the indirect byte.
     auto [resolved_a, resolved_c] = unpack_indirects<2>(indirect, { a_offset, dst_offset });
@@ -1034,7 +1175,7 @@ void AvmTraceBuilder::op_not(uint8_t indirect, uint32_t a_offset, uint32_t dst_o
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::NOT);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_alu_in_tag = FF(static_cast<uint32_t>(in_tag)),
         .main_call_ptr = call_ptr,
@@ -1061,7 +1202,7 @@ void AvmTraceBuilder::op_not(uint8_t indirect, uint32_t a_offset, uint32_t dst_o
 void AvmTraceBuilder::op_shl(
     uint8_t indirect, uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     auto [resolved_a, resolved_b, resolved_c] = unpack_indirects<3>(indirect, { a_offset, b_offset, dst_offset });
 
@@ -1080,7 +1221,7 @@ void AvmTraceBuilder::op_shl(
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::SHL);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_alu_in_tag = FF(static_cast<uint32_t>(in_tag)),
         .main_call_ptr = call_ptr,
@@ -1113,7 +1254,7 @@ void AvmTraceBuilder::op_shr(
     uint8_t indirect, uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
 
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     auto [resolved_a, resolved_b, resolved_c] = unpack_indirects<3>(indirect, { a_offset, b_offset, dst_offset });
 
@@ -1132,7 +1273,7 @@ void AvmTraceBuilder::op_shr(
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::SHR);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_alu_in_tag = FF(static_cast<uint32_t>(in_tag)),
         .main_call_ptr = call_ptr,
@@ -1176,7 +1317,7 @@ void AvmTraceBuilder::op_shr(
  */
 void AvmTraceBuilder::op_cast(uint8_t indirect, uint32_t a_offset, uint32_t dst_offset, AvmMemoryTag dst_tag)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
     bool tag_match = true;
     uint32_t direct_a_offset = a_offset;
     uint32_t direct_dst_offset = dst_offset;
@@ -1213,7 +1354,7 @@ void AvmTraceBuilder::op_cast(uint8_t indirect, uint32_t a_offset, uint32_t dst_
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::CAST);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_alu_in_tag = FF(static_cast<uint32_t>(dst_tag)),
         .main_call_ptr = call_ptr,
@@ -1257,7 +1398,7 @@ void AvmTraceBuilder::op_cast(uint8_t indirect, uint32_t a_offset, uint32_t dst_
  */
 Row AvmTraceBuilder::create_kernel_lookup_opcode(uint8_t indirect, uint32_t dst_offset, FF value, AvmMemoryTag w_tag)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
 
     auto [resolved_dst] = unpack_indirects<1>(indirect, { dst_offset });
     auto write_dst =
@@ -1281,7 +1422,7 @@ Row AvmTraceBuilder::create_kernel_lookup_opcode(uint8_t indirect, uint32_t dst_
 
 void AvmTraceBuilder::op_address(uint8_t indirect, uint32_t dst_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
     FF ia_value = kernel_trace_builder.op_address(clk);
     Row row = create_kernel_lookup_opcode(indirect, dst_offset, ia_value, AvmMemoryTag::FF);
     row.main_sel_op_address = FF(1);
@@ -1289,12 +1430,12 @@ void AvmTraceBuilder::op_address(uint8_t indirect, uint32_t dst_offset)
     // Constrain gas cost
     gas_trace_builder.constrain_gas(static_cast<uint32_t>(row.main_clk), OpCode::ADDRESS);
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 }
 
 void AvmTraceBuilder::op_storage_address(uint8_t indirect, uint32_t dst_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
     FF ia_value = kernel_trace_builder.op_storage_address(clk);
     Row row = create_kernel_lookup_opcode(indirect, dst_offset, ia_value, AvmMemoryTag::FF);
     row.main_sel_op_storage_address = FF(1);
@@ -1302,12 +1443,12 @@ void AvmTraceBuilder::op_storage_address(uint8_t indirect, uint32_t dst_offset)
     // Constrain gas cost
     gas_trace_builder.constrain_gas(static_cast<uint32_t>(row.main_clk), OpCode::STORAGEADDRESS);
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 }
 
 void AvmTraceBuilder::op_sender(uint8_t indirect, uint32_t dst_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
     FF ia_value = kernel_trace_builder.op_sender(clk);
     Row row = create_kernel_lookup_opcode(indirect, dst_offset, ia_value, AvmMemoryTag::FF);
     row.main_sel_op_sender = FF(1);
@@ -1315,12 +1456,12 @@ void AvmTraceBuilder::op_sender(uint8_t indirect, uint32_t dst_offset)
     // Constrain gas cost
     gas_trace_builder.constrain_gas(static_cast<uint32_t>(row.main_clk), OpCode::SENDER);
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 }
 
 void AvmTraceBuilder::op_function_selector(uint8_t indirect, uint32_t dst_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
     FF ia_value = kernel_trace_builder.op_function_selector(clk);
     Row row = create_kernel_lookup_opcode(indirect, dst_offset, ia_value, AvmMemoryTag::U32);
     row.main_sel_op_function_selector = FF(1);
@@ -1328,12 +1469,12 @@ void AvmTraceBuilder::op_function_selector(uint8_t indirect, uint32_t dst_offset
     // Constrain gas cost
     gas_trace_builder.constrain_gas(static_cast<uint32_t>(row.main_clk), OpCode::FUNCTIONSELECTOR);
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 }
 
 void AvmTraceBuilder::op_transaction_fee(uint8_t indirect, uint32_t dst_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
     FF ia_value = kernel_trace_builder.op_transaction_fee(clk);
     Row row = create_kernel_lookup_opcode(indirect, dst_offset, ia_value, AvmMemoryTag::FF);
     row.main_sel_op_transaction_fee = FF(1);
@@ -1341,7 +1482,7 @@ void AvmTraceBuilder::op_transaction_fee(uint8_t indirect, uint32_t dst_offset)
     // Constrain gas cost
     gas_trace_builder.constrain_gas(static_cast<uint32_t>(row.main_clk), OpCode::TRANSACTIONFEE);
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 }
 
 /**************************************************************************************************
@@ -1350,7 +1491,7 @@ void AvmTraceBuilder::op_transaction_fee(uint8_t indirect, uint32_t dst_offset)
 
 void AvmTraceBuilder::op_chain_id(uint8_t indirect, uint32_t dst_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
     FF ia_value = kernel_trace_builder.op_chain_id(clk);
     Row row = create_kernel_lookup_opcode(indirect, dst_offset, ia_value, AvmMemoryTag::FF);
     row.main_sel_op_chain_id = FF(1);
@@ -1358,12 +1499,12 @@ void AvmTraceBuilder::op_chain_id(uint8_t indirect, uint32_t dst_offset)
     // Constrain gas cost
     gas_trace_builder.constrain_gas(static_cast<uint32_t>(row.main_clk), OpCode::CHAINID);
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 }
 
 void AvmTraceBuilder::op_version(uint8_t indirect, uint32_t dst_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
     FF ia_value = kernel_trace_builder.op_version(clk);
     Row row = create_kernel_lookup_opcode(indirect, dst_offset, ia_value, AvmMemoryTag::FF);
     row.main_sel_op_version = FF(1);
@@ -1371,12 +1512,12 @@ void AvmTraceBuilder::op_version(uint8_t indirect, uint32_t dst_offset)
     // Constrain gas cost
     gas_trace_builder.constrain_gas(static_cast<uint32_t>(row.main_clk), OpCode::VERSION);
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 }
 
 void AvmTraceBuilder::op_block_number(uint8_t indirect, uint32_t dst_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
     FF ia_value = kernel_trace_builder.op_block_number(clk);
     Row row = create_kernel_lookup_opcode(indirect, dst_offset, ia_value, AvmMemoryTag::FF);
     row.main_sel_op_block_number = FF(1);
@@ -1384,12 +1525,12 @@ void AvmTraceBuilder::op_block_number(uint8_t indirect, uint32_t dst_offset)
     // Constrain gas cost
     gas_trace_builder.constrain_gas(static_cast<uint32_t>(row.main_clk), OpCode::BLOCKNUMBER);
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 }
 
 void AvmTraceBuilder::op_timestamp(uint8_t indirect, uint32_t dst_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
     FF ia_value = kernel_trace_builder.op_timestamp(clk);
     Row row = create_kernel_lookup_opcode(indirect, dst_offset, ia_value, AvmMemoryTag::U64);
     row.main_sel_op_timestamp = FF(1);
@@ -1397,12 +1538,12 @@ void AvmTraceBuilder::op_timestamp(uint8_t indirect, uint32_t dst_offset)
     // Constrain gas cost
     gas_trace_builder.constrain_gas(static_cast<uint32_t>(row.main_clk), OpCode::TIMESTAMP);
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 }
 
 void AvmTraceBuilder::op_coinbase(uint8_t indirect, uint32_t dst_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
     FF ia_value = kernel_trace_builder.op_coinbase(clk);
     Row row = create_kernel_lookup_opcode(indirect, dst_offset, ia_value, AvmMemoryTag::FF);
     row.main_sel_op_coinbase = FF(1);
@@ -1410,12 +1551,12 @@ void AvmTraceBuilder::op_coinbase(uint8_t indirect, uint32_t dst_offset)
     // Constrain gas cost
     gas_trace_builder.constrain_gas(static_cast<uint32_t>(row.main_clk), OpCode::COINBASE);
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 }
 
 void AvmTraceBuilder::op_fee_per_l2_gas(uint8_t indirect, uint32_t dst_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
     FF ia_value = kernel_trace_builder.op_fee_per_l2_gas(clk);
     Row row = create_kernel_lookup_opcode(indirect, dst_offset, ia_value, AvmMemoryTag::FF);
     row.main_sel_op_fee_per_l2_gas = FF(1);
@@ -1423,12 +1564,12 @@ void AvmTraceBuilder::op_fee_per_l2_gas(uint8_t indirect, uint32_t dst_offset)
     // Constrain gas cost
     gas_trace_builder.constrain_gas(static_cast<uint32_t>(row.main_clk), OpCode::FEEPERL2GAS);
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 }
 
 void AvmTraceBuilder::op_fee_per_da_gas(uint8_t indirect, uint32_t dst_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
     FF ia_value = kernel_trace_builder.op_fee_per_da_gas(clk);
     Row row = create_kernel_lookup_opcode(indirect, dst_offset, ia_value, AvmMemoryTag::FF);
     row.main_sel_op_fee_per_da_gas = FF(1);
@@ -1436,7 +1577,7 @@ void AvmTraceBuilder::op_fee_per_da_gas(uint8_t indirect, uint32_t dst_offset)
     // Constrain gas cost
     gas_trace_builder.constrain_gas(static_cast<uint32_t>(row.main_clk), OpCode::FEEPERDAGAS);
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 }
 
 /**************************************************************************************************
@@ -1463,7 +1604,7 @@ void AvmTraceBuilder::op_fee_per_da_gas(uint8_t indirect, uint32_t dst_offset)
  */
 void AvmTraceBuilder::op_calldata_copy(uint8_t indirect, uint32_t cd_offset, uint32_t copy_size, uint32_t dst_offset)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     uint32_t direct_dst_offset = dst_offset; // Will be overwritten in indirect mode.
 
@@ -1491,7 +1632,7 @@ void AvmTraceBuilder::op_calldata_copy(uint8_t indirect, uint32_t cd_offset, uin
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::CALLDATACOPY, copy_size);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_call_ptr = call_ptr,
         .main_ia = cd_offset,
@@ -1518,7 +1659,7 @@ void AvmTraceBuilder::execute_gasleft(OpCode opcode, uint8_t indirect, uint32_t
 {
     assert(opcode == OpCode::L2GASLEFT || opcode == OpCode::DAGASLEFT);
 
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     auto [resolved_dst] = unpack_indirects<1>(indirect, { dst_offset });
 
@@ -1538,7 +1679,7 @@ void AvmTraceBuilder::execute_gasleft(OpCode opcode, uint8_t indirect, uint32_t
     auto write_dst = constrained_write_to_memory(
         call_ptr, clk, resolved_dst, gas_remaining, AvmMemoryTag::U0, AvmMemoryTag::FF, IntermRegister::IA);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_call_ptr = call_ptr,
         .main_ia = gas_remaining,
@@ -1582,12 +1723,12 @@ void AvmTraceBuilder::op_dagasleft(uint8_t indirect, uint32_t dst_offset)
  */
 void AvmTraceBuilder::op_jump(uint32_t jmp_dest)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::JUMP);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_call_ptr = call_ptr,
         .main_ia = FF(jmp_dest),
@@ -1612,7 +1753,7 @@ void AvmTraceBuilder::op_jump(uint32_t jmp_dest)
  */
 void AvmTraceBuilder::op_jumpi(uint8_t indirect, uint32_t jmp_dest, uint32_t cond_offset)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     bool tag_match = true;
     uint32_t direct_cond_offset = cond_offset;
@@ -1636,7 +1777,7 @@ void AvmTraceBuilder::op_jumpi(uint8_t indirect, uint32_t jmp_dest, uint32_t con
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::JUMPI);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_call_ptr = call_ptr,
         .main_ia = FF(next_pc),
@@ -1674,7 +1815,7 @@ void AvmTraceBuilder::op_jumpi(uint8_t indirect, uint32_t jmp_dest, uint32_t con
  */
 void AvmTraceBuilder::op_internal_call(uint32_t jmp_dest)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     // We store the next instruction as the return location
     mem_trace_builder.write_into_memory(INTERNAL_CALL_SPACE_ID,
@@ -1688,7 +1829,7 @@ void AvmTraceBuilder::op_internal_call(uint32_t jmp_dest)
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::INTERNALCALL);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_call_ptr = call_ptr,
         .main_ia = FF(jmp_dest),
@@ -1720,7 +1861,7 @@ void AvmTraceBuilder::op_internal_call(uint32_t jmp_dest)
  */
 void AvmTraceBuilder::op_internal_return()
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     // Internal return pointer is decremented
     // We want to load the value pointed by the internal pointer
@@ -1730,7 +1871,7 @@ void AvmTraceBuilder::op_internal_return()
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::INTERNALRETURN);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_call_ptr = call_ptr,
         .main_ia = read_a.val,
@@ -1774,7 +1915,7 @@ void AvmTraceBuilder::op_set(uint8_t indirect, uint128_t val, uint32_t dst_offse
 
 void AvmTraceBuilder::op_set_internal(uint8_t indirect, FF val_ff, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
     auto [resolved_c] = unpack_indirects<1>(indirect, { dst_offset });
 
     auto write_c =
@@ -1783,7 +1924,7 @@ void AvmTraceBuilder::op_set_internal(uint8_t indirect, FF val_ff, uint32_t dst_
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::SET);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_call_ptr = call_ptr,
         .main_ic = write_c.val,
@@ -1810,7 +1951,7 @@ void AvmTraceBuilder::op_set_internal(uint8_t indirect, FF val_ff, uint32_t dst_
  */
 void AvmTraceBuilder::op_mov(uint8_t indirect, uint32_t src_offset, uint32_t dst_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
     bool tag_match = true;
     uint32_t direct_src_offset = src_offset;
     uint32_t direct_dst_offset = dst_offset;
@@ -1841,7 +1982,7 @@ void AvmTraceBuilder::op_mov(uint8_t indirect, uint32_t src_offset, uint32_t dst
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::MOV);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_call_ptr = call_ptr,
         .main_ia = val,
@@ -1879,7 +2020,7 @@ void AvmTraceBuilder::op_mov(uint8_t indirect, uint32_t src_offset, uint32_t dst
 void AvmTraceBuilder::op_cmov(
     uint8_t indirect, uint32_t a_offset, uint32_t b_offset, uint32_t cond_offset, uint32_t dst_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
     bool tag_match = true;
     uint32_t direct_a_offset = a_offset;
     uint32_t direct_b_offset = b_offset;
@@ -1941,7 +2082,7 @@ void AvmTraceBuilder::op_cmov(
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::CMOV);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_call_ptr = call_ptr,
         .main_ia = a_mem_entry.val,
@@ -2170,7 +2311,7 @@ Row AvmTraceBuilder::create_kernel_output_opcode_with_set_value_from_hint(uint8_
 
 void AvmTraceBuilder::op_sload(uint8_t indirect, uint32_t slot_offset, uint32_t size, uint32_t dest_offset)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     auto [resolved_slot, resolved_dest] = unpack_indirects<2>(indirect, { slot_offset, dest_offset });
 
@@ -2183,7 +2324,7 @@ void AvmTraceBuilder::op_sload(uint8_t indirect, uint32_t slot_offset, uint32_t
     //     call_ptr, clk, resolved_slot, AvmMemoryTag::FF, AvmMemoryTag::U0, IntermRegister::IA);
     //
     // Read the slot value that we will write hints to in a row
-    // main_trace.push_back(Row{
+    // add_main_trace_row(Row{
     //     .main_clk = clk,
     //     .main_ia = read_slot.val,
     //     .main_ind_addr_a = FF(read_slot.indirect_address),
@@ -2234,7 +2375,7 @@ void AvmTraceBuilder::op_sload(uint8_t indirect, uint32_t slot_offset, uint32_t
         // n_multiplier here.
         gas_trace_builder.constrain_gas(clk, OpCode::SLOAD);
 
-        main_trace.push_back(row);
+        add_main_trace_row(row);
 
         debug("sload side-effect cnt: ", side_effect_counter);
         side_effect_counter++;
@@ -2249,7 +2390,7 @@ void AvmTraceBuilder::op_sload(uint8_t indirect, uint32_t slot_offset, uint32_t
 
 void AvmTraceBuilder::op_sstore(uint8_t indirect, uint32_t src_offset, uint32_t size, uint32_t slot_offset)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     auto [resolved_src, resolved_slot] = unpack_indirects<2>(indirect, { src_offset, slot_offset });
 
@@ -2261,7 +2402,7 @@ void AvmTraceBuilder::op_sstore(uint8_t indirect, uint32_t src_offset, uint32_t
     // auto read_slot = constrained_read_from_memory(
     //     call_ptr, clk, resolved_slot, AvmMemoryTag::FF, AvmMemoryTag::FF, IntermRegister::IA);
     //
-    // main_trace.push_back(Row{
+    // add_main_trace_row(Row{
     //     .main_clk = clk,
     //     .main_ia = read_slot.val,
     //     .main_ind_addr_a = FF(read_slot.indirect_address),
@@ -2310,7 +2451,7 @@ void AvmTraceBuilder::op_sstore(uint8_t indirect, uint32_t src_offset, uint32_t
         // n_multiplier here.
         gas_trace_builder.constrain_gas(clk, OpCode::SSTORE);
 
-        main_trace.push_back(row);
+        add_main_trace_row(row);
 
         debug("sstore side-effect cnt: ", side_effect_counter);
         side_effect_counter++;
@@ -2324,7 +2465,7 @@ void AvmTraceBuilder::op_sstore(uint8_t indirect, uint32_t src_offset, uint32_t
 
 void AvmTraceBuilder::op_note_hash_exists(uint8_t indirect, uint32_t note_hash_offset, uint32_t dest_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
 
     Row row =
         create_kernel_output_opcode_with_set_metadata_output_from_hint(indirect, clk, note_hash_offset, dest_offset);
@@ -2335,7 +2476,7 @@ void AvmTraceBuilder::op_note_hash_exists(uint8_t indirect, uint32_t note_hash_o
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::NOTEHASHEXISTS);
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 
     debug("note_hash_exists side-effect cnt: ", side_effect_counter);
     side_effect_counter++;
@@ -2343,7 +2484,7 @@ void AvmTraceBuilder::op_note_hash_exists(uint8_t indirect, uint32_t note_hash_o
 
 void AvmTraceBuilder::op_emit_note_hash(uint8_t indirect, uint32_t note_hash_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
 
     Row row = create_kernel_output_opcode(indirect, clk, note_hash_offset);
     kernel_trace_builder.op_emit_note_hash(clk, side_effect_counter, row.main_ia);
@@ -2352,7 +2493,7 @@ void AvmTraceBuilder::op_emit_note_hash(uint8_t indirect, uint32_t note_hash_off
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::EMITNOTEHASH);
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 
     debug("emit_note_hash side-effect cnt: ", side_effect_counter);
     side_effect_counter++;
@@ -2360,7 +2501,7 @@ void AvmTraceBuilder::op_emit_note_hash(uint8_t indirect, uint32_t note_hash_off
 
 void AvmTraceBuilder::op_nullifier_exists(uint8_t indirect, uint32_t nullifier_offset, uint32_t dest_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
 
     Row row =
         create_kernel_output_opcode_with_set_metadata_output_from_hint(indirect, clk, nullifier_offset, dest_offset);
@@ -2371,7 +2512,7 @@ void AvmTraceBuilder::op_nullifier_exists(uint8_t indirect, uint32_t nullifier_o
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::NULLIFIEREXISTS);
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 
     debug("nullifier_exists side-effect cnt: ", side_effect_counter);
     side_effect_counter++;
@@ -2379,7 +2520,7 @@ void AvmTraceBuilder::op_nullifier_exists(uint8_t indirect, uint32_t nullifier_o
 
 void AvmTraceBuilder::op_emit_nullifier(uint8_t indirect, uint32_t nullifier_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
 
     Row row = create_kernel_output_opcode(indirect, clk, nullifier_offset);
     kernel_trace_builder.op_emit_nullifier(clk, side_effect_counter, row.main_ia);
@@ -2388,7 +2529,7 @@ void AvmTraceBuilder::op_emit_nullifier(uint8_t indirect, uint32_t nullifier_off
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::EMITNULLIFIER);
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 
     debug("emit_nullifier side-effect cnt: ", side_effect_counter);
     side_effect_counter++;
@@ -2396,7 +2537,7 @@ void AvmTraceBuilder::op_emit_nullifier(uint8_t indirect, uint32_t nullifier_off
 
 void AvmTraceBuilder::op_l1_to_l2_msg_exists(uint8_t indirect, uint32_t log_offset, uint32_t dest_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
 
     Row row = create_kernel_output_opcode_with_set_metadata_output_from_hint(indirect, clk, log_offset, dest_offset);
     kernel_trace_builder.op_l1_to_l2_msg_exists(
@@ -2406,7 +2547,7 @@ void AvmTraceBuilder::op_l1_to_l2_msg_exists(uint8_t indirect, uint32_t log_offs
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::L1TOL2MSGEXISTS);
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 
     debug("l1_to_l2_msg_exists side-effect cnt: ", side_effect_counter);
     side_effect_counter++;
@@ -2414,7 +2555,7 @@ void AvmTraceBuilder::op_l1_to_l2_msg_exists(uint8_t indirect, uint32_t log_offs
 
 void AvmTraceBuilder::op_get_contract_instance(uint8_t indirect, uint32_t address_offset, uint32_t dst_offset)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     auto [resolved_address_offset, resolved_dst_offset] = unpack_indirects<2>(indirect, { address_offset, dst_offset });
     auto read_address = constrained_read_from_memory(
@@ -2424,7 +2565,7 @@ void AvmTraceBuilder::op_get_contract_instance(uint8_t indirect, uint32_t addres
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::GETCONTRACTINSTANCE);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_ia = read_address.val,
         .main_ind_addr_a = FF(read_address.indirect_address),
@@ -2462,7 +2603,7 @@ void AvmTraceBuilder::op_emit_unencrypted_log(uint8_t indirect,
                                               uint32_t log_offset,
                                               [[maybe_unused]] uint32_t log_size_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
 
     // FIXME: read (and constrain) log_size_offset
     auto [resolved_log_offset, resolved_log_size_offset] =
@@ -2479,7 +2620,7 @@ void AvmTraceBuilder::op_emit_unencrypted_log(uint8_t indirect,
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::EMITUNENCRYPTEDLOG, static_cast<uint32_t>(log_size));
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 
     debug("emit_unencrypted_log side-effect cnt: ", side_effect_counter);
     side_effect_counter++;
@@ -2487,7 +2628,7 @@ void AvmTraceBuilder::op_emit_unencrypted_log(uint8_t indirect,
 
 void AvmTraceBuilder::op_emit_l2_to_l1_msg(uint8_t indirect, uint32_t recipient_offset, uint32_t content_offset)
 {
-    auto const clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto const clk = next_clk();
 
     // Note: unorthodox order - as seen in L2ToL1Message struct in TS
     Row row = create_kernel_output_opcode_with_metadata(
@@ -2498,7 +2639,7 @@ void AvmTraceBuilder::op_emit_l2_to_l1_msg(uint8_t indirect, uint32_t recipient_
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::SENDL2TOL1MSG);
 
-    main_trace.push_back(row);
+    add_main_trace_row(row);
 
     debug("emit_l2_to_l1_msg side-effect cnt: ", side_effect_counter);
     side_effect_counter++;
@@ -2536,7 +2677,7 @@ void AvmTraceBuilder::op_call(uint8_t indirect,
                               uint32_t success_offset,
                               [[maybe_unused]] uint32_t function_selector_offset)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
     const ExternalCallHint& hint = execution_hints.externalcall_hints.at(external_call_counter);
 
     auto [resolved_gas_offset,
@@ -2568,7 +2709,7 @@ void AvmTraceBuilder::op_call(uint8_t indirect,
                                                       static_cast<uint32_t>(hint.da_gas_used));
 
     // We read the input and output addresses in one row as they should contain FF elements
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_ia = read_gas_l2.val, /* gas_offset_l2 */
         .main_ib = read_gas_da.val, /* gas_offset_da */
@@ -2624,11 +2765,11 @@ void AvmTraceBuilder::op_call(uint8_t indirect,
  */
 std::vector<FF> AvmTraceBuilder::op_return(uint8_t indirect, uint32_t ret_offset, uint32_t ret_size)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
     gas_trace_builder.constrain_gas(clk, OpCode::RETURN, ret_size);
 
     if (ret_size == 0) {
-        main_trace.push_back(Row{
+        add_main_trace_row(Row{
             .main_clk = clk,
             .main_call_ptr = call_ptr,
             .main_ib = ret_size,
@@ -2662,7 +2803,7 @@ std::vector<FF> AvmTraceBuilder::op_return(uint8_t indirect, uint32_t ret_offset
         slice_trace_builder.create_return_slice(returndata, clk, call_ptr, direct_ret_offset, ret_size);
     }
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_call_ptr = call_ptr,
         .main_ib = ret_size,
@@ -2706,7 +2847,7 @@ void AvmTraceBuilder::op_keccak(uint8_t indirect,
                                 uint32_t input_offset,
                                 uint32_t input_size_offset)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
     auto [resolved_output_offset, resolved_input_offset, resolved_input_size_offset] =
         unpack_indirects<3>(indirect, { output_offset, input_offset, input_size_offset });
 
@@ -2719,7 +2860,7 @@ void AvmTraceBuilder::op_keccak(uint8_t indirect,
 
     // Store the clock time that we will use to line up the gadget later
     auto keccak_op_clk = clk;
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_ib = input_length_read.val, // Message Length
         .main_ind_addr_b = FF(input_length_read.indirect_address),
@@ -2760,7 +2901,7 @@ void AvmTraceBuilder::op_keccak(uint8_t indirect,
  */
 void AvmTraceBuilder::op_poseidon2_permutation(uint8_t indirect, uint32_t input_offset, uint32_t output_offset)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     // Resolve the indirect flags, the results of this function are used to determine the memory offsets
     // that point to the starting memory addresses for the input, output and h_init values
@@ -2790,7 +2931,7 @@ void AvmTraceBuilder::op_poseidon2_permutation(uint8_t indirect, uint32_t input_
     gas_trace_builder.constrain_gas(clk, OpCode::POSEIDON2);
 
     // Main trace contains on operand values from the bytecode and resolved indirects
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_ind_addr_a = FF(indirect_input_offset),
         .main_ind_addr_b = FF(indirect_output_offset),
@@ -2898,7 +3039,7 @@ void AvmTraceBuilder::op_sha256(uint8_t indirect,
                                 uint32_t input_offset,
                                 uint32_t input_size_offset)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
     auto [resolved_output_offset, resolved_input_offset, resolved_input_size_offset] =
         unpack_indirects<3>(indirect, { output_offset, input_offset, input_size_offset });
 
@@ -2909,7 +3050,7 @@ void AvmTraceBuilder::op_sha256(uint8_t indirect,
 
     // Store the clock time that we will use to line up the gadget later
     auto sha256_op_clk = clk;
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_ib = input_length_read.val, // Message Length
         .main_ind_addr_b = FF(input_length_read.indirect_address),
@@ -2951,7 +3092,7 @@ void AvmTraceBuilder::op_pedersen_hash(uint8_t indirect,
                                        uint32_t input_offset,
                                        uint32_t input_size_offset)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
     auto [resolved_gen_ctx_offset, resolved_output_offset, resolved_input_offset, resolved_input_size_offset] =
         unpack_indirects<4>(indirect, { gen_ctx_offset, output_offset, input_offset, input_size_offset });
 
@@ -2968,7 +3109,7 @@ void AvmTraceBuilder::op_pedersen_hash(uint8_t indirect,
     gas_trace_builder.constrain_gas(clk, OpCode::PEDERSEN);
 
     // We read the input and output addresses in one row as they should contain FF elements
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_ia = input_read.val, // First element of input
         .main_ind_addr_a = FF(input_read.indirect_address),
@@ -2997,7 +3138,7 @@ void AvmTraceBuilder::op_ec_add(uint8_t indirect,
                                 uint32_t rhs_is_inf_offset,
                                 uint32_t output_offset)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
     auto [resolved_lhs_x_offset,
           resolved_lhs_y_offset,
           resolved_lhs_is_inf_offset,
@@ -3030,7 +3171,7 @@ void AvmTraceBuilder::op_ec_add(uint8_t indirect,
                                            : grumpkin::g1::affine_element{ rhs_x_read, rhs_y_read };
     auto result = ecc_trace_builder.embedded_curve_add(lhs, rhs, clk);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_internal_return_ptr = FF(internal_return_ptr),
         .main_pc = FF(pc++),
@@ -3056,7 +3197,7 @@ void AvmTraceBuilder::op_variable_msm(uint8_t indirect,
                                       uint32_t output_offset,
                                       uint32_t point_length_offset)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
     auto [resolved_points_offset, resolved_scalars_offset, resolved_output_offset] =
         unpack_indirects<3>(indirect, { points_offset, scalars_offset, output_offset });
 
@@ -3119,7 +3260,7 @@ void AvmTraceBuilder::op_variable_msm(uint8_t indirect,
     // Perform the variable MSM - could just put the logic in here since there are no constraints.
     auto result = ecc_trace_builder.variable_msm(points, scalars, clk);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_internal_return_ptr = FF(internal_return_ptr),
         .main_pc = FF(pc++),
@@ -3145,7 +3286,7 @@ void AvmTraceBuilder::op_pedersen_commit(uint8_t indirect,
                                          uint32_t input_size_offset,
                                          uint32_t gen_ctx_offset)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
     auto [resolved_input_offset, resolved_output_offset, resolved_input_size_offset, resolved_gen_ctx_offset] =
         unpack_indirects<4>(indirect, { input_offset, output_offset, input_size_offset, gen_ctx_offset });
 
@@ -3157,7 +3298,7 @@ void AvmTraceBuilder::op_pedersen_commit(uint8_t indirect,
 
     grumpkin::g1::affine_element result = crypto::pedersen_commitment::commit_native(inputs, uint32_t(gen_ctx_read));
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_internal_return_ptr = FF(internal_return_ptr),
         .main_pc = FF(pc++),
@@ -3193,7 +3334,7 @@ void AvmTraceBuilder::op_pedersen_commit(uint8_t indirect,
 void AvmTraceBuilder::op_to_radix_le(
     uint8_t indirect, uint32_t src_offset, uint32_t dst_offset, uint32_t radix, uint32_t num_limbs)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
     auto [resolved_src_offset, resolved_dst_offset] = unpack_indirects<2>(indirect, { src_offset, dst_offset });
 
     auto read_src = constrained_read_from_memory(
@@ -3215,7 +3356,7 @@ void AvmTraceBuilder::op_to_radix_le(
 
     // This is the row that contains the selector to trigger the sel_op_radix_le
     // In this row, we read the input value and the destination address into register A and B respectively
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_call_ptr = call_ptr,
         .main_ia = input,
@@ -3261,7 +3402,7 @@ void AvmTraceBuilder::op_sha256_compression(uint8_t indirect,
                                             uint32_t input_offset)
 {
     // The clk plays a crucial role in this function as we attempt to write across multiple lines in the main trace.
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
 
     // Resolve the indirect flags, the results of this function are used to determine the memory offsets
     // that point to the starting memory addresses for the input and output values.
@@ -3285,7 +3426,7 @@ void AvmTraceBuilder::op_sha256_compression(uint8_t indirect,
     // change.
     // Note: we could avoid output being zero if we loaded the input and state beforehand (with a new function that
     // did not lay down constraints), but this is a simplification
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_ia = read_a.val, // First element of state
         .main_ib = read_b.val, // First element of input
@@ -3353,7 +3494,7 @@ void AvmTraceBuilder::op_keccakf1600(uint8_t indirect,
                                      [[maybe_unused]] uint32_t input_size_offset)
 {
     // What happens if the input_size_offset is > 25 when the state is more that that?
-    auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
+    auto clk = next_clk();
     auto [resolved_output_offset, resolved_input_offset] =
         unpack_indirects<2>(indirect, { output_offset, input_offset });
     auto input_read = constrained_read_from_memory(
@@ -3365,7 +3506,7 @@ void AvmTraceBuilder::op_keccakf1600(uint8_t indirect,
     // Constrain gas cost
     gas_trace_builder.constrain_gas(clk, OpCode::KECCAKF1600);
 
-    main_trace.push_back(Row{
+    add_main_trace_row(Row{
         .main_clk = clk,
         .main_ia = input_read.val,  // First element of input
         .main_ic = output_read.val, // First element of output
@@ -3412,6 +3553,10 @@ void AvmTraceBuilder::op_keccakf1600(uint8_t indirect,
  */
 std::vector<Row> AvmTraceBuilder::finalize(bool range_check_required)
 {
+    if (simulation_mode) {
+        throw_or_abort("A trace builder in simulation mode has no trace to finalize.");
+    }
+
     auto mem_trace = mem_trace_builder.finalize();
     auto conv_trace = conversion_trace_builder.finalize();
     auto sha256_trace = sha256_trace_builder.finalize();
@@ -3433,9 +3578,9 @@ std::vector<Row> AvmTraceBuilder::finalize(bool range_check_required)
     size_t slice_trace_size = slice_trace.size();
 
     // Data structure to collect all lookup counts pertaining to 16-bit/32-bit range checks in memory trace
-    std::unordered_map<uint16_t, uint32_t> mem_rng_check_lo_counts;
-    std::unordered_map<uint16_t, uint32_t> mem_rng_check_mid_counts;
-    std::unordered_map<uint8_t, uint32_t> mem_rng_check_hi_counts;
+    U16LookupCounts mem_rng_check_lo_counts;
+    U16LookupCounts mem_rng_check_mid_counts;
+    U8LookupCounts mem_rng_check_hi_counts;
 
     // Range check size is 1 less than it needs to be since we insert a "first row" at the top of the trace at the
     // end, with clk 0 (this doubles as our range check)
@@ -3482,218 +3627,115 @@ std::vector<Row> AvmTraceBuilder::finalize(bool range_check_required)
     // We only need to pad with zeroes to the size to the largest trace here,
     // pow_2 padding is handled in the subgroup_size check in BB.
     // Resize the main_trace to accomodate a potential lookup, filling with default empty rows.
+    // The capacity includes the first row inserted below, as reallocating on the insertion would double the capacity.
     main_trace_size = *trace_size;
+    main_trace.reserve(*trace_size + 1);
     main_trace.resize(*trace_size);
 
     /**********************************************************************************************
-     * MEMORY TRACE INCLUSION
+     * SUB-TRACES INCLUSION
      **********************************************************************************************/
 
-    // We compute in the main loop the timestamp and global address for next row.
-    // Perform initialization for index 0 outside of the loop provided that mem trace exists.
-    if (mem_trace_size > 0) {
-        main_trace.at(0).mem_tsp =
-            FF(AvmMemTraceBuilder::NUM_SUB_CLK * mem_trace.at(0).m_clk + mem_trace.at(0).m_sub_clk);
-
-        main_trace.at(0).mem_glob_addr =
-            FF(mem_trace.at(0).m_addr + (static_cast<uint64_t>(mem_trace.at(0).m_space_id) << 32));
-    }
-
-    for (size_t i = 0; i < mem_trace_size; i++) {
-        auto const& src = mem_trace.at(i);
-        auto& dest = main_trace.at(i);
-
-        dest.mem_sel_mem = FF(1);
-        dest.mem_clk = FF(src.m_clk);
-        dest.mem_addr = FF(src.m_addr);
-        dest.mem_space_id = FF(src.m_space_id);
-        dest.mem_val = src.m_val;
-        dest.mem_rw = FF(static_cast<uint32_t>(src.m_rw));
-        dest.mem_r_in_tag = FF(static_cast<uint32_t>(src.r_in_tag));
-        dest.mem_w_in_tag = FF(static_cast<uint32_t>(src.w_in_tag));
-        dest.mem_tag = FF(static_cast<uint32_t>(src.m_tag));
-        dest.mem_tag_err = FF(static_cast<uint32_t>(src.m_tag_err));
-        dest.mem_one_min_inv = src.m_one_min_inv;
-        dest.mem_sel_mov_ia_to_ic = FF(static_cast<uint32_t>(src.m_sel_mov_ia_to_ic));
-        dest.mem_sel_mov_ib_to_ic = FF(static_cast<uint32_t>(src.m_sel_mov_ib_to_ic));
-        dest.mem_sel_op_cmov = FF(static_cast<uint32_t>(src.m_sel_cmov));
-        dest.mem_sel_op_slice = FF(static_cast<uint32_t>(src.m_sel_op_slice));
-
-        dest.incl_mem_tag_err_counts = FF(static_cast<uint32_t>(src.m_tag_err_count_relevant));
-
-        // TODO: Should be a cleaner way to do this in the future. Perhaps an "into_canoncal" function in
-        // mem_trace_builder
-        if (!src.m_sel_op_slice) {
-            switch (src.m_sub_clk) {
-            case AvmMemTraceBuilder::SUB_CLK_LOAD_A:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_a = 1 : dest.mem_sel_op_a = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_STORE_A:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_a = 1 : dest.mem_sel_op_a = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_LOAD_B:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_b = 1 : dest.mem_sel_op_b = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_STORE_B:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_b = 1 : dest.mem_sel_op_b = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_LOAD_C:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_c = 1 : dest.mem_sel_op_c = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_STORE_C:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_c = 1 : dest.mem_sel_op_c = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_LOAD_D:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_d = 1 : dest.mem_sel_op_d = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_STORE_D:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_d = 1 : dest.mem_sel_op_d = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_A:
-                dest.mem_sel_resolve_ind_addr_a = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_B:
-                dest.mem_sel_resolve_ind_addr_b = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_C:
-                dest.mem_sel_resolve_ind_addr_c = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_D:
-                dest.mem_sel_resolve_ind_addr_d = 1;
-                break;
-            default:
-                break;
-            }
-        }
-
-        if (src.m_sel_cmov || src.m_sel_op_slice) {
-            dest.mem_skip_check_tag =
-                dest.mem_sel_op_cmov * (dest.mem_sel_op_d + dest.mem_sel_op_a * (-dest.mem_sel_mov_ia_to_ic + 1) +
-                                        dest.mem_sel_op_b * (-dest.mem_sel_mov_ib_to_ic + 1)) +
-                dest.mem_sel_op_slice;
-        }
-
-        if (i + 1 < mem_trace_size) {
-            auto const& next = mem_trace.at(i + 1);
-            auto& dest_next = main_trace.at(i + 1);
-            dest_next.mem_tsp = FF(AvmMemTraceBuilder::NUM_SUB_CLK * next.m_clk + next.m_sub_clk);
-            dest_next.mem_glob_addr = FF(next.m_addr + (static_cast<uint64_t>(next.m_space_id) << 32));
-
-            FF diff{};
-            if (dest_next.mem_glob_addr == dest.mem_glob_addr) {
-                diff = dest_next.mem_tsp - dest.mem_tsp;
-            } else {
-                diff = dest_next.mem_glob_addr - dest.mem_glob_addr;
-                dest.mem_lastAccess = FF(1);
-            }
-            dest.mem_sel_rng_chk = FF(1);
-
-            // Decomposition of diff
-            auto const diff_64 = uint64_t(diff);
-            auto const diff_hi = static_cast<uint8_t>(diff_64 >> 32);
-            auto const diff_mid = static_cast<uint16_t>((diff_64 & UINT32_MAX) >> 16);
-            auto const diff_lo = static_cast<uint16_t>(diff_64 & UINT16_MAX);
-            dest.mem_diff_hi = FF(diff_hi);
-            dest.mem_diff_mid = FF(diff_mid);
-            dest.mem_diff_lo = FF(diff_lo);
-
-            // Add the range checks counts
-            mem_rng_check_hi_counts[diff_hi]++;
-            mem_rng_check_mid_counts[diff_mid]++;
-            mem_rng_check_lo_counts[diff_lo]++;
-        } else {
-            dest.mem_lastAccess = FF(1);
-            dest.mem_last = FF(1);
-        }
+    // The memory, ALU, gadget, binary, gas and kernel traces are written into disjoint columns of the main trace and
+    // each counts its lookups into its own tables, so they are all merged concurrently. The memory trace, usually the
+    // largest one, is further split into ranges of rows with separate range check counts.
+    const size_t num_mem_chunks = calculate_num_threads(mem_trace_size, MIN_MEM_ROWS_PER_CHUNK);
+    std::vector<MemRngChkCounts> mem_rng_chk_chunk_counts(num_mem_chunks);
+
+    std::vector<std::function<void()>> merge_tasks;
+    for (size_t chunk = 0; chunk < num_mem_chunks; chunk++) {
+        merge_tasks.emplace_back([&, chunk] {
+            merge_mem_trace_rows(mem_trace,
+                                 main_trace,
+                                 mem_trace_size * chunk / num_mem_chunks,
+                                 mem_trace_size * (chunk + 1) / num_mem_chunks,
+                                 mem_rng_chk_chunk_counts[chunk]);
+        });
     }
 
-    /**********************************************************************************************
-     * ALU TRACE INCLUSION
-     **********************************************************************************************/
-
-    alu_trace_builder.finalize(main_trace);
-
-    /**********************************************************************************************
-     * GADGET TABLES INCLUSION
-     **********************************************************************************************/
+    merge_tasks.emplace_back([&] { alu_trace_builder.finalize(main_trace); });
 
     // Add Conversion Gadget table
-    for (size_t i = 0; i < conv_trace_size; i++) {
-        auto const& src = conv_trace.at(i);
-        auto& dest = main_trace.at(i);
-        dest.conversion_sel_to_radix_le = FF(static_cast<uint8_t>(src.to_radix_le_sel));
-        dest.conversion_clk = FF(src.conversion_clk);
-        dest.conversion_input = src.input;
-        dest.conversion_radix = FF(src.radix);
-        dest.conversion_num_limbs = FF(src.num_limbs);
-    }
+    merge_tasks.emplace_back([&] {
+        for (size_t i = 0; i < conv_trace_size; i++) {
+            auto const& src = conv_trace.at(i);
+            auto& dest = main_trace.at(i);
+            dest.conversion_sel_to_radix_le = FF(static_cast<uint8_t>(src.to_radix_le_sel));
+            dest.conversion_clk = FF(src.conversion_clk);
+            dest.conversion_input = src.input;
+            dest.conversion_radix = FF(src.radix);
+            dest.conversion_num_limbs = FF(src.num_limbs);
+        }
+    });
 
     // Add SHA256 Gadget table
-    for (size_t i = 0; i < sha256_trace_size; i++) {
-        auto const& src = sha256_trace.at(i);
-        auto& dest = main_trace.at(i);
-        dest.sha256_clk = FF(src.clk);
-        dest.sha256_input = src.input[0];
-        // TODO: This will need to be enabled later
-        // dest.sha256_output = src.output[0];
-        dest.sha256_sel_sha256_compression = FF(1);
-        dest.sha256_state = src.state[0];
-    }
+    merge_tasks.emplace_back([&] {
+        for (size_t i = 0; i < sha256_trace_size; i++) {
+            auto const& src = sha256_trace.at(i);
+            auto& dest = main_trace.at(i);
+            dest.sha256_clk = FF(src.clk);
+            dest.sha256_input = src.input[0];
+            // TODO: This will need to be enabled later
+            // dest.sha256_output = src.output[0];
+            dest.sha256_sel_sha256_compression = FF(1);
+            dest.sha256_state = src.state[0];
+        }
+    });
 
     // Add Poseidon2 Gadget table
-    for (size_t i = 0; i < poseidon2_trace_size; i++) {
-        auto& dest = main_trace.at(i);
-        auto const& src = poseidon2_trace.at(i);
-        dest.poseidon2_clk = FF(src.clk);
-        merge_into(dest, src);
-    }
+    merge_tasks.emplace_back([&] {
+        for (size_t i = 0; i < poseidon2_trace_size; i++) {
+            auto& dest = main_trace.at(i);
+            auto const& src = poseidon2_trace.at(i);
+            dest.poseidon2_clk = FF(src.clk);
+            merge_into(dest, src);
+        }
+    });
 
     // Add KeccakF1600 Gadget table
-    for (size_t i = 0; i < keccak_trace_size; i++) {
-        auto const& src = keccak_trace.at(i);
-        auto& dest = main_trace.at(i);
-        dest.keccakf1600_clk = FF(src.clk);
-        dest.keccakf1600_input = FF(src.input[0]);
-        // TODO: This will need to be enabled later
-        // dest.keccakf1600_output = src.output[0];
-        dest.keccakf1600_sel_keccakf1600 = FF(1);
-    }
+    merge_tasks.emplace_back([&] {
+        for (size_t i = 0; i < keccak_trace_size; i++) {
+            auto const& src = keccak_trace.at(i);
+            auto& dest = main_trace.at(i);
+            dest.keccakf1600_clk = FF(src.clk);
+            dest.keccakf1600_input = FF(src.input[0]);
+            // TODO: This will need to be enabled later
+            // dest.keccakf1600_output = src.output[0];
+            dest.keccakf1600_sel_keccakf1600 = FF(1);
+        }
+    });
 
     // Add Pedersen Gadget table
-    for (size_t i = 0; i < pedersen_trace_size; i++) {
-        auto const& src = pedersen_trace.at(i);
-        auto& dest = main_trace.at(i);
-        dest.pedersen_clk = FF(src.clk);
-        dest.pedersen_input = FF(src.input[0]);
-        dest.pedersen_sel_pedersen = FF(1);
-    }
-
-    /**********************************************************************************************
-     * SLICE TRACE INCLUSION
-     **********************************************************************************************/
-    for (size_t i = 0; i < slice_trace_size; i++) {
-        merge_into(main_trace.at(i), slice_trace.at(i));
-    }
+    merge_tasks.emplace_back([&] {
+        for (size_t i = 0; i < pedersen_trace_size; i++) {
+            auto const& src = pedersen_trace.at(i);
+            auto& dest = main_trace.at(i);
+            dest.pedersen_clk = FF(src.clk);
+            dest.pedersen_input = FF(src.input[0]);
+            dest.pedersen_sel_pedersen = FF(1);
+        }
+    });
 
-    /**********************************************************************************************
-     * BINARY TRACE INCLUSION
-     **********************************************************************************************/
+    // Add Slice trace
+    merge_tasks.emplace_back([&] {
+        for (size_t i = 0; i < slice_trace_size; i++) {
+            merge_into(main_trace.at(i), slice_trace.at(i));
+        }
+    });
 
-    bin_trace_builder.finalize(main_trace);
+    merge_tasks.emplace_back([&] { bin_trace_builder.finalize(main_trace); });
+    merge_tasks.emplace_back([&] { gas_trace_builder.finalize(main_trace); });
+    merge_tasks.emplace_back([&] { kernel_trace_builder.finalize(main_trace); });
 
-    /**********************************************************************************************
-     * GAS TRACE INCLUSION
-     **********************************************************************************************/
+    parallel_for(merge_tasks.size(), [&](size_t i) { merge_tasks[i](); });
 
-    gas_trace_builder.finalize(main_trace);
+    for (auto const& counts : mem_rng_chk_chunk_counts) {
+        mem_rng_check_lo_counts += counts.lo;
+        mem_rng_check_mid_counts += counts.mid;
+        mem_rng_check_hi_counts += counts.hi;
+    }
     const auto& rem_gas_rng_check_counts = gas_trace_builder.rem_gas_rng_check_counts;
 
-    /**********************************************************************************************
-     * KERNEL TRACE INCLUSION
-     **********************************************************************************************/
-
-    kernel_trace_builder.finalize(main_trace);
-
     /**********************************************************************************************
      * ONLY FIXED TABLES FROM HERE ON
      **********************************************************************************************/
@@ -3731,86 +3773,86 @@ std::vector<Row> AvmTraceBuilder::finalize(bool range_check_required)
                                                                                mem_rng_check_mid_counts,
                                                                                mem_rng_check_hi_counts,
                                                                                rem_gas_rng_check_counts);
-    for (size_t i = 0; i < new_trace_size; i++) {
-        auto& r = main_trace.at(i);
-
-        if ((r.main_sel_op_add == FF(1) || r.main_sel_op_sub == FF(1) || r.main_sel_op_mul == FF(1) ||
-             r.main_sel_op_eq == FF(1) || r.main_sel_op_not == FF(1) || r.main_sel_op_lt == FF(1) ||
-             r.main_sel_op_lte == FF(1) || r.main_sel_op_cast == FF(1) || r.main_sel_op_shr == FF(1) ||
-             r.main_sel_op_shl == FF(1) || r.main_sel_op_div == FF(1)) &&
-            r.main_tag_err == FF(0) && r.main_op_err == FF(0)) {
-            r.main_sel_alu = FF(1);
-        }
-
-        if (r.main_sel_op_internal_call == FF(1) || r.main_sel_op_internal_return == FF(1)) {
-            r.main_space_id = INTERNAL_CALL_SPACE_ID;
-        } else {
-            r.main_space_id = r.main_call_ptr;
-        };
+    // Every row is filled independently from the others.
+    parallel_for_range(new_trace_size, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            auto& r = main_trace.at(i);
+
+            if ((r.main_sel_op_add == FF(1) || r.main_sel_op_sub == FF(1) || r.main_sel_op_mul == FF(1) ||
+                 r.main_sel_op_eq == FF(1) || r.main_sel_op_not == FF(1) || r.main_sel_op_lt == FF(1) ||
+                 r.main_sel_op_lte == FF(1) || r.main_sel_op_cast == FF(1) || r.main_sel_op_shr == FF(1) ||
+                 r.main_sel_op_shl == FF(1) || r.main_sel_op_div == FF(1)) &&
+                r.main_tag_err == FF(0) && r.main_op_err == FF(0)) {
+                r.main_sel_alu = FF(1);
+            }
 
-        r.main_clk = i >= old_trace_size ? r.main_clk : FF(i);
-        auto counter = i >= old_trace_size ? static_cast<uint32_t>(r.main_clk) : static_cast<uint32_t>(i);
-        r.incl_main_tag_err_counts = mem_trace_builder.m_tag_err_lookup_counts[static_cast<uint32_t>(counter)];
-
-        if (counter <= UINT8_MAX) {
-            auto counter_u8 = static_cast<uint8_t>(counter);
-            r.lookup_u8_0_counts = alu_trace_builder.u8_range_chk_counters[0][counter_u8];
-            r.lookup_u8_1_counts = alu_trace_builder.u8_range_chk_counters[1][counter_u8];
-            r.lookup_pow_2_0_counts = alu_trace_builder.u8_pow_2_counters[0][counter_u8];
-            r.lookup_pow_2_1_counts = alu_trace_builder.u8_pow_2_counters[1][counter_u8];
-            r.lookup_mem_rng_chk_hi_counts = mem_rng_check_hi_counts[counter_u8];
-            r.main_sel_rng_8 = FF(1);
-
-            // Also merge the powers of 2 table.
-            merge_into(r, FixedPowersTable::get().at(counter));
-        }
+            if (r.main_sel_op_internal_call == FF(1) || r.main_sel_op_internal_return == FF(1)) {
+                r.main_space_id = INTERNAL_CALL_SPACE_ID;
+            } else {
+                r.main_space_id = r.main_call_ptr;
+            };
+
+            r.main_clk = i >= old_trace_size ? r.main_clk : FF(i);
+            auto counter = i >= old_trace_size ? static_cast<uint32_t>(r.main_clk) : static_cast<uint32_t>(i);
+            auto tag_err_count = mem_trace_builder.m_tag_err_lookup_counts.find(counter);
+            r.incl_main_tag_err_counts =
+                tag_err_count == mem_trace_builder.m_tag_err_lookup_counts.end() ? 0 : tag_err_count->second;
+
+            if (counter <= UINT8_MAX) {
+                auto counter_u8 = static_cast<uint8_t>(counter);
+                r.lookup_u8_0_counts = alu_trace_builder.u8_range_chk_counters[0][counter_u8];
+                r.lookup_u8_1_counts = alu_trace_builder.u8_range_chk_counters[1][counter_u8];
+                r.lookup_pow_2_0_counts = alu_trace_builder.u8_pow_2_counters[0][counter_u8];
+                r.lookup_pow_2_1_counts = alu_trace_builder.u8_pow_2_counters[1][counter_u8];
+                r.lookup_mem_rng_chk_hi_counts = mem_rng_check_hi_counts[counter_u8];
+                r.main_sel_rng_8 = FF(1);
+
+                // Also merge the powers of 2 table.
+                merge_into(r, FixedPowersTable::get().at(counter));
+            }
 
-        if (counter <= UINT16_MAX) {
-            // We add to the clk here in case our trace is smaller than our range checks
-            // There might be a cleaner way to do this in the future as this only applies
-            // when our trace (excluding range checks) is < 2**16
-            r.lookup_u16_0_counts = alu_trace_builder.u16_range_chk_counters[0][static_cast<uint16_t>(counter)];
-            r.lookup_u16_1_counts = alu_trace_builder.u16_range_chk_counters[1][static_cast<uint16_t>(counter)];
-            r.lookup_u16_2_counts = alu_trace_builder.u16_range_chk_counters[2][static_cast<uint16_t>(counter)];
-            r.lookup_u16_3_counts = alu_trace_builder.u16_range_chk_counters[3][static_cast<uint16_t>(counter)];
-            r.lookup_u16_4_counts = alu_trace_builder.u16_range_chk_counters[4][static_cast<uint16_t>(counter)];
-            r.lookup_u16_5_counts = alu_trace_builder.u16_range_chk_counters[5][static_cast<uint16_t>(counter)];
-            r.lookup_u16_6_counts = alu_trace_builder.u16_range_chk_counters[6][static_cast<uint16_t>(counter)];
-            r.lookup_u16_7_counts = alu_trace_builder.u16_range_chk_counters[7][static_cast<uint16_t>(counter)];
-            r.lookup_u16_8_counts = alu_trace_builder.u16_range_chk_counters[8][static_cast<uint16_t>(counter)];
-            r.lookup_u16_9_counts = alu_trace_builder.u16_range_chk_counters[9][static_cast<uint16_t>(counter)];
-            r.lookup_u16_10_counts = alu_trace_builder.u16_range_chk_counters[10][static_cast<uint16_t>(counter)];
-            r.lookup_u16_11_counts = alu_trace_builder.u16_range_chk_counters[11][static_cast<uint16_t>(counter)];
-            r.lookup_u16_12_counts = alu_trace_builder.u16_range_chk_counters[12][static_cast<uint16_t>(counter)];
-            r.lookup_u16_13_counts = alu_trace_builder.u16_range_chk_counters[13][static_cast<uint16_t>(counter)];
-            r.lookup_u16_14_counts = alu_trace_builder.u16_range_chk_counters[14][static_cast<uint16_t>(counter)];
-
-            r.lookup_mem_rng_chk_mid_counts = mem_rng_check_mid_counts[static_cast<uint16_t>(counter)];
-            r.lookup_mem_rng_chk_lo_counts = mem_rng_check_lo_counts[static_cast<uint16_t>(counter)];
-
-            r.lookup_div_u16_0_counts = alu_trace_builder.div_u64_range_chk_counters[0][static_cast<uint16_t>(counter)];
-            r.lookup_div_u16_1_counts = alu_trace_builder.div_u64_range_chk_counters[1][static_cast<uint16_t>(counter)];
-            r.lookup_div_u16_2_counts = alu_trace_builder.div_u64_range_chk_counters[2][static_cast<uint16_t>(counter)];
-            r.lookup_div_u16_3_counts = alu_trace_builder.div_u64_range_chk_counters[3][static_cast<uint16_t>(counter)];
-            r.lookup_div_u16_4_counts = alu_trace_builder.div_u64_range_chk_counters[4][static_cast<uint16_t>(counter)];
-            r.lookup_div_u16_5_counts = alu_trace_builder.div_u64_range_chk_counters[5][static_cast<uint16_t>(counter)];
-            r.lookup_div_u16_6_counts = alu_trace_builder.div_u64_range_chk_counters[6][static_cast<uint16_t>(counter)];
-            r.lookup_div_u16_7_counts = alu_trace_builder.div_u64_range_chk_counters[7][static_cast<uint16_t>(counter)];
-
-            auto at_or_zero = [](const auto& map, auto idx) { return map.contains(idx) ? map.at(idx) : 0; };
-
-            r.range_check_l2_gas_hi_counts =
-                at_or_zero(rem_gas_rng_check_counts[L2_HI_GAS_COUNTS_IDX], static_cast<uint16_t>(counter));
-            r.range_check_l2_gas_lo_counts =
-                at_or_zero(rem_gas_rng_check_counts[L2_LO_GAS_COUNTS_IDX], static_cast<uint16_t>(counter));
-            r.range_check_da_gas_hi_counts =
-                at_or_zero(rem_gas_rng_check_counts[DA_HI_GAS_COUNTS_IDX], static_cast<uint16_t>(counter));
-            r.range_check_da_gas_lo_counts =
-                at_or_zero(rem_gas_rng_check_counts[DA_LO_GAS_COUNTS_IDX], static_cast<uint16_t>(counter));
-
-            r.main_sel_rng_16 = FF(1);
+            if (counter <= UINT16_MAX) {
+                // We add to the clk here in case our trace is smaller than our range checks
+                // There might be a cleaner way to do this in the future as this only applies
+                // when our trace (excluding range checks) is < 2**16
+                auto counter_u16 = static_cast<uint16_t>(counter);
+                r.lookup_u16_0_counts = alu_trace_builder.u16_range_chk_counters[0][counter_u16];
+                r.lookup_u16_1_counts = alu_trace_builder.u16_range_chk_counters[1][counter_u16];
+                r.lookup_u16_2_counts = alu_trace_builder.u16_range_chk_counters[2][counter_u16];
+                r.lookup_u16_3_counts = alu_trace_builder.u16_range_chk_counters[3][counter_u16];
+                r.lookup_u16_4_counts = alu_trace_builder.u16_range_chk_counters[4][counter_u16];
+                r.lookup_u16_5_counts = alu_trace_builder.u16_range_chk_counters[5][counter_u16];
+                r.lookup_u16_6_counts = alu_trace_builder.u16_range_chk_counters[6][counter_u16];
+                r.lookup_u16_7_counts = alu_trace_builder.u16_range_chk_counters[7][counter_u16];
+                r.lookup_u16_8_counts = alu_trace_builder.u16_range_chk_counters[8][counter_u16];
+                r.lookup_u16_9_counts = alu_trace_builder.u16_range_chk_counters[9][counter_u16];
+                r.lookup_u16_10_counts = alu_trace_builder.u16_range_chk_counters[10][counter_u16];
+                r.lookup_u16_11_counts = alu_trace_builder.u16_range_chk_counters[11][counter_u16];
+                r.lookup_u16_12_counts = alu_trace_builder.u16_range_chk_counters[12][counter_u16];
+                r.lookup_u16_13_counts = alu_trace_builder.u16_range_chk_counters[13][counter_u16];
+                r.lookup_u16_14_counts = alu_trace_builder.u16_range_chk_counters[14][counter_u16];
+
+                r.lookup_mem_rng_chk_mid_counts = mem_rng_check_mid_counts[counter_u16];
+                r.lookup_mem_rng_chk_lo_counts = mem_rng_check_lo_counts[counter_u16];
+
+                r.lookup_div_u16_0_counts = alu_trace_builder.div_u64_range_chk_counters[0][counter_u16];
+                r.lookup_div_u16_1_counts = alu_trace_builder.div_u64_range_chk_counters[1][counter_u16];
+                r.lookup_div_u16_2_counts = alu_trace_builder.div_u64_range_chk_counters[2][counter_u16];
+                r.lookup_div_u16_3_counts = alu_trace_builder.div_u64_range_chk_counters[3][counter_u16];
+                r.lookup_div_u16_4_counts = alu_trace_builder.div_u64_range_chk_counters[4][counter_u16];
+                r.lookup_div_u16_5_counts = alu_trace_builder.div_u64_range_chk_counters[5][counter_u16];
+                r.lookup_div_u16_6_counts = alu_trace_builder.div_u64_range_chk_counters[6][counter_u16];
+                r.lookup_div_u16_7_counts = alu_trace_builder.div_u64_range_chk_counters[7][counter_u16];
+
+                r.range_check_l2_gas_hi_counts = rem_gas_rng_check_counts[L2_HI_GAS_COUNTS_IDX][counter];
+                r.range_check_l2_gas_lo_counts = rem_gas_rng_check_counts[L2_LO_GAS_COUNTS_IDX][counter];
+                r.range_check_da_gas_hi_counts = rem_gas_rng_check_counts[DA_HI_GAS_COUNTS_IDX][counter];
+                r.range_check_da_gas_lo_counts = rem_gas_rng_check_counts[DA_LO_GAS_COUNTS_IDX][counter];
+
+                r.main_sel_rng_16 = FF(1);
+            }
         }
-    }
+    });
 
     /**********************************************************************************************
      * OTHER STUFF
@@ -3867,6 +3909,7 @@ std::vector<Row> AvmTraceBuilder::finalize(bool range_check_required)
 void AvmTraceBuilder::reset()
 {
     main_trace.clear();
+    num_simulated_rows = 0;
     mem_trace_builder.reset();
     alu_trace_builder.reset();
     bin_trace_builder.reset();
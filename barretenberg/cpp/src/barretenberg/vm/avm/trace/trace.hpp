@@ -54,10 +54,16 @@ class AvmTraceBuilder {
     AvmTraceBuilder(VmPublicInputs public_inputs = {},
                     ExecutionHints execution_hints = {},
                     uint32_t side_effect_counter = 0,
-                    std::vector<FF> calldata = {});
+                    std::vector<FF> calldata = {},
+                    bool simulation_mode = false);
 
     uint32_t getPc() const { return pc; }
 
+    // Outputs of the execution, also available in simulation mode.
+    uint32_t get_l2_gas_left() const { return gas_trace_builder.get_l2_gas_left(); }
+    uint32_t get_da_gas_left() const { return gas_trace_builder.get_da_gas_left(); }
+    VmPublicInputs const& get_public_inputs() const { return kernel_trace_builder.get_public_inputs(); }
+
     // Compute - Arithmetic
     void op_add(uint8_t indirect, uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag);
     void op_sub(uint8_t indirect, uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag);
@@ -195,6 +201,18 @@ class AvmTraceBuilder {
   private:
     std::vector<Row> main_trace;
 
+    // In simulation mode, the opcodes are executed with the same semantics (memory, gas, side effects and return data)
+    // but neither the main trace nor the sub-traces and their lookup counts are recorded. The rows are only counted so
+    // that the clocks are the same as in tracing mode. The trace cannot be finalized.
+    bool simulation_mode = false;
+    uint32_t num_simulated_rows = 0;
+
+    uint32_t next_clk() const
+    {
+        return (simulation_mode ? num_simulated_rows : static_cast<uint32_t>(main_trace.size())) + 1;
+    }
+    void add_main_trace_row(Row const& row);
+
     std::vector<FF> calldata;
     std::vector<FF> returndata;
     // Side effect counter will increment when any state writing values are encountered.